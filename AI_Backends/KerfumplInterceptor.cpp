@@ -7,17 +7,37 @@
 
 static ID3D11Device* g_device = nullptr;
 static ID3D11DeviceContext* g_context = nullptr;
+static int sceneSubscription = -1;
+static bool frameFolded = false;
+
+// New scene: residues from the previous one are no longer useful
+static void OnSceneTransition(const EntropyPredictor::SceneTransitionEvent& event, void*) {
+    std::cout << "[Kerflump] Scene transition #" << event.sceneIndex << " detected.\n";
+    KerflumpInterceptor::PostFrameJumpFlush();
+}
 
 void KerflumpInterceptor::Initialize(ID3D11Device* device, ID3D11DeviceContext* context) {
     g_device = device;
     g_context = context;
+    if (sceneSubscription < 0)
+        sceneSubscription = EntropyPredictor::SubscribeSceneTransition(OnSceneTransition);
     std::cout << "[Kerflump] Interceptor initialized.\n";
 }
 
 void KerflumpInterceptor::PreFrameFold() {
-    if (EntropyPredictor::IsOverloaded()) {
+    const bool overloaded = EntropyPredictor::IsOverloaded();
+    if (overloaded == frameFolded)
+        return;
+
+    frameFolded = overloaded;
+    if (overloaded) {
         std::cout << "[Kerflump] Entropy spike detected. Initiating frame fold.\n";
-        ShaderOverrideUnit::ForceMinimal(true);
+        ShaderOverrideUnit::SetQualityCap(QUADRAQ::ShaderQuality::Minimal);
+    }
+    else {
+        // The ladder climbs back through its own hysteresis
+        std::cout << "[Kerflump] Entropy settled. Releasing frame fold.\n";
+        ShaderOverrideUnit::SetQualityCap(QUADRAQ::ShaderQuality::Full);
     }
 }
 
@@ -0,0 +1,141 @@
+// ====================================================================
+//                       quadraq_budget_loop.cpp
+//     TGDK Quantum GPU Accelerator — Budgeted Suppression Loop Check
+//     Drives EntropyPredictor and QuantumDrawRouter in closed loop on
+//     a virtual clock: shed draws shorten the next measured frame
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "EntropyPredictor.hpp"
+#include "QuantumDrawRouter.hpp"
+#include "FrameClock.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+    struct Phase {
+        const char* name;
+        float baseCost;         // frame time not spent in budgeted draws (s)
+        uint32_t frames;
+        bool expectShedding;
+    };
+
+    struct PhaseResult {
+        double meanFrameTime = 0.0;
+        float maxFrameTime = 0.0f;
+        uint32_t allKeptFrames = 0;     // frames that shed nothing
+        uint32_t flips = 0;             // shed -> keep-all -> shed transitions
+        size_t minSurvivors = SIZE_MAX;
+        size_t maxSurvivors = 0;
+    };
+}
+
+int main(int argc, char** argv) {
+    const bool trace = argc > 1 && std::strcmp(argv[1], "--trace") == 0;
+
+    const size_t drawCount = 2000;
+    const float budget = 1.0f / 60.0f;
+    const uint32_t settleFrames = 120;
+
+    // ~12 ms of budgeted draws; a tenth are Critical and never shed
+    std::mt19937 rng(7);
+    std::exponential_distribution<float> costOf(1.0f);
+    std::vector<float> costs(drawCount);
+    std::vector<QuantumDrawRouter::DrawImportance> importance(drawCount);
+    float totalCost = 0.0f;
+    for (size_t i = 0; i < drawCount; ++i) {
+        costs[i] = costOf(rng);
+        totalCost += costs[i];
+        const uint32_t roll = rng() % 10;
+        importance[i] = roll == 0 ? QuantumDrawRouter::DrawImportance::Critical
+                      : roll < 4 ? QuantumDrawRouter::DrawImportance::High
+                      : roll < 7 ? QuantumDrawRouter::DrawImportance::Medium
+                                 : QuantumDrawRouter::DrawImportance::Low;
+    }
+    for (float& cost : costs) cost *= 0.012f / totalCost;
+    totalCost = 0.012f;
+
+    const Phase phases[] = {
+        { "heavy", 0.008f, 600, true },        // 20 ms unshed against 16.7 ms
+        { "light", 0.003f, 400, false },       // fits without shedding
+        { "heavier", 0.0095f, 600, true },
+    };
+
+    FrameClock::SetVirtual(true);
+    EntropyPredictor::Initialize();
+    EntropyPredictor::SetEnabled(true);
+    QuantumDrawRouter::EnableRouting(true);
+    QuantumDrawRouter::SetFrameBudget(budget);
+    QuantumDrawRouter::SetBudgetedMode(true);
+
+    std::vector<uint64_t> mask((drawCount + 63) / 64);
+    std::normal_distribution<float> noise(0.0f, 0.01f);
+    float keptCost = totalCost;
+    bool ok = true;
+    uint32_t frame = 0;
+
+    for (const Phase& phase : phases) {
+        PhaseResult result;
+        int lastShed = -1;
+        uint32_t measured = 0;
+
+        for (uint32_t i = 0; i < phase.frames; ++i, ++frame) {
+            // This frame's time reflects what the previous policy shed
+            const float frameTime = (phase.baseCost + keptCost) * (1.0f + noise(rng));
+            FrameClock::Advance(static_cast<uint64_t>(frameTime * 1e9f));
+            EntropyPredictor::UpdateCycle();
+            QuantumDrawRouter::BeginFrame();
+
+            const size_t survivors = QuantumDrawRouter::EvaluateBudgetedBatch(costs.data(), importance.data(), drawCount, mask.data());
+            keptCost = 0.0f;
+            for (size_t d = 0; d < drawCount; ++d) {
+                if ((mask[d >> 6] >> (d & 63)) & 1) keptCost += costs[d];
+            }
+
+            if (trace) {
+                const QuantumDrawRouter::FramePolicy policy = QuantumDrawRouter::GetFramePolicy();
+                std::printf("%u %s %.3f ms projected %.3f ms shed target %.3f ms survivors %zu\n", frame, phase.name,
+                    frameTime * 1000.0f, policy.projectedFrameTime * 1000.0f, policy.budgetExcess * 1000.0f, survivors);
+            }
+
+            if (i < settleFrames) continue;
+
+            const int shed = survivors != drawCount ? 1 : 0;
+            if (lastShed == 0 && shed == 1) ++result.flips;
+            lastShed = shed;
+
+            result.meanFrameTime += frameTime;
+            result.maxFrameTime = std::fmax(result.maxFrameTime, frameTime);
+            result.allKeptFrames += shed ? 0 : 1;
+            result.minSurvivors = std::min(result.minSurvivors, survivors);
+            result.maxSurvivors = std::max(result.maxSurvivors, survivors);
+            ++measured;
+        }
+
+        result.meanFrameTime /= measured;
+        std::printf("%-8s unshed %.2f ms | settled mean %.2f ms, max %.2f ms | survivors %zu..%zu | keep-all frames %u, flips %u\n",
+            phase.name, (phase.baseCost + totalCost) * 1000.0f, result.meanFrameTime * 1000.0, result.maxFrameTime * 1000.0f,
+            result.minSurvivors, result.maxSurvivors, result.allKeptFrames, result.flips);
+
+        if (phase.expectShedding) {
+            // Settled: at or just under budget, never letting every draw back
+            const bool fits = result.meanFrameTime <= budget * 1.02 && result.meanFrameTime >= budget * 0.90;
+            if (!fits || result.allKeptFrames != 0 || result.flips != 0) {
+                std::printf("  FAIL: did not settle at the budget\n");
+                ok = false;
+            }
+        }
+        else if (result.allKeptFrames != measured) {
+            std::printf("  FAIL: shed draws with the frame under budget\n");
+            ok = false;
+        }
+    }
+
+    std::printf("%s\n", ok ? "budget loop converged" : "budget loop FAILED");
+    return ok ? 0 : 1;
+}
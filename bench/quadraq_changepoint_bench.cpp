@@ -0,0 +1,144 @@
+// ====================================================================
+//                     quadraq_changepoint_bench.cpp
+//     TGDK Quantum GPU Accelerator — Scene Transition Detection Check
+//     ChangePointDetector on synthetic frame times: level shifts up and
+//     down are reported once, in the right direction, within the delay
+//     the Page-Hinkley parameters allow, while stationary jitter and
+//     isolated spikes stay quiet
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "ChangePointDetector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    // Frames a noise-free shift of `step` seconds needs to accumulate the
+    // threshold, once each frame's deviation is capped and the drift
+    // tolerance taken off
+    size_t IdealDelay(const ChangePointDetector::Parameters& p, float step) {
+        const double cap = p.threshold / static_cast<double>(p.minRunFrames);
+        const double perFrame = std::min(static_cast<double>(std::fabs(step)), cap) - p.driftTolerance;
+        return perFrame > 0.0 ? static_cast<size_t>(std::ceil(p.threshold / perFrame)) : SIZE_MAX;
+    }
+
+    struct Shift {
+        const char* name;
+        float from, to;
+        int direction;
+    };
+}
+
+int main(int argc, char** argv) {
+    size_t trials = 200;
+    size_t frames = 200000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--trials") == 0) trials = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    size_t errors = 0;
+    const ChangePointDetector::Parameters params;
+    std::mt19937 rng(5);
+    std::normal_distribution<float> jitter(0.0f, 0.0005f);
+
+    // --- Step changes: detected once, in direction, within the delay ---
+    {
+        const Shift shifts[] = {
+            { "60->30 fps", 1.0f / 60, 1.0f / 30, 1 },
+            { "30->60 fps", 1.0f / 30, 1.0f / 60, -1 },
+            { "60->45 fps", 1.0f / 60, 1.0f / 45, 1 },
+            { "60->20 fps", 1.0f / 60, 1.0f / 20, 1 },
+            { "20->144 fps", 1.0f / 20, 1.0f / 144, -1 },
+        };
+        std::uniform_int_distribution<size_t> settle(params.warmupFrames, 600);
+
+        for (const Shift& shift : shifts) {
+            const size_t ideal = IdealDelay(params, shift.to - shift.from);
+            // The segment mean creeps toward the new level as the shift's
+            // frames enter it, so allow twice the noise-free delay
+            const size_t bound = 2 * ideal;
+            size_t worst = 0, total = 0, early = 0, missed = 0, wrong = 0, returned = 0;
+
+            for (size_t trial = 0; trial < trials; ++trial) {
+                ChangePointDetector detector(params);
+                const size_t before = settle(rng);
+                for (size_t i = 0; i < before; ++i) early += detector.Push(shift.from + jitter(rng)) != 0;
+
+                size_t delay = 0;
+                int direction = 0;
+                while (direction == 0 && delay < 10 * bound) {
+                    direction = detector.Push(shift.to + jitter(rng));
+                    ++delay;
+                }
+                missed += direction == 0;
+                wrong += direction != 0 && direction != shift.direction;
+                worst = std::max(worst, delay);
+                total += delay;
+
+                // The new level is now the quiet one, and a shift back is caught
+                for (size_t i = 0; i < 2000; ++i) early += detector.Push(shift.to + jitter(rng)) != 0;
+                int back = 0;
+                for (size_t i = 0; back == 0 && i < bound; ++i) back = detector.Push(shift.from + jitter(rng));
+                returned += back == -shift.direction;
+            }
+
+            errors += early + missed + wrong + (trials - returned);
+            errors += worst > bound || total < trials * params.minRunFrames;
+            std::printf("%-12s delay mean %5.1f worst %3zu frames (ideal %zu, bound %zu), %zu false, %zu missed, %zu/%zu back\n",
+                shift.name, static_cast<double>(total) / trials, worst, ideal, bound, early, missed + wrong, returned, trials);
+        }
+    }
+
+    // --- Armed only after the warm-up ---
+    {
+        ChangePointDetector detector(params);
+        size_t fired = 0;
+        for (uint32_t i = 0; i + 1 < params.warmupFrames; ++i)
+            fired += detector.Push(i % 2 ? 1.0f / 60 : 1.0f / 10) != 0;
+        errors += fired;
+        std::printf("warm-up: %zu detections in the first %u frames\n", fired, params.warmupFrames - 1);
+    }
+
+    // --- Stationary noise and isolated spikes: quiet ---
+    {
+        struct Stream {
+            const char* name;
+            float level, spread;
+            bool uniform;
+            float spike;
+            size_t spikeEvery;
+        };
+        const Stream streams[] = {
+            { "gaussian 60 fps, 0.5 ms", 1.0f / 60, 0.0005f, false, 0.0f, 0 },
+            { "gaussian 30 fps, 1.5 ms", 1.0f / 30, 0.0015f, false, 0.0f, 0 },
+            { "uniform 60 fps, +-4 ms", 1.0f / 60, 0.004f, true, 0.0f, 0 },
+            { "100 ms spike every 40", 1.0f / 60, 0.0005f, false, 0.100f, 40 },
+            { "2 s hitch every 500", 1.0f / 60, 0.0005f, false, 2.0f, 500 },
+        };
+        for (const Stream& stream : streams) {
+            ChangePointDetector detector(params);
+            std::normal_distribution<float> gaussian(0.0f, stream.spread);
+            std::uniform_real_distribution<float> uniform(-stream.spread, stream.spread);
+            size_t fired = 0;
+            for (size_t i = 0; i < frames; ++i) {
+                float sample = stream.level + (stream.uniform ? uniform(rng) : gaussian(rng));
+                if (stream.spikeEvery && i % stream.spikeEvery == stream.spikeEvery - 1) sample = stream.spike;
+                fired += detector.Push(sample) != 0;
+            }
+            errors += fired;
+            std::printf("%-24s %zu frames, %zu detections\n", stream.name, frames, fired);
+        }
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+// ====================================================================
+//                       quadraq_channels_bench.cpp
+//     TGDK Quantum GPU Accelerator — Signal Fusion Check
+//     SignalChannelBank against a model of the fused score: channels
+//     that were never fed, are still warming up or have stalled stay out
+//     of it, a stalled channel rejoins on its next sample, and the score
+//     is the weighted positive z-score of exactly the live channels
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "SignalChannelBank.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    constexpr size_t kWindow = 32;
+    constexpr uint32_t kStale = 8;
+    constexpr size_t kMinSamples = 8;      // samples a window needs before it scores
+
+    // One channel the way the bank should see it, in doubles
+    struct ModelChannel {
+        float weight = 1.0f;
+        std::deque<float> window;
+        uint64_t pushedFrame = 0;
+        bool scored = false;                // the latest sample had a window to score against
+        double contribution = 0.0;
+
+        void Push(float value, uint64_t frame) {
+            scored = window.size() >= kMinSamples;
+            double z = 0.0;
+            if (scored) {
+                double mean = 0.0, squares = 0.0;
+                for (float v : window) mean += v;
+                mean /= window.size();
+                for (float v : window) squares += (v - mean) * (v - mean);
+                const double stdDev = std::sqrt(squares / window.size());
+                z = (value - mean) / std::max(stdDev, std::max(1e-6, mean * 1e-3));
+            }
+            contribution = weight * std::max(z, 0.0);
+            window.push_back(value);
+            if (window.size() > kWindow) window.pop_front();
+            pushedFrame = frame;
+        }
+
+        bool Live(uint64_t frame) const {
+            return scored && frame - pushedFrame <= kStale;
+        }
+    };
+
+    double ModelFused(const std::vector<ModelChannel>& channels, uint64_t frame) {
+        double contributions = 0.0, weights = 0.0;
+        for (const ModelChannel& channel : channels) {
+            if (!channel.Live(frame)) continue;
+            contributions += channel.contribution;
+            weights += channel.weight;
+        }
+        return weights > 0.0 ? contributions / weights : 0.0;
+    }
+
+    bool Near(double a, double b) {
+        return std::fabs(a - b) <= 1e-3 * (1.0 + std::fabs(b));
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t frames = 100000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    size_t errors = 0;
+    std::mt19937 rng(6);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+
+    // --- Never fed, warming up, stalled, back ---
+    {
+        SignalChannelBank bank(kWindow, kStale);
+        const uint32_t frameTime = bank.Register("frame_time", 2.0f);
+        const uint32_t cpu = bank.Register("cpu_load");         // never fed, as off Windows
+        const uint32_t gpu = bank.Register("ps_invocations");
+        errors += bank.Register("frame_time") != frameTime || bank.Find("cpu_load") != cpu;
+
+        // frame_time is steady then spikes; ps_invocations stays flat
+        auto frame = [&](bool feedGpu, float frameValue) {
+            bank.Advance();
+            bank.Push(frameTime, frameValue);
+            if (feedGpu) bank.Push(gpu, 1000.0f + noise(rng));
+        };
+        for (size_t i = 0; i < kMinSamples; ++i) frame(i + 1 < kMinSamples, 16.0f + 0.1f * noise(rng));
+
+        // Eight samples in, but the eighth had only seven to be scored against
+        errors += bank.IsLive(frameTime) || bank.FusedScore() != 0.0f;
+        frame(false, 16.0f + 0.1f * noise(rng));
+        errors += !bank.IsLive(frameTime) || bank.IsLive(cpu) || bank.IsLive(gpu);
+        for (size_t i = 0; i < kWindow; ++i) frame(true, 16.0f + 0.1f * noise(rng));
+
+        frame(true, 40.0f);
+        const float spike = bank.ZScore(frameTime);
+        const float gpuShare = std::max(bank.ZScore(gpu), 0.0f);
+        errors += !bank.IsLive(gpu) || bank.IsLive(cpu);
+        errors += !Near(bank.FusedScore(), (2.0 * spike + gpuShare) / 3.0);
+
+        // ps_invocations stops; it stays in for kStale frames, then drops out
+        size_t stillIn = 0;
+        for (uint32_t i = 0; i < kStale; ++i) {
+            frame(false, 16.0f + 0.1f * noise(rng));
+            stillIn += bank.IsLive(gpu);
+        }
+        errors += stillIn != kStale;
+        frame(false, 40.0f);
+        errors += bank.IsLive(gpu) || !Near(bank.FusedScore(), std::max(bank.ZScore(frameTime), 0.0f));
+
+        // Its next sample brings it back
+        frame(true, 16.0f);
+        errors += !bank.IsLive(gpu);
+        errors += !Near(bank.FusedScore(), (2.0 * std::max(bank.ZScore(frameTime), 0.0f) + std::max(bank.ZScore(gpu), 0.0f)) / 3.0);
+
+        bank.Clear();
+        errors += bank.IsLive(frameTime) || bank.IsLive(gpu) || bank.FusedScore() != 0.0f || bank.Count() != 3;
+        std::printf("lifecycle: never-fed and warming channels excluded, stalled channel out after %u frames and back on its next sample\n",
+            kStale);
+    }
+
+    // --- Random feeds and stalls against the model ---
+    {
+        const float weights[] = { 2.0f, 1.0f, 1.0f, 0.5f, 0.0f };
+        const float levels[] = { 16.0f, 3.0e5f, 1.0e6f, 0.4f, 7.0f };
+        const size_t channelCount = sizeof(weights) / sizeof(weights[0]);
+
+        SignalChannelBank bank(kWindow, kStale);
+        std::vector<ModelChannel> model(channelCount);
+        std::vector<uint32_t> ids;
+        for (size_t c = 0; c < channelCount; ++c) {
+            ids.push_back(bank.Register(("channel_" + std::to_string(c)).c_str(), weights[c]));
+            model[c].weight = weights[c];
+        }
+
+        // Each channel alternates runs of feeding and of stalling
+        std::vector<uint64_t> runLeft(channelCount, 0);
+        std::vector<bool> feeding(channelCount, true);
+        size_t mismatches = 0, liveMismatches = 0, staleFrames = 0, partialFrames = 0;
+        uint64_t frame = 0;
+
+        for (size_t f = 0; f < frames; ++f) {
+            bank.Advance();
+            ++frame;
+            for (size_t c = 0; c < channelCount; ++c) {
+                if (runLeft[c] == 0) {
+                    feeding[c] = rng() % 3 != 0;
+                    runLeft[c] = feeding[c] ? 1 + rng() % 200 : 1 + rng() % (3 * kStale);
+                }
+                --runLeft[c];
+                if (!feeding[c] || rng() % 4 == 0) continue;   // gaps within a run too
+
+                float value = levels[c] * (1.0f + 0.02f * noise(rng));
+                if (rng() % 50 == 0) value *= 2.0f;             // a spike now and then
+                bank.Push(ids[c], value);
+                model[c].Push(value, frame);
+            }
+
+            size_t live = 0;
+            for (size_t c = 0; c < channelCount; ++c) {
+                liveMismatches += bank.IsLive(ids[c]) != model[c].Live(frame);
+                live += model[c].Live(frame);
+                staleFrames += model[c].scored && !model[c].Live(frame);
+            }
+            partialFrames += live > 0 && live < channelCount;
+            mismatches += !Near(bank.FusedScore(), ModelFused(model, frame));
+        }
+
+        errors += mismatches + liveMismatches + (staleFrames == 0) + (partialFrames == 0);
+        std::printf("model: %zu frames, %zu channel-frames stale, %zu frames partly live, %zu score and %zu liveness mismatches\n",
+            frames, staleFrames, partialFrames, mismatches, liveMismatches);
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,212 @@
+// ====================================================================
+//                       quadraq_culling_bench.cpp
+//     TGDK Quantum GPU Accelerator — Culling Kernel Check
+//     Runs every kernel the CPU supports over random spheres against
+//     a double-precision reference, including ragged tail counts, and
+//     reports the cost per sphere at 100k bounds
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "CullingStage.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Spheres {
+        std::vector<float> x, y, z, r;
+
+        BoundsSoA View(size_t count) const {
+            return { count, x.data(), y.data(), z.data(), r.data() };
+        }
+    };
+
+    // Scattered around the camera, radii spanning sub-pixel to large
+    Spheres MakeSpheres(size_t count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> px(-200.0f, 200.0f), py(-20.0f, 50.0f), pz(-100.0f, 400.0f);
+        std::uniform_real_distribution<float> logR(std::log(0.01f), std::log(5.0f));
+        Spheres s;
+        for (size_t i = 0; i < count; ++i) {
+            s.x.push_back(px(rng));
+            s.y.push_back(py(rng));
+            s.z.push_back(pz(rng));
+            s.r.push_back(std::exp(logR(rng)));
+        }
+        return s;
+    }
+
+    // Row-vector view * perspective (left-handed, clip z in [0, w])
+    void MakeViewProjection(float out[16]) {
+        const double yaw = 0.3, eye[3] = { 0.0, 5.0, -20.0 };
+        const double c = std::cos(yaw), s = std::sin(yaw);
+        // World to view: translate by -eye, then undo the camera yaw
+        const double view[16] = {
+            c, 0, s, 0,
+            0, 1, 0, 0,
+            -s, 0, c, 0,
+            -(eye[0] * c - eye[2] * s), -eye[1], -(eye[0] * s + eye[2] * c), 1
+        };
+        const double nearZ = 0.1, farZ = 1000.0;
+        const double ys = 1.0 / std::tan(0.5 * 1.0472), xs = ys / (16.0 / 9.0);
+        const double q = farZ / (farZ - nearZ);
+        const double proj[16] = {
+            xs, 0, 0, 0,
+            0, ys, 0, 0,
+            0, 0, q, 1,
+            0, 0, -nearZ * q, 0
+        };
+        for (int row = 0; row < 4; ++row)
+            for (int col = 0; col < 4; ++col) {
+                double sum = 0.0;
+                for (int k = 0; k < 4; ++k) sum += view[row * 4 + k] * proj[k * 4 + col];
+                out[row * 4 + col] = static_cast<float>(sum);
+            }
+    }
+
+    // The same tests in double, with how close each sphere came to flipping
+    struct Reference {
+        double planes[6][4];
+        double wRow[4];
+        double sizeScale;
+        double minPixelSize;
+
+        Reference(const float m[16], double width, double height, double minPixels) : minPixelSize(minPixels) {
+            auto column = [m](int j, int row) { return static_cast<double>(m[row * 4 + j]); };
+            const int columns[6] = { 0, 0, 1, 1, 2, 2 };
+            const double signs[6] = { 1, -1, 1, -1, 1, -1 };
+            const double wWeights[6] = { 1, 1, 1, 1, 0, 1 };
+            for (int k = 0; k < 6; ++k) {
+                double plane[4];
+                for (int row = 0; row < 4; ++row)
+                    plane[row] = wWeights[k] * column(3, row) + signs[k] * column(columns[k], row);
+                const double length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+                for (int row = 0; row < 4; ++row) planes[k][row] = plane[row] / length;
+            }
+            for (int row = 0; row < 4; ++row) wRow[row] = column(3, row);
+            const double scaleX = std::sqrt(column(0, 0) * column(0, 0) + column(0, 1) * column(0, 1) + column(0, 2) * column(0, 2));
+            const double scaleY = std::sqrt(column(1, 0) * column(1, 0) + column(1, 1) * column(1, 1) + column(1, 2) * column(1, 2));
+            sizeScale = std::max(scaleX * width, scaleY * height);
+        }
+
+        // `margin` is the smallest relative distance to any decision edge
+        bool Visible(double x, double y, double z, double r, double& margin) const {
+            bool inside = true;
+            margin = 1e30;
+            for (const auto& p : planes) {
+                const double distance = p[0] * x + p[1] * y + p[2] * z + p[3] + r;
+                inside &= distance >= 0.0;
+                margin = std::min(margin, std::fabs(distance) / (1.0 + std::fabs(p[3]) + r));
+            }
+            const double w = wRow[0] * x + wRow[1] * y + wRow[2] * z + wRow[3];
+            const double sizeEdge = sizeScale * r - minPixelSize * w;
+            const bool small = w > r && sizeEdge < 0.0;
+            if (inside) {
+                margin = std::min(margin, std::fabs(w - r) / (1.0 + std::fabs(w)));
+                margin = std::min(margin, std::fabs(sizeEdge) / (1.0 + minPixelSize * std::fabs(w)));
+            }
+            return inside && !small;
+        }
+    };
+
+    const char* KernelName(CullKernel kernel) {
+        switch (kernel) {
+        case CullKernel::AVX2: return "avx2";
+        case CullKernel::SSE: return "sse";
+        default: return "scalar";
+        }
+    }
+
+    constexpr double kBorderline = 1e-5;
+}
+
+int main(int argc, char** argv) {
+    size_t count = 100000;
+    size_t frames = 50;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--bounds") == 0) count = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    std::mt19937 rng(14);
+    const Spheres spheres = MakeSpheres(count, rng);
+    float viewProjection[16];
+    MakeViewProjection(viewProjection);
+    const float width = 1920.0f, height = 1080.0f, minPixels = 2.0f;
+    const Reference reference(viewProjection, width, height, minPixels);
+
+    std::vector<uint8_t> expected(count);
+    std::vector<bool> borderline(count);
+    size_t expectedVisible = 0;
+    for (size_t i = 0; i < count; ++i) {
+        double margin;
+        expected[i] = reference.Visible(spheres.x[i], spheres.y[i], spheres.z[i], spheres.r[i], margin);
+        borderline[i] = margin < kBorderline;
+        expectedVisible += expected[i];
+    }
+
+    std::vector<CullKernel> kernels = { CullKernel::Scalar };
+    if (CullingStage::BestKernel() >= CullKernel::SSE) kernels.push_back(CullKernel::SSE);
+    if (CullingStage::BestKernel() >= CullKernel::AVX2) kernels.push_back(CullKernel::AVX2);
+
+    // Full runs plus counts that end mid-vector and mid-block
+    std::vector<size_t> sizes = { 1, 3, 7, 63, 64, 65, 129, 1005, count };
+    sizes.erase(std::remove_if(sizes.begin(), sizes.end(), [&](size_t n) { return n > count; }), sizes.end());
+
+    std::vector<uint64_t> mask((count + 63) / 64 + 1);
+    size_t errors = 0;
+    double scalarCost = 0.0;
+
+    std::printf("%8s | %8s %8s %8s %8s | %10s %7s\n", "kernel", "visible", "frustum", "small", "diffs", "ns/sphere", "speedup");
+    for (const CullKernel kernel : kernels) {
+        CullingStage stage;
+        stage.SetViewProjection(viewProjection, width, height);
+        stage.SetMinPixelSize(minPixels);
+        stage.ForceKernel(kernel);
+        errors += stage.Kernel() != kernel;
+
+        size_t borderlineDiffs = 0;
+        CullStats stats;
+        for (const size_t n : sizes) {
+            // Poison the word past the end: Cull must not write it
+            const size_t words = (n + 63) / 64;
+            std::fill(mask.begin(), mask.end(), 0xA5A5A5A5A5A5A5A5ull);
+            stats = stage.Cull(spheres.View(n), mask.data());
+
+            size_t visible = 0;
+            for (size_t i = 0; i < n; ++i) {
+                const bool got = (mask[i >> 6] >> (i & 63)) & 1;
+                visible += got;
+                if (got == bool(expected[i])) continue;
+                if (borderline[i]) ++borderlineDiffs;
+                else ++errors;
+            }
+            if (n & 63) errors += (mask[words - 1] >> (n & 63)) != 0;
+            errors += mask[words] != 0xA5A5A5A5A5A5A5A5ull;
+            errors += stats.tested != n || stats.Visible() != visible;
+        }
+
+        const Clock::time_point start = Clock::now();
+        for (size_t f = 0; f < frames; ++f) stage.Cull(spheres.View(count), mask.data());
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+            (static_cast<double>(count) * frames);
+        if (kernel == CullKernel::Scalar) scalarCost = ns;
+
+        std::printf("%8s | %8zu %8zu %8zu %8zu | %10.2f %6.1fx\n", KernelName(kernel), stats.Visible(),
+            stats.frustumCulled, stats.smallCulled, borderlineDiffs, ns, scalarCost / ns);
+    }
+    std::printf("reference visible: %zu of %zu\n", expectedVisible, count);
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
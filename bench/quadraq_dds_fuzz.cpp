@@ -0,0 +1,372 @@
+// ====================================================================
+//                          quadraq_dds_fuzz.cpp
+//     TGDK Quantum GPU Accelerator — DDS Reader Fuzzer
+//     LLVMFuzzerTestOneInput over DdsFile::OpenMemory, checking that a
+//     parse either fails cleanly or yields views that tile the pixel
+//     data inside the input. Standalone it generates a corpus of valid
+//     files (legacy / DX10, BC and uncompressed, mips, arrays, cubes,
+//     volumes), checks each parses as written and that one reopens
+//     from a non-ASCII wide path, times the parse, then
+//     runs a deterministic mutation loop over them. Built with
+//     -fsanitize=fuzzer -DQUADRAQ_LIBFUZZER the same entry point runs
+//     under libFuzzer; --corpus-out seeds it.
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "DdsFile.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    void Require(bool condition, const char* what) {
+        if (condition) return;
+        std::fprintf(stderr, "invariant violated: %s\n", what);
+        std::abort();
+    }
+
+    // Whatever OpenMemory returns, nothing may point outside the input
+    void CheckParse(const DdsFile& dds, bool opened, const uint8_t* data, size_t size) {
+        if (!opened) {
+            Require(!dds.IsOpen() && dds.SubresourceCount() == 0, "failed parse left views behind");
+            Require(!dds.Error().empty(), "failed parse without an error");
+            return;
+        }
+
+        const DdsInfo& info = dds.Info();
+        const size_t faces = info.cube ? 6 : 1;
+        Require(info.mipLevels >= 1 && info.arraySize >= 1, "empty mip chain or array");
+        Require(dds.SubresourceCount() == static_cast<size_t>(info.mipLevels) * info.arraySize * faces,
+            "subresource count");
+        Require(info.dimension == DdsDimension::Texture3D || info.depth == 1, "depth outside a volume");
+
+        const size_t headerEnd = 4 + DdsFormat::kHeaderSize + (info.legacyHeader ? 0 : DdsFormat::kDx10HeaderSize);
+        const uint8_t* expected = data + headerEnd;
+        size_t total = 0;
+
+        for (size_t i = 0; i < dds.SubresourceCount(); ++i) {
+            const DdsSubresource& view = dds.Subresources()[i];
+            const uint32_t mip = static_cast<uint32_t>(i % info.mipLevels);
+            const uint32_t slice = static_cast<uint32_t>(i / info.mipLevels);
+
+            Require(view.data == expected, "views do not tile the pixel data");
+            Require(view.data >= data && view.size <= size && view.data + view.size <= data + size,
+                "view outside the input");
+            Require(view.size == static_cast<size_t>(view.slicePitch) * view.depth, "size is not slicePitch x depth");
+            Require(view.rowPitch <= view.slicePitch, "row pitch above slice pitch");
+            Require(view.width == std::max(info.width >> mip, 1u) && view.height == std::max(info.height >> mip, 1u) &&
+                view.depth == std::max(info.depth >> mip, 1u), "mip dimensions");
+
+            const DdsSubresource looked = dds.Subresource(mip, slice);
+            Require(looked.data == view.data && looked.size == view.size, "Subresource() disagrees");
+
+            // Touch both ends so a sanitizer sees any overrun
+            if (view.size) {
+                volatile uint8_t first = view.data[0];
+                volatile uint8_t last = view.data[view.size - 1];
+                (void)first;
+                (void)last;
+            }
+            expected += view.size;
+            total += view.size;
+        }
+
+        Require(dds.DataSize() == total, "DataSize");
+        Require(!dds.Subresource(info.mipLevels, 0), "mip past the chain");
+        Require(!dds.Subresource(0, static_cast<uint32_t>(info.arraySize * faces)), "slice past the array");
+    }
+
+    // --- Corpus ---
+
+    void PutLE32(std::vector<uint8_t>& bytes, size_t offset, uint32_t value) {
+        for (int i = 0; i < 4; ++i) bytes[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    constexpr uint32_t FourCC(const char (&code)[5]) {
+        return static_cast<uint32_t>(static_cast<uint8_t>(code[0])) | (static_cast<uint32_t>(static_cast<uint8_t>(code[1])) << 8) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(code[2])) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(code[3])) << 24);
+    }
+
+    struct Layout {
+        uint32_t bitsPerPixel;      // 0 for block-compressed
+        uint32_t blockBytes;
+    };
+
+    struct Sample {
+        const char* name;
+        uint32_t width, height, depth, mips, arraySize;
+        bool cube;
+        Layout layout;
+        // Legacy pixel format, or DX10 when `dxgiFormat` is set
+        uint32_t pfFlags, fourCC, bitCount, masks[4];
+        uint32_t dxgiFormat, dimension;     // dimension: 2 = 1D, 3 = 2D, 4 = 3D
+        size_t trailing;                    // bytes after the pixel data
+    };
+
+    constexpr uint32_t kFourCCFlag = 0x4, kRgb = 0x40, kAlphaPixels = 0x1, kAlpha = 0x2, kLuminance = 0x20000, kBump = 0x80000;
+
+    const Sample kSamples[] = {
+        { "dxt1_mips",      256, 128, 1, 9, 1, false, { 0, 8 },   kFourCCFlag, FourCC("DXT1"), 0, {}, 0, 0, 0 },
+        { "dxt1_odd",       13, 7, 1, 4, 1, false, { 0, 8 },      kFourCCFlag, FourCC("DXT1"), 0, {}, 0, 0, 0 },
+        { "dxt3",           64, 64, 1, 1, 1, false, { 0, 16 },    kFourCCFlag, FourCC("DXT3"), 0, {}, 0, 0, 0 },
+        { "dxt5_trailing",  32, 16, 1, 6, 1, false, { 0, 16 },    kFourCCFlag, FourCC("DXT5"), 0, {}, 0, 0, 37 },
+        { "ati2",           128, 128, 1, 8, 1, false, { 0, 16 },  kFourCCFlag, FourCC("ATI2"), 0, {}, 0, 0, 0 },
+        { "bc4u",           8, 8, 1, 4, 1, false, { 0, 8 },       kFourCCFlag, FourCC("BC4U"), 0, {}, 0, 0, 0 },
+        { "rgbg",           15, 4, 1, 1, 1, false, { 0, 0 },      kFourCCFlag, FourCC("RGBG"), 0, {}, 0, 0, 0 },
+        { "d3dfmt_f16x4",   16, 16, 1, 5, 1, false, { 64, 0 },    kFourCCFlag, 113, 0, {}, 0, 0, 0 },
+        { "rgba8",          100, 60, 1, 7, 1, false, { 32, 0 },   kRgb | kAlphaPixels, 0, 32, { 0xFF, 0xFF00, 0xFF0000, 0xFF000000 }, 0, 0, 0 },
+        { "bgrx8",          7, 3, 1, 3, 1, false, { 32, 0 },      kRgb, 0, 32, { 0xFF0000, 0xFF00, 0xFF, 0 }, 0, 0, 0 },
+        { "b5g6r5",         33, 17, 1, 6, 1, false, { 16, 0 },    kRgb, 0, 16, { 0xF800, 0x7E0, 0x1F, 0 }, 0, 0, 0 },
+        { "l8",             64, 1, 1, 7, 1, false, { 8, 0 },      kLuminance, 0, 8, { 0xFF, 0, 0, 0 }, 0, 0, 0 },
+        { "a8",             9, 9, 1, 1, 1, false, { 8, 0 },       kAlpha, 0, 8, {}, 0, 0, 0 },
+        { "v8u8",           16, 8, 1, 2, 1, false, { 16, 0 },     kBump, 0, 16, { 0xFF, 0xFF00, 0, 0 }, 0, 0, 0 },
+        { "legacy_cube",    32, 32, 1, 6, 1, true, { 0, 8 },      kFourCCFlag, FourCC("DXT1"), 0, {}, 0, 0, 0 },
+        { "legacy_volume",  16, 8, 4, 5, 1, false, { 32, 0 },     kRgb | kAlphaPixels, 0, 32, { 0xFF0000, 0xFF00, 0xFF, 0xFF000000 }, 0, 0, 0 },
+        { "dx10_bc7_mips",  512, 256, 1, 10, 1, false, { 0, 16 }, kFourCCFlag, FourCC("DX10"), 0, {}, 98, 3, 0 },
+        { "dx10_bc6h_cubes", 64, 64, 1, 7, 3, true, { 0, 16 },    kFourCCFlag, FourCC("DX10"), 0, {}, 95, 3, 0 },
+        { "dx10_bc1_array", 20, 12, 1, 3, 5, false, { 0, 8 },     kFourCCFlag, FourCC("DX10"), 0, {}, 72, 3, 0 },
+        { "dx10_rgba16_3d", 8, 8, 8, 4, 1, false, { 64, 0 },      kFourCCFlag, FourCC("DX10"), 0, {}, 10, 4, 0 },
+        { "dx10_rgb32_1d",  100, 1, 1, 7, 4, false, { 96, 0 },    kFourCCFlag, FourCC("DX10"), 0, {}, 6, 2, 0 },
+        { "dx10_r1",        30, 5, 1, 1, 1, false, { 1, 0 },      kFourCCFlag, FourCC("DX10"), 0, {}, 66, 3, 0 },
+        { "dx10_r8_1x1",    1, 1, 1, 1, 1, false, { 8, 0 },       kFourCCFlag, FourCC("DX10"), 0, {}, 61, 3, 11 },
+        { "dx10_b4g4r4a4",  3, 5, 1, 3, 2, false, { 16, 0 },      kFourCCFlag, FourCC("DX10"), 0, {}, 115, 3, 0 },
+    };
+
+    size_t SubresourceBytes(const Sample& s, uint32_t width, uint32_t height, uint32_t depth) {
+        const bool packed = s.fourCC == FourCC("RGBG");
+        if (packed) return static_cast<size_t>((width + 1) / 2) * 4 * height * depth;
+        if (s.layout.blockBytes)
+            return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * s.layout.blockBytes * depth;
+        return (static_cast<size_t>(width) * s.layout.bitsPerPixel + 7) / 8 * height * depth;
+    }
+
+    size_t PixelBytes(const Sample& s) {
+        size_t bytes = 0;
+        const uint32_t slices = s.arraySize * (s.cube ? 6 : 1);
+        for (uint32_t slice = 0; slice < slices; ++slice)
+            for (uint32_t mip = 0; mip < s.mips; ++mip)
+                bytes += SubresourceBytes(s, std::max(s.width >> mip, 1u), std::max(s.height >> mip, 1u), std::max(s.depth >> mip, 1u));
+        return bytes;
+    }
+
+    std::vector<uint8_t> Write(const Sample& s) {
+        const bool dx10 = s.dxgiFormat != 0;
+        const size_t headerEnd = 4 + DdsFormat::kHeaderSize + (dx10 ? DdsFormat::kDx10HeaderSize : 0);
+        std::vector<uint8_t> bytes(headerEnd + PixelBytes(s) + s.trailing);
+
+        std::memcpy(bytes.data(), "DDS ", 4);
+        const bool volume = s.depth > 1 || s.dimension == 4;
+        PutLE32(bytes, 4, DdsFormat::kHeaderSize);
+        PutLE32(bytes, 8, 0x1 | 0x2 | 0x4 | 0x1000 | (s.mips > 1 ? 0x20000 : 0) | (volume ? 0x800000 : 0));
+        PutLE32(bytes, 12, s.height);
+        PutLE32(bytes, 16, s.width);
+        PutLE32(bytes, 24, volume ? s.depth : 0);
+        PutLE32(bytes, 28, s.mips);
+        PutLE32(bytes, 76, DdsFormat::kPixelFormatSize);
+        PutLE32(bytes, 80, s.pfFlags);
+        PutLE32(bytes, 84, s.fourCC);
+        PutLE32(bytes, 88, s.bitCount);
+        for (int i = 0; i < 4; ++i) PutLE32(bytes, 92 + 4 * i, s.masks[i]);
+        PutLE32(bytes, 108, 0x1000 | (s.mips > 1 ? 0x400008 : 0));
+        PutLE32(bytes, 112, (s.cube && !dx10 ? 0xFE00 : 0) | (volume && !dx10 ? 0x200000 : 0));
+
+        if (dx10) {
+            PutLE32(bytes, 128, s.dxgiFormat);
+            PutLE32(bytes, 132, s.dimension);
+            PutLE32(bytes, 136, s.cube ? 0x4 : 0);
+            PutLE32(bytes, 140, s.arraySize);
+        }
+
+        for (size_t i = headerEnd; i < bytes.size(); ++i) bytes[i] = static_cast<uint8_t>(i * 131);
+        return bytes;
+    }
+
+    // --- Mutations ---
+
+    // File offsets of the fields the parser reads
+    constexpr size_t kFieldOffsets[] = { 4, 8, 12, 16, 24, 28, 76, 80, 84, 88, 92, 96, 100, 104, 112, 128, 132, 136, 140 };
+    constexpr uint32_t kInteresting[] = { 0, 1, 2, 3, 4, 5, 6, 7, 15, 16, 124, 2048, 2049, 16384, 16385,
+        0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0xFFFFFFFE, 0xFC00, 0x200, 0x800000, FourCC("DX10"), FourCC("DXT1") };
+
+    void Mutate(std::vector<uint8_t>& bytes, std::mt19937& rng) {
+        const int steps = 1 + static_cast<int>(rng() % 3);
+        for (int step = 0; step < steps; ++step) {
+            switch (rng() % 6) {
+            case 0:     // bit flips anywhere
+                for (uint32_t n = 1 + rng() % 8; n > 0 && !bytes.empty(); --n)
+                    bytes[rng() % bytes.size()] ^= static_cast<uint8_t>(1u << (rng() % 8));
+                break;
+            case 1:     // interesting value into a header field
+            case 2: {
+                const size_t offset = kFieldOffsets[rng() % (sizeof(kFieldOffsets) / sizeof(kFieldOffsets[0]))];
+                if (offset + 4 > bytes.size()) break;
+                const uint32_t value = rng() % 4 == 0 ? static_cast<uint32_t>(rng())
+                    : kInteresting[rng() % (sizeof(kInteresting) / sizeof(kInteresting[0]))];
+                PutLE32(bytes, offset, value);
+                break;
+            }
+            case 3:     // DX10 format anywhere in the DXGI range
+                if (bytes.size() >= 132) PutLE32(bytes, 128, rng() % 135);
+                break;
+            case 4:     // truncate
+                if (!bytes.empty()) bytes.resize(rng() % (bytes.size() + 1));
+                break;
+            case 5:     // extend with noise
+                for (uint32_t n = rng() % 64; n > 0; --n) bytes.push_back(static_cast<uint8_t>(rng()));
+                break;
+            }
+        }
+    }
+
+    bool WriteFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) return false;
+        const bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+        return std::fclose(file) == 0 && written;
+    }
+
+    std::vector<uint8_t> ReadFile(const char* path) {
+        std::vector<uint8_t> bytes;
+        if (FILE* file = std::fopen(path, "rb")) {
+            uint8_t buffer[4096];
+            for (size_t n; (n = std::fread(buffer, 1, sizeof(buffer), file)) > 0;) bytes.insert(bytes.end(), buffer, buffer + n);
+            std::fclose(file);
+        }
+        return bytes;
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    DdsFile dds;
+    const bool opened = dds.OpenMemory(data, size);
+    CheckParse(dds, opened, data, size);
+    return 0;
+}
+
+#ifndef QUADRAQ_LIBFUZZER
+int main(int argc, char** argv) {
+    size_t iterations = 200000;
+    uint32_t seed = 25;
+    std::string corpusOut;
+    std::vector<const char*> replay;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) iterations = std::strtoul(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--corpus-out") == 0 && i + 1 < argc) corpusOut = argv[++i];
+        else replay.push_back(argv[i]);
+    }
+
+    // Reproduce saved inputs, e.g. libFuzzer crash files
+    if (!replay.empty()) {
+        for (const char* path : replay) {
+            const std::vector<uint8_t> bytes = ReadFile(path);
+            LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+            std::printf("%s: ok\n", path);
+        }
+        return 0;
+    }
+
+    size_t errors = 0;
+    std::vector<std::vector<uint8_t>> corpus;
+    for (const Sample& sample : kSamples) {
+        corpus.push_back(Write(sample));
+        const std::vector<uint8_t>& bytes = corpus.back();
+
+        DdsFile dds;
+        const bool opened = dds.OpenMemory(bytes.data(), bytes.size());
+        CheckParse(dds, opened, bytes.data(), bytes.size());
+        const DdsInfo& info = dds.Info();
+        const bool matches = opened && info.width == sample.width && info.height == std::max(sample.height, 1u) &&
+            info.depth == sample.depth && info.mipLevels == sample.mips && info.arraySize == sample.arraySize &&
+            info.cube == sample.cube && info.legacyHeader == (sample.dxgiFormat == 0) &&
+            (sample.dxgiFormat == 0 || info.format == sample.dxgiFormat) && dds.DataSize() == PixelBytes(sample);
+        if (!matches) {
+            std::printf("%-16s does not parse as written: %s\n", sample.name, opened ? "wrong layout" : dds.Error().c_str());
+            ++errors;
+        }
+
+        // Through the mapping as well
+        if (!corpusOut.empty()) {
+            const std::string path = corpusOut + "/" + sample.name + ".dds";
+            DdsFile mapped;
+            if (!WriteFile(path, bytes) || !mapped.Open(path) || mapped.DataSize() != dds.DataSize() ||
+                mapped.SubresourceCount() != dds.SubresourceCount()) {
+                std::printf("%-16s does not reopen from %s\n", sample.name, path.c_str());
+                ++errors;
+            }
+        }
+    }
+
+    // Wide paths keep their non-ASCII characters: UTF-8 conversion, then a
+    // file written under such a name reopened through the wide overload
+    {
+        errors += WidePathToUtf8(L"a\u00e9\u4e2d") != "a\xC3\xA9\xE4\xB8\xAD";
+        errors += WidePathToUtf8(L"\U0001F600") != "\xF0\x9F\x98\x80";
+        const std::wstring wide = L"quadraq_dds_\u00e9\u4e2d\U0001F600.dds";
+        const std::string narrow = WidePathToUtf8(wide);
+        DdsFile dds;
+        const bool reopened = WriteFile(narrow, corpus.front()) && dds.Open(wide) &&
+            dds.DataSize() == PixelBytes(kSamples[0]);
+        std::remove(narrow.c_str());
+        if (!reopened) {
+            std::printf("wide path does not reopen: %s\n", dds.Error().c_str());
+            ++errors;
+        }
+    }
+
+    // Parse cost against what a read-into-heap loader pays to copy the file
+    size_t corpusBytes = 0;
+    for (const auto& bytes : corpus) corpusBytes += bytes.size();
+    const size_t rounds = 2000;
+    DdsFile timed;
+    Clock::time_point start = Clock::now();
+    for (size_t r = 0; r < rounds; ++r)
+        for (const auto& bytes : corpus) timed.OpenMemory(bytes.data(), bytes.size());
+    const double parseNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (rounds * corpus.size());
+    std::vector<uint8_t> copy;
+    volatile uint8_t sink = 0;
+    start = Clock::now();
+    for (size_t r = 0; r < rounds / 10; ++r)
+        for (const auto& bytes : corpus) {
+            copy.assign(bytes.begin(), bytes.end());
+            sink = copy[copy.size() / 2];
+        }
+    (void)sink;
+    const double copyNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (rounds / 10 * corpus.size());
+
+    // Mutation loop; inputs get exact-size buffers so overruns leave them
+    std::mt19937 rng(seed);
+    size_t accepted = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        std::vector<uint8_t> input = corpus[rng() % corpus.size()];
+        Mutate(input, rng);
+        input.shrink_to_fit();
+
+        DdsFile dds;
+        const bool opened = dds.OpenMemory(input.data(), input.size());
+        CheckParse(dds, opened, input.data(), input.size());
+        accepted += opened;
+    }
+    const double fuzzSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("%zu corpus files (%zu KiB): parse %.0f ns per file, heap copy %.0f ns per file\n",
+        corpus.size(), corpusBytes / 1024, parseNs, copyNs);
+    std::printf("%zu mutated inputs (seed %u), %zu still valid, %.0f inputs/s, no invariant violated\n",
+        iterations, seed, accepted, iterations / fuzzSeconds);
+
+    if (errors) std::printf("FAIL: %zu corpus files misparsed\n", errors);
+    return errors ? 1 : 0;
+}
+#endif
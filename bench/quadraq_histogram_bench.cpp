@@ -0,0 +1,147 @@
+// ====================================================================
+//                      quadraq_histogram_bench.cpp
+//     TGDK Quantum GPU Accelerator — Frame-Time Percentile Check
+//     The 1 s, 1 min and session histograms EntropyPredictor keeps,
+//     against the exact percentiles of the samples each should still
+//     hold: frames at 60 fps with stutters, hitches that roll one slice,
+//     several, or the whole window, and values past the clamp
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "FrameTimeHistogram.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Sample {
+        uint32_t micros;
+        uint64_t slice;     // index of the slice its end falls in, counted from the start
+    };
+
+    const double kQuantiles[] = { 0.0, 0.5, 0.95, 0.99, 0.999, 1.0 };
+
+    // The sample at the rank Quantile() reports, clamped as recorded
+    uint32_t ReferenceQuantile(std::vector<uint32_t>& values, double q) {
+        uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(values.size()) + 0.5);
+        if (rank == 0) rank = 1;
+        std::nth_element(values.begin(), values.begin() + (rank - 1), values.end());
+        return std::min(values[rank - 1], FrameTimeHistogram::kMaxMicros);
+    }
+
+    // Checks one histogram against the samples in `window`; returns the errors
+    size_t Compare(const FrameTimeHistogram& histogram, const std::vector<uint32_t>& window, double& worstRelative) {
+        size_t errors = histogram.Count() != window.size();
+        if (window.empty()) return errors + (histogram.Quantile(0.5) != 0);
+
+        std::vector<uint32_t> values = window;
+        for (double q : kQuantiles) {
+            const uint32_t truth = ReferenceQuantile(values, q);
+            const uint32_t reported = histogram.Quantile(q);
+            errors += FrameTimeHistogram::BucketIndex(reported) != FrameTimeHistogram::BucketIndex(truth);
+
+            // A bucket's midpoint: exact below 32 us, within 1/64 above
+            const double relative = truth ? std::abs(static_cast<double>(reported) - truth) / truth : 0.0;
+            errors += truth < FrameTimeHistogram::kSubBuckets ? reported != truth : relative > 0.5 / FrameTimeHistogram::kSubBuckets;
+            worstRelative = std::max(worstRelative, relative);
+        }
+        return errors;
+    }
+
+    uint32_t NextFrame(std::mt19937& rng) {
+        const uint32_t roll = rng() % 10000;
+        if (roll < 9000) return 16667 - 500 + rng() % 1000;            // 60 fps
+        if (roll < 9700) return 5000 + rng() % 45000;                   // stutter
+        if (roll < 9800) return rng() % 32;                             // the exact buckets
+        if (roll < 9950) return 100000 + rng() % 400000;                // a slice or a few of the 1 s window
+        if (roll < 9990) return 1000000 + rng() % 9000000;              // all of it
+        if (roll < 9998) return 20000000 + rng() % 10000000;            // past the clamp
+        return 61000000 + rng() % 60000000;                             // all of the 1 min window
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t frames = 200000;
+    size_t checkEvery = 97;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--check-every") == 0) checkEvery = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+    if (checkEvery == 0) checkEvery = 1;
+
+    // Same horizons as EntropyPredictor
+    constexpr size_t kSecondSlices = 10, kMinuteSlices = 12;
+    constexpr uint64_t kSecondSlice = 100000, kMinuteSlice = 5000000;
+    WindowedFrameTimeHistogram<kSecondSlices> lastSecond(kSecondSlice);
+    WindowedFrameTimeHistogram<kMinuteSlices> lastMinute(kMinuteSlice);
+    FrameTimeHistogram session;
+
+    std::mt19937 rng(3);
+    std::vector<uint32_t> all;
+    std::vector<Sample> seconds, minutes;
+    uint64_t elapsed = 0;
+    size_t errors = 0, checks = 0, secondRollovers = 0, minuteRollovers = 0;
+    double worstSecond = 0.0, worstMinute = 0.0, worstSession = 0.0;
+    double recordSeconds = 0.0;
+
+    for (size_t frame = 0; frame < frames; ++frame) {
+        const uint32_t micros = NextFrame(rng);
+        elapsed += micros;
+
+        const Clock::time_point start = Clock::now();
+        lastSecond.Record(micros);
+        lastMinute.Record(micros);
+        session.Record(micros);
+        recordSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+        // A sample belongs to the slice its frame ends in; a window holds
+        // the current slice and the ones before it, Slices in all
+        const uint64_t secondSlice = elapsed / kSecondSlice, minuteSlice = elapsed / kMinuteSlice;
+        secondRollovers += !seconds.empty() && seconds.back().slice != secondSlice;
+        minuteRollovers += !minutes.empty() && minutes.back().slice != minuteSlice;
+        seconds.push_back({ micros, secondSlice });
+        minutes.push_back({ micros, minuteSlice });
+        all.push_back(micros);
+
+        if (frame % checkEvery != 0 && frame + 1 != frames) continue;
+
+        auto inWindow = [](std::vector<Sample>& samples, uint64_t current, size_t slices) {
+            samples.erase(std::remove_if(samples.begin(), samples.end(),
+                [&](const Sample& s) { return s.slice + slices <= current; }), samples.end());
+            std::vector<uint32_t> values;
+            for (const Sample& s : samples) values.push_back(s.micros);
+            return values;
+        };
+        errors += Compare(lastSecond.Aggregate(), inWindow(seconds, secondSlice, kSecondSlices), worstSecond);
+        errors += Compare(lastMinute.Aggregate(), inWindow(minutes, minuteSlice, kMinuteSlices), worstMinute);
+        errors += Compare(session, all, worstSession);
+        ++checks;
+    }
+
+    std::printf("%zu frames, %.1f s of rendered time, %zu checks of %zu quantiles, %.1f ns per frame recorded\n",
+        frames, elapsed * 1e-6, checks, sizeof(kQuantiles) / sizeof(kQuantiles[0]), recordSeconds * 1e9 / frames);
+    std::printf("1 s     %5zu slice rollovers, worst error %.2f%%\n", secondRollovers, worstSecond * 100.0);
+    std::printf("1 min   %5zu slice rollovers, worst error %.2f%%\n", minuteRollovers, worstMinute * 100.0);
+    std::printf("session             worst error %.2f%%\n", worstSession * 100.0);
+
+    // Clear() empties a window, and it fills again from the next frame
+    lastSecond.Clear();
+    errors += lastSecond.Aggregate().Count() != 0 || lastSecond.Aggregate().Quantile(0.99) != 0;
+    lastSecond.Record(16667);
+    errors += lastSecond.Aggregate().Count() != 1 ||
+              FrameTimeHistogram::BucketIndex(lastSecond.Aggregate().Quantile(0.5)) != FrameTimeHistogram::BucketIndex(16667);
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+// ====================================================================
+//                      quadraq_occlusion_bench.cpp
+//     TGDK Quantum GPU Accelerator — Software Occlusion Check
+//     Synthetic scenes with an exact answer: spheres behind a wall,
+//     in front of it, beside it and behind a window in it. Nothing
+//     visible may be hidden; most of what is hidden should be. Also
+//     checks near-plane rejection, worker-count independence and
+//     reports rasterize / test cost
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "OcclusionRasterizer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Camera at the origin looking down +z, 60 degree vertical fov
+    constexpr float kAspect = 320.0f / 192.0f;
+
+    void MakeProjection(float out[16]) {
+        const float nearZ = 0.5f, farZ = 1000.0f;
+        const float ys = 1.0f / std::tan(0.5f * 1.0472f), xs = ys / kAspect;
+        const float q = farZ / (farZ - nearZ);
+        const float m[16] = {
+            xs, 0, 0, 0,
+            0, ys, 0, 0,
+            0, 0, q, 1,
+            0, 0, -nearZ * q, 0
+        };
+        std::copy(m, m + 16, out);
+    }
+
+    struct Mesh {
+        std::vector<float> positions;
+        std::vector<uint32_t> indices;
+
+        void AddQuad(float x0, float y0, float x1, float y1, float z) {
+            const uint32_t base = static_cast<uint32_t>(positions.size() / 3);
+            const float corners[12] = { x0, y0, z, x1, y0, z, x1, y1, z, x0, y1, z };
+            positions.insert(positions.end(), corners, corners + 12);
+            const uint32_t quad[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+    };
+
+    // Wall in the plane z = `depth` over [-halfX, halfX] x [-halfY, halfY],
+    // tessellated into cells; `window` cells around the middle are left out.
+    Mesh MakeWall(float halfX, float halfY, float depth, int cells, int window) {
+        Mesh wall;
+        const int hole0 = (cells - window) / 2, hole1 = hole0 + window;
+        for (int j = 0; j < cells; ++j)
+            for (int i = 0; i < cells; ++i) {
+                if (i >= hole0 && i < hole1 && j >= hole0 && j < hole1) continue;
+                const float x0 = -halfX + 2.0f * halfX * i / cells, x1 = -halfX + 2.0f * halfX * (i + 1) / cells;
+                const float y0 = -halfY + 2.0f * halfY * j / cells, y1 = -halfY + 2.0f * halfY * (j + 1) / cells;
+                wall.AddQuad(x0, y0, x1, y1, depth);
+            }
+        return wall;
+    }
+
+    // Signed distance inside the pyramid from the origin through
+    // [-halfX, halfX] x [-halfY, halfY] at z = depth (negative = outside)
+    float InsidePyramid(float x, float y, float z, float halfX, float halfY, float depth) {
+        const float lx = std::sqrt(depth * depth + halfX * halfX);
+        const float ly = std::sqrt(depth * depth + halfY * halfY);
+        const float sideX = (halfX * z - depth * std::fabs(x)) / lx;
+        const float sideY = (halfY * z - depth * std::fabs(y)) / ly;
+        return std::min(sideX, sideY);
+    }
+
+    struct Spheres {
+        std::vector<float> x, y, z, r;
+        BoundsSoA View() const { return { x.size(), x.data(), y.data(), z.data(), r.data() }; }
+        void Add(float px, float py, float pz, float pr) { x.push_back(px); y.push_back(py); z.push_back(pz); r.push_back(pr); }
+    };
+
+    std::vector<uint64_t> AllVisible(size_t count) {
+        std::vector<uint64_t> mask((count + 63) / 64, ~0ull);
+        if (count & 63) mask.back() = (1ull << (count & 63)) - 1;
+        return mask;
+    }
+
+    bool Bit(const std::vector<uint64_t>& mask, size_t i) { return (mask[i >> 6] >> (i & 63)) & 1; }
+}
+
+int main(int argc, char** argv) {
+    size_t count = 100000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--spheres") == 0) count = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    float projection[16];
+    MakeProjection(projection);
+    const float wallX = 30.0f, wallY = 20.0f, wallZ = 50.0f;
+    size_t errors = 0;
+
+    OcclusionRasterizer rasterizer(320, 192);
+
+    // --- Solid wall: random spheres with an exact answer ---
+    {
+        const Mesh wall = MakeWall(wallX, wallY, wallZ, 8, 0);
+        rasterizer.BeginFrame(projection);
+        rasterizer.AddOccluder(wall.positions.data(), wall.positions.size() / 3, wall.indices.data(), wall.indices.size() / 3);
+        rasterizer.Rasterize();
+
+        std::mt19937 rng(15);
+        std::uniform_real_distribution<float> px(-60.0f, 60.0f), py(-40.0f, 40.0f), pz(2.0f, 300.0f);
+        std::uniform_real_distribution<float> pr(0.1f, 4.0f);
+        Spheres spheres;
+        for (size_t i = 0; i < count; ++i) spheres.Add(px(rng), py(rng), pz(rng), pr(rng));
+
+        std::vector<uint64_t> mask = AllVisible(count);
+        const Clock::time_point start = Clock::now();
+        const OcclusionStats stats = rasterizer.TestSpheres(spheres.View(), mask.data());
+        const double testNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / count;
+
+        // Hidden exactly when the sphere lies inside the wall's pyramid and
+        // wholly past the wall; "deep" leaves a few blocks of slack
+        size_t truthHidden = 0, deep = 0, deepFound = 0, wrongHides = 0, inFront = 0, beside = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const float inside = InsidePyramid(spheres.x[i], spheres.y[i], spheres.z[i], wallX, wallY, wallZ);
+            const bool hidden = inside >= spheres.r[i] && spheres.z[i] - spheres.r[i] > wallZ;
+            const bool visible = Bit(mask, i);
+            truthHidden += hidden;
+            wrongHides += !hidden && !visible;
+            inFront += spheres.z[i] + spheres.r[i] < wallZ;
+            beside += inside < -spheres.r[i];
+            if (hidden && inside >= spheres.r[i] + 0.1f * spheres.z[i] && spheres.z[i] - spheres.r[i] > wallZ + 1.0f) {
+                ++deep;
+                deepFound += !visible;
+            }
+        }
+        errors += wrongHides;
+        errors += deepFound < deep;
+        errors += stats.tested != count;
+
+        std::printf("wall: %zu spheres (%zu in front, %zu beside), %zu truly hidden\n", count, inFront, beside, truthHidden);
+        std::printf("      hidden %zu (%.1f%% of truly hidden), deep %zu/%zu, visible wrongly hidden %zu, %.1f ns per sphere\n",
+            stats.occluded, 100.0 * stats.occluded / std::max<size_t>(truthHidden, 1), deepFound, deep, wrongHides, testNs);
+    }
+
+    // --- Wall with a window: what is seen through it stays visible ---
+    {
+        const Mesh wall = MakeWall(wallX, wallY, wallZ, 8, 2);
+        rasterizer.BeginFrame(projection);
+        rasterizer.AddOccluder(wall.positions.data(), wall.positions.size() / 3, wall.indices.data(), wall.indices.size() / 3);
+        rasterizer.Rasterize();
+
+        // The window spans the middle quarter of each axis
+        const float windowX = wallX / 4.0f, windowY = wallY / 4.0f;
+        std::mt19937 rng(16);
+        std::uniform_real_distribution<float> unit(-0.9f, 0.9f), pz(60.0f, 300.0f);
+        Spheres spheres;
+        for (size_t i = 0; i < 2000; ++i) {
+            const float z = pz(rng);
+            spheres.Add(unit(rng) * windowX * z / wallZ, unit(rng) * windowY * z / wallZ, z, 0.5f);
+        }
+        std::vector<uint64_t> mask = AllVisible(spheres.x.size());
+        const OcclusionStats stats = rasterizer.TestSpheres(spheres.View(), mask.data());
+        errors += stats.occluded;
+        std::printf("window: %zu spheres behind the opening, %zu hidden\n", spheres.x.size(), stats.occluded);
+    }
+
+    // --- Occluders crossing the near plane are dropped ---
+    {
+        Mesh mesh;
+        const float positions[9] = { -5.0f, -5.0f, -1.0f, 5.0f, -5.0f, 20.0f, 0.0f, 5.0f, 20.0f };
+        mesh.positions.assign(positions, positions + 9);
+        mesh.indices = { 0, 1, 2 };
+        rasterizer.BeginFrame(projection);
+        rasterizer.AddOccluder(mesh.positions.data(), 3, mesh.indices.data(), 1);
+        rasterizer.Rasterize();
+        errors += rasterizer.Stats().occluderTriangles != 1 || rasterizer.Stats().binnedTriangles != 0;
+        const float* depth = rasterizer.Depth();
+        errors += std::any_of(depth, depth + rasterizer.Width() * rasterizer.Height(), [](float d) { return d != 1.0f; });
+    }
+
+    // --- Same depth whatever the worker count; rasterize cost ---
+    {
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<float> px(-80.0f, 80.0f), py(-50.0f, 50.0f), pz(10.0f, 200.0f), size(0.5f, 8.0f);
+        Mesh soup;
+        for (int t = 0; t < 4000; ++t) {
+            const float cx = px(rng), cy = py(rng), cz = pz(rng), s = size(rng);
+            const uint32_t base = static_cast<uint32_t>(soup.positions.size() / 3);
+            const float v[9] = { cx, cy, cz, cx + s, cy + s * 0.3f, cz + s * 0.5f, cx - s * 0.2f, cy + s, cz - s * 0.5f };
+            soup.positions.insert(soup.positions.end(), v, v + 9);
+            soup.indices.insert(soup.indices.end(), { base, base + 1, base + 2 });
+        }
+
+        OcclusionRasterizer single(320, 192, 1);
+        OcclusionRasterizer pooled(320, 192, 3);
+        double ms[2] = {};
+        OcclusionRasterizer* instances[2] = { &single, &pooled };
+        for (int k = 0; k < 2; ++k) {
+            const Clock::time_point start = Clock::now();
+            for (int frame = 0; frame < 20; ++frame) {
+                instances[k]->BeginFrame(projection);
+                instances[k]->AddOccluder(soup.positions.data(), soup.positions.size() / 3, soup.indices.data(), soup.indices.size() / 3);
+                instances[k]->Rasterize();
+            }
+            ms[k] = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / 20;
+        }
+        const size_t pixels = static_cast<size_t>(single.Width()) * single.Height();
+        errors += !std::equal(single.Depth(), single.Depth() + pixels, pooled.Depth());
+        std::printf("soup: %zu of 4000 triangles binned; rasterize %.3f ms (1 worker), %.3f ms (3 workers)\n",
+            single.Stats().binnedTriangles, ms[0], ms[1]);
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,153 @@
+// ====================================================================
+//                      quadraq_overload_bench.cpp
+//     TGDK Quantum GPU Accelerator — Forecast & Overload Check
+//     Synthetic frame-time traces through EntropyPredictor on a
+//     virtual clock: hysteresis against a bare threshold, reaction to
+//     steps, and how much earlier the forecast flags a ramp
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "EntropyPredictor.hpp"
+#include "FrameClock.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+    struct RunResult {
+        std::vector<bool> overloaded;   // per frame, after its UpdateCycle()
+        uint32_t transitions = 0;
+        double forecastError = 0.0;     // mean |PredictNextFrameTime() - next frame|
+        double holdError = 0.0;         // same for "next frame = this frame"
+    };
+
+    RunResult Run(const std::vector<float>& frameTimes, bool forecasting) {
+        EntropyPredictor::Initialize();
+        EntropyPredictor::SetEnabled(true);
+        EntropyPredictor::SetForecastingEnabled(forecasting);
+
+        RunResult result;
+        bool last = false;
+        float predicted = 0.0f;
+        for (size_t i = 0; i < frameTimes.size(); ++i) {
+            FrameClock::Advance(static_cast<uint64_t>(frameTimes[i] * 1e9f));
+            EntropyPredictor::UpdateCycle();
+
+            if (i > 0) {
+                result.forecastError += std::fabs(predicted - frameTimes[i]);
+                result.holdError += std::fabs(frameTimes[i - 1] - frameTimes[i]);
+            }
+            predicted = EntropyPredictor::PredictNextFrameTime(1);
+
+            const bool overloaded = EntropyPredictor::IsOverloaded();
+            result.transitions += overloaded != last;
+            last = overloaded;
+            result.overloaded.push_back(overloaded);
+        }
+        result.forecastError /= frameTimes.size() - 1;
+        result.holdError /= frameTimes.size() - 1;
+        return result;
+    }
+
+    int FirstOverloaded(const RunResult& result, size_t from) {
+        for (size_t i = from; i < result.overloaded.size(); ++i) {
+            if (result.overloaded[i]) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    int FirstClear(const RunResult& result, size_t from) {
+        for (size_t i = from; i < result.overloaded.size(); ++i) {
+            if (!result.overloaded[i]) return static_cast<int>(i);
+        }
+        return -1;
+    }
+}
+
+int main() {
+    FrameClock::SetVirtual(true);
+    const EntropyPredictor::OverloadPolicy policy = EntropyPredictor::GetOverloadPolicy();
+    bool ok = true;
+
+    // Jitter straddling the enter threshold: a bare threshold flips
+    // constantly, the hysteresis must not
+    {
+        std::mt19937 rng(4);
+        std::normal_distribution<float> jitter(0.0f, 0.004f);
+        std::vector<float> trace(2000);
+        uint32_t bareFlips = 0;
+        bool bare = false;
+        for (float& dt : trace) {
+            dt = std::fmax(policy.enterFrameTime + jitter(rng), 0.001f);
+            bareFlips += (dt > policy.enterFrameTime) != bare;
+            bare = dt > policy.enterFrameTime;
+        }
+
+        const RunResult result = Run(trace, true);
+        const bool pass = result.transitions <= 2;
+        ok &= pass;
+        std::printf("jitter at threshold   bare threshold %u flips, predictor %u transitions%s\n",
+            bareFlips, result.transitions, pass ? "" : "  FAIL");
+    }
+
+    // 16 ms -> 45 ms at frame 300, back at 900
+    {
+        std::vector<float> trace(1500, 0.016f);
+        for (size_t i = 300; i < 900; ++i) trace[i] = 0.045f;
+
+        const RunResult result = Run(trace, true);
+        const int raised = FirstOverloaded(result, 0);
+        const int cleared = raised >= 0 ? FirstClear(result, raised) : -1;
+        const bool pass = raised >= 300 && raised <= 300 + static_cast<int>(policy.enterFrames) + 2 &&
+            cleared >= 900 && cleared <= 900 + static_cast<int>(policy.exitFrames) + 5 && result.transitions == 2;
+        ok &= pass;
+        std::printf("step 16 -> 45 -> 16   raised at frame %d (step 300), cleared at %d (step 900), %u transitions%s\n",
+            raised, cleared, result.transitions, pass ? "" : "  FAIL");
+    }
+
+    // Linear ramp 16 -> 50 ms over 400 frames: the forecast should flag
+    // it before the measured frame time has been over the threshold for
+    // enterFrames. Scene detection reads a slow ramp as a run of level
+    // shifts and restarts the forecaster at each, so the lead is checked
+    // with it off and only reported with it on.
+    {
+        std::mt19937 rng(5);
+        std::normal_distribution<float> jitter(0.0f, 0.0001f);
+        std::vector<float> trace(800);
+        for (size_t i = 0; i < trace.size(); ++i) {
+            const float ramp = 0.016f + 0.034f * std::fmin(static_cast<float>(i) / 400.0f, 1.0f);
+            trace[i] = ramp + jitter(rng);
+        }
+
+        // Frame time alone, so the fused channel score cannot raise it first
+        EntropyPredictor::OverloadPolicy frameTimeOnly = policy;
+        frameTimeOnly.fusedEnterScore = 0.0f;
+        EntropyPredictor::SetOverloadPolicy(frameTimeOnly);
+
+        const RunResult withScenes = Run(trace, true);
+        const RunResult measured = Run(trace, false);
+
+        EntropyPredictor::SceneDetectionParameters noScenes;
+        noScenes.threshold = 1e9f;
+        EntropyPredictor::SetSceneDetection(noScenes);
+        const RunResult forecast = Run(trace, true);
+        EntropyPredictor::SetSceneDetection(EntropyPredictor::SceneDetectionParameters{});
+        EntropyPredictor::SetOverloadPolicy(policy);
+
+        const int early = FirstOverloaded(forecast, 0);
+        const int late = FirstOverloaded(measured, 0);
+        const bool pass = early >= 0 && late >= 0 && late - early >= 2 && forecast.forecastError < forecast.holdError;
+        ok &= pass;
+        std::printf("ramp 16 -> 50 ms      measured raises at frame %d; forecast at %d (%d frames earlier), "
+            "%d with scene detection on\n", late, early, late - early, late - FirstOverloaded(withScenes, 0));
+        std::printf("                      next-frame error %.3f ms forecast vs %.3f ms holding the last frame%s\n",
+            forecast.forecastError * 1000.0, forecast.holdError * 1000.0, pass ? "" : "  FAIL");
+    }
+
+    EntropyPredictor::SetForecastingEnabled(true);
+    std::printf("%s\n", ok ? "overload checks passed" : "overload checks FAILED");
+    return ok ? 0 : 1;
+}
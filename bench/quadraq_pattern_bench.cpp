@@ -0,0 +1,234 @@
+// ====================================================================
+//                       quadraq_pattern_bench.cpp
+//     TGDK Quantum GPU Accelerator — Override Rule Matching Check
+//     NamePatternSet against a rule-by-rule matcher: same answers,
+//     cold / memoized / naive timings, and readers racing rule reloads.
+//     Exact rules in a case-folding RedirectTable, as FlatDDSInterceptor
+//     keeps them, give the same verdict as the matcher in any case
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "NamePatternSet.hpp"
+#include "RedirectTable.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using QUADRAQ::NamePattern;
+using QUADRAQ::PatternKind;
+
+namespace {
+
+    const char* const kParts[] = {
+        "clouds", "volumetric", "layer", "atmosphere", "blur", "cube", "shader", "fog", "gradient",
+        "motion", "occlusion", "godrays", "low", "quality", "terrain", "rock", "grass", "normal",
+        "albedo", "rough", "metal", "ui", "font", "decal", "water", "foam", "sky", "lut", "noise", "mask",
+    };
+    constexpr size_t kPartCount = sizeof(kParts) / sizeof(kParts[0]);
+
+    using Clock = std::chrono::steady_clock;
+
+    double Seconds(Clock::time_point since) {
+        return std::chrono::duration<double>(Clock::now() - since).count();
+    }
+
+    char Lower(char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+
+    bool EqualAt(const std::string& name, size_t offset, const std::string& text) {
+        if (offset + text.size() > name.size()) return false;
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (Lower(name[offset + i]) != Lower(text[i])) return false;
+        }
+        return true;
+    }
+
+    bool GlobMatch(const char* p, const char* n) {
+        if (*p == '\0') return *n == '\0';
+        if (*p == '*') return GlobMatch(p + 1, n) || (*n != '\0' && GlobMatch(p, n + 1));
+        if (*n == '\0') return false;
+        return (*p == '?' || Lower(*p) == Lower(*n)) && GlobMatch(p + 1, n + 1);
+    }
+
+    // Reference: every rule in order, straight from its definition
+    int NaiveMatch(const std::vector<NamePattern>& rules, const std::string& name) {
+        for (size_t i = 0; i < rules.size(); ++i) {
+            const std::string& text = rules[i].text;
+            bool hit = false;
+            switch (rules[i].kind) {
+            case PatternKind::Exact:    hit = name.size() == text.size() && EqualAt(name, 0, text); break;
+            case PatternKind::Prefix:   hit = EqualAt(name, 0, text); break;
+            case PatternKind::Suffix:   hit = name.size() >= text.size() && EqualAt(name, name.size() - text.size(), text); break;
+            case PatternKind::Contains:
+                for (size_t at = 0; !hit && at + text.size() <= name.size(); ++at) hit = EqualAt(name, at, text);
+                break;
+            case PatternKind::Glob:     hit = GlobMatch(text.c_str(), name.c_str()); break;
+            }
+            if (hit) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    std::string Recase(const std::string& name, std::mt19937& rng) {
+        std::string recased = name;
+        for (char& c : recased) {
+            if (c >= 'a' && c <= 'z' && rng() % 2) c = static_cast<char>(c - ('a' - 'A'));
+            else if (c >= 'A' && c <= 'Z' && rng() % 2) c = static_cast<char>(c + ('a' - 'A'));
+        }
+        return recased;
+    }
+
+    std::string RandomName(std::mt19937& rng) {
+        std::string name;
+        const size_t parts = 2 + rng() % 4;
+        for (size_t i = 0; i < parts; ++i) {
+            if (i) name += rng() % 3 ? '_' : '/';
+            name += kParts[rng() % kPartCount];
+        }
+        if (rng() % 4 == 0) name += std::to_string(rng() % 100);
+        name += rng() % 8 ? ".dds" : ".DDS";
+        if (rng() % 5 == 0) name[0] = static_cast<char>(name[0] - ('a' - 'A'));
+        return name;
+    }
+
+    std::vector<NamePattern> RandomRules(std::mt19937& rng, size_t count) {
+        std::vector<NamePattern> rules;
+        for (size_t i = 0; i < count; ++i) {
+            const std::string a = kParts[rng() % kPartCount];
+            const std::string b = kParts[rng() % kPartCount];
+            switch (rng() % 5) {
+            case 0: rules.push_back({ PatternKind::Exact, a + "_" + b + ".dds" }); break;
+            case 1: rules.push_back({ PatternKind::Prefix, a + "_" + b }); break;
+            case 2: rules.push_back({ PatternKind::Suffix, b + std::to_string(rng() % 100) + ".dds" }); break;
+            case 3: rules.push_back({ PatternKind::Contains, a + "_" + b }); break;
+            case 4: rules.push_back({ PatternKind::Glob, "*" + a + "?" + b + "*" + (rng() % 2 ? ".dds" : "") }); break;
+            }
+        }
+        return rules;
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t ruleCount = 500;
+    size_t nameCount = 20000;
+    size_t threads = 4;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--rules") == 0) ruleCount = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--names") == 0) nameCount = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--threads") == 0) threads = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    std::mt19937 rng(24);
+    const std::vector<NamePattern> rules = RandomRules(rng, ruleCount);
+    std::vector<std::string> names(nameCount);
+    for (std::string& name : names) name = RandomName(rng);
+
+    QUADRAQ::NamePatternSet set;
+    set.Assign(rules);
+
+    // Answers
+    std::vector<int> expected(nameCount);
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < nameCount; ++i) expected[i] = NaiveMatch(rules, names[i]);
+    const double naive = Seconds(start);
+
+    size_t wrong = 0, matched = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < nameCount; ++i) wrong += set.Match(names[i]) != expected[i];
+    const double cold = Seconds(start);
+
+    start = Clock::now();
+    for (size_t i = 0; i < nameCount; ++i) wrong += set.Match(names[i]) != expected[i];
+    const double warm = Seconds(start);
+
+    for (size_t i = 0; i < nameCount; ++i) {
+        wrong += set.Scan(names[i]) != expected[i];
+        matched += expected[i] >= 0;
+    }
+
+    const QUADRAQ::NamePatternStats stats = set.Stats();
+    std::printf("%zu rules, %zu names (%zu matched), %zu automaton states\n",
+        ruleCount, nameCount, matched, stats.automatonStates);
+    std::printf("naive     %8.1f ns/name\n", naive * 1e9 / nameCount);
+    std::printf("compiled  %8.1f ns/name (first sight)\n", cold * 1e9 / nameCount);
+    std::printf("memoized  %8.1f ns/name (%zu names memoized)\n", warm * 1e9 / nameCount, stats.memoized);
+
+    // Case: exact rules split off into a folding table, the rest in a
+    // NamePatternSet, answer like the full rule set for any spelling
+    {
+        std::vector<std::string> exactNames;
+        std::vector<NamePattern> others;
+        for (const NamePattern& rule : rules) {
+            if (rule.kind == PatternKind::Exact) exactNames.push_back(Recase(rule.text, rng));
+            else others.push_back(rule);
+        }
+        int target = 1;
+        QUADRAQ::RedirectTable exact(QUADRAQ::NameCase::Folded);
+        exact.SetMany(std::vector<std::string_view>(exactNames.begin(), exactNames.end()), &target);
+        QUADRAQ::NamePatternSet split;
+        split.Assign(others);
+
+        size_t caseWrong = 0;
+        for (size_t i = 0; i < nameCount; ++i) {
+            const std::string spelled = Recase(names[i], rng);
+            const bool hit = exact.Find(spelled) || exact.Find(QUADRAQ::NameKey(spelled)) || split.Match(spelled) >= 0;
+            caseWrong += hit != (expected[i] >= 0);
+            caseWrong += (exact.Find(QUADRAQ::NameKey::Folded(spelled)) != nullptr) != (exact.Find(names[i]) != nullptr);
+            // Memo entries are shared across spellings
+            caseWrong += set.Match(spelled) != expected[i];
+            caseWrong += QUADRAQ::FoldedHash64(spelled.data(), spelled.size()) !=
+                         QUADRAQ::FoldedHash64(names[i].data(), names[i].size());
+        }
+        const size_t memoized = set.Stats().memoized;
+
+        // A table left case-sensitive still is
+        QUADRAQ::RedirectTable sensitive;
+        sensitive.Set("Fog_Volume.dds", &target);
+        caseWrong += sensitive.Find("fog_volume.dds") != nullptr || sensitive.Find("Fog_Volume.dds") == nullptr;
+        caseWrong += exact.Size() > exactNames.size();
+        caseWrong += memoized != stats.memoized;
+        std::printf("case: %zu names respelled, %zu exact rules folded, %zu answers differ\n",
+            nameCount, exactNames.size(), caseWrong);
+        wrong += caseWrong;
+    }
+
+    // Readers race reloads that flip between the rules and an empty set;
+    // every answer must be one of the two
+    std::atomic<bool> stop{ false };
+    std::atomic<size_t> raced{ 0 }, racedWrong{ 0 };
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < threads; ++t) {
+        readers.emplace_back([&, t] {
+            size_t i = t, count = 0, bad = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const int rule = set.Match(names[i]);
+                bad += rule != expected[i] && rule != -1;
+                ++count;
+                i = (i + 7919) % nameCount;
+            }
+            raced += count;
+            racedWrong += bad;
+        });
+    }
+    for (int reload = 0; reload < 200; ++reload) {
+        if (reload % 2) set.Assign(rules);
+        else set.Clear();
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    stop = true;
+    for (std::thread& reader : readers) reader.join();
+
+    std::printf("%zu matches from %zu threads across 200 reloads\n", raced.load(), threads);
+
+    wrong += racedWrong;
+    if (wrong) std::printf("FAIL: %zu answers differ from the naive matcher\n", wrong);
+    return wrong ? 1 : 0;
+}
@@ -0,0 +1,178 @@
+// ====================================================================
+//                       quadraq_quality_bench.cpp
+//     TGDK Quantum GPU Accelerator — Quality Ladder Check
+//     Scripted load traces against the ladder's rules: loads inside
+//     the hysteresis band never move it, degrading waits out the
+//     minimum dwell and may skip levels, restoring climbs one level
+//     per run, and a frame-fold cap drops the level at once, holds it
+//     and, once lifted, lets it climb back through the usual band.
+//     A second thread toggles the cap while the ladder updates
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "QualityLadder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Runs `frames` updates at `load`; the frame (1-based) of the first
+    // level change, or 0 when there was none
+    uint32_t FirstChange(QualityLadder& ladder, float load, uint32_t frames) {
+        const ShaderQuality start = ladder.Level();
+        for (uint32_t f = 1; f <= frames; ++f) {
+            ladder.Update(load);
+            if (ladder.Level() != start) return f;
+        }
+        return 0;
+    }
+
+    uint64_t FramesCounted(const QualityLadderStats& stats) {
+        uint64_t total = 0;
+        for (uint64_t frames : stats.framesAt) total += frames;
+        return total;
+    }
+}
+
+int main(int argc, char** argv) {
+    int ms = 200;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--ms") == 0) ms = std::atoi(argv[i + 1]);
+    }
+
+    const QualityLadderPolicy policy;
+    const uint32_t dwell = policy.minDwellFrames, restore = policy.restoreFrames;
+    const float exitReduced = policy.enterLoad[0] * policy.exitRatio;
+    size_t errors = 0;
+
+    // --- Hysteresis: inside the band nothing moves ---
+    {
+        QualityLadder ladder(policy);
+        // Alternating just over and just under the entry load never builds a run
+        for (uint32_t f = 0; f < 1000; ++f) ladder.Update(f % 2 ? policy.enterLoad[0] - 0.05f : policy.enterLoad[0] + 0.05f);
+        errors += ladder.Level() != ShaderQuality::Full || ladder.Stats().transitions != 0;
+
+        // Held over it: the dwell is long served, so a degrade run is enough
+        const uint32_t degradedAt = FirstChange(ladder, policy.enterLoad[0] + 0.05f, 1000);
+        errors += ladder.Level() != ShaderQuality::Reduced || degradedAt != policy.degradeFrames;
+
+        // Between the exit and entry loads: held at Reduced
+        errors += FirstChange(ladder, 0.5f * (exitReduced + policy.enterLoad[0]), 2000) != 0;
+        // Below the exit load: restored after a full run
+        const uint32_t restoredAt = FirstChange(ladder, exitReduced - 0.05f, 1000);
+        errors += ladder.Level() != ShaderQuality::Full || restoredAt != std::max(restore, dwell);
+        std::printf("hysteresis: band [%.2f, %.2f) held 2000 frames; degraded after %u, restored after %u frames\n",
+            exitReduced, policy.enterLoad[0], degradedAt, restoredAt);
+    }
+
+    // --- Minimum dwell and multi-level steps ---
+    {
+        QualityLadder ladder(policy);
+        for (uint32_t f = 0; f < dwell; ++f) ladder.Update(0.5f);
+
+        // Dwell served: degrading takes exactly degradeFrames
+        errors += FirstChange(ladder, policy.enterLoad[0] + 0.01f, 100) != policy.degradeFrames;
+        errors += ladder.Level() != ShaderQuality::Reduced;
+
+        // Much heavier load right after: held for the dwell, then straight to Flat
+        const uint32_t flatAt = FirstChange(ladder, policy.enterLoad[2] + 1.0f, 1000);
+        errors += flatAt != dwell || ladder.Level() != ShaderQuality::Flat;
+
+        // Light load: one level per run, never two at once
+        uint32_t steps[3] = {};
+        for (uint32_t& step : steps) step = FirstChange(ladder, 0.1f, 1000);
+        errors += ladder.Level() != ShaderQuality::Full;
+        for (uint32_t step : steps) errors += step != std::max(restore, dwell);
+
+        const QualityLadderStats& stats = ladder.Stats();
+        errors += stats.transitions != 5;
+        std::printf("dwell: Reduced -> Flat after %u frames (dwell %u); restored in steps of %u, %u, %u\n",
+            flatAt, dwell, steps[0], steps[1], steps[2]);
+    }
+
+    // --- Frame fold: cap to Minimal, hold, lift ---
+    {
+        QualityLadder ladder(policy);
+        for (uint32_t f = 0; f < 100; ++f) ladder.Update(0.5f);
+
+        ladder.SetCap(ShaderQuality::Minimal);
+        errors += ladder.Level() != ShaderQuality::Minimal || ladder.Cap() != ShaderQuality::Minimal;
+        // The next update reports the change; light load cannot lift it
+        errors += !ladder.Update(0.1f);
+        errors += FirstChange(ladder, 0.1f, 500) != 0;
+        // Heavier load still degrades below the cap
+        errors += FirstChange(ladder, policy.enterLoad[2] + 1.0f, 500) == 0 || ladder.Level() != ShaderQuality::Flat;
+        errors += FirstChange(ladder, 0.1f, 500) == 0 || ladder.Level() != ShaderQuality::Minimal;
+        errors += FirstChange(ladder, 0.1f, 500) != 0;
+
+        // Lifted: nothing jumps, the ladder climbs back one run at a time
+        ladder.SetCap(ShaderQuality::Full);
+        errors += ladder.Level() != ShaderQuality::Minimal;
+        const uint32_t first = FirstChange(ladder, 0.1f, 1000);
+        const uint32_t second = FirstChange(ladder, 0.1f, 1000);
+        errors += first != restore || second != std::max(restore, dwell);
+        errors += ladder.Level() != ShaderQuality::Full;
+
+        // Lowering the cap above the current level changes nothing
+        ladder.SetCap(ShaderQuality::Flat);
+        ladder.SetCap(ShaderQuality::Reduced);
+        errors += ladder.Level() != ShaderQuality::Flat;
+        ladder.SetCap(ShaderQuality::Full);
+        ladder.Reset();
+        errors += ladder.Level() != ShaderQuality::Full || FramesCounted(ladder.Stats()) != 0;
+        std::printf("fold: capped to minimal at once, held under light load, climbed back after %u + %u frames\n",
+            first, second);
+    }
+
+    // --- Cap toggled from another thread while the ladder updates ---
+    {
+        QualityLadderPolicy fast = policy;
+        fast.degradeFrames = 1;
+        fast.restoreFrames = 1;
+        fast.minDwellFrames = 1;
+        QualityLadder ladder(fast);
+
+        std::atomic<bool> stop{ false };
+        std::atomic<size_t> violations{ 0 }, folds{ 0 };
+        std::thread folder([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                ladder.SetCap(ShaderQuality::Minimal);
+                for (int k = 0; k < 64; ++k)
+                    violations += ladder.Level() < ShaderQuality::Minimal;
+                ladder.SetCap(ShaderQuality::Full);
+                ++folds;
+                std::this_thread::yield();
+            }
+        });
+
+        std::mt19937 rng(18);
+        std::uniform_real_distribution<float> load(0.0f, 2.0f);
+        uint64_t updates = 0;
+        const Clock::time_point start = Clock::now();
+        while (Clock::now() - start < std::chrono::milliseconds(ms)) {
+            for (int k = 0; k < 256; ++k) ladder.Update(load(rng));
+            updates += 256;
+        }
+        stop = true;
+        folder.join();
+
+        errors += violations.load();
+        errors += FramesCounted(ladder.Stats()) != updates;
+        std::printf("concurrent: %llu updates, %zu folds, %zu reads above the cap\n",
+            static_cast<unsigned long long>(updates), folds.load(), violations.load());
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
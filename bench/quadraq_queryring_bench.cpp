@@ -0,0 +1,208 @@
+// ====================================================================
+//                      quadraq_queryring_bench.cpp
+//     TGDK Quantum GPU Accelerator — Query Ring Check
+//     Drives QueryRing over SimulatedQueryDevice with the GPU 0, 1, 2
+//     and more than the ring depth frames behind: frames are skipped
+//     only once every slot is in flight, results come back in order
+//     with the simulated lag, Collect() never waits, failed polls free
+//     their slot and nothing is allocated after Initialize()
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "QueryRing.hpp"
+#include "SimulatedQueryDevice.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace QUADRAQ;
+
+namespace {
+    std::atomic<size_t> allocations{ 0 };
+}
+
+void* operator new(size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Results whose End() came while `failing` is set poll Failed once
+    // they would have been ready, like a result lost to a device reset
+    class FlakyQueryDevice : public SimulatedQueryDevice {
+    public:
+        using SimulatedQueryDevice::SimulatedQueryDevice;
+
+        void SetFailing(bool fail) { failing = fail; }
+
+        void End(GpuHandle query) override {
+            SimulatedQueryDevice::End(query);
+            doomed[Index(query)] = failing;
+        }
+
+        QueryPoll Poll(GpuHandle query, PipelineStatistics& stats) override {
+            const QueryPoll poll = SimulatedQueryDevice::Poll(query, stats);
+            if (poll != QueryPoll::Ready || !doomed[Index(query)]) return poll;
+            doomed[Index(query)] = false;
+            return QueryPoll::Failed;
+        }
+
+    private:
+        static size_t Index(GpuHandle query) { return reinterpret_cast<uintptr_t>(query) % 16; }
+
+        std::array<bool, 16> doomed{};
+        bool failing = false;
+    };
+
+    struct RunResult {
+        QueryRingStats stats;
+        size_t errors = 0;
+        size_t allocations = 0;
+        uint64_t doomed = 0;        // measured frames whose result was lost
+        uint32_t lag = 0;           // stats.latency at the last frame
+        uint64_t maxPolls = 0;      // device polls by any one Collect()
+        double nsPerFrame = 0.0;
+    };
+
+    // `frames` frames of Begin/End/Collect, the device stepping one frame
+    // after each; frame numbers ride in iaVertices. Frames listed in
+    // `failFrames` lose their result if measured. Then drains the ring.
+    RunResult Run(uint32_t latency, uint32_t depth, uint64_t frames, const uint64_t* failFrames = nullptr, size_t failCount = 0) {
+        FlakyQueryDevice device(latency);
+        QueryRing ring(device, depth);
+        RunResult run;
+        if (!ring.Initialize() || device.LiveQueries() != depth) {
+            ++run.errors;
+            return run;
+        }
+
+        uint64_t lastResult = 0;
+        uint64_t expectedSkips = 0;
+        const size_t allocationsBefore = allocations.load();
+        const Clock::time_point start = Clock::now();
+
+        for (uint64_t frame = 1; frame <= frames; ++frame) {
+            // The ring may refuse a frame only when every slot is in flight
+            const uint64_t inFlight = ring.Stats().begun - ring.Stats().collected - ring.Stats().failed;
+            const uint64_t skippedBefore = ring.Stats().skipped;
+            PipelineStatistics sample;
+            sample.iaVertices = frame;
+            device.SetResult(sample);
+            const bool doomed = std::find(failFrames, failFrames + failCount, frame) != failFrames + failCount;
+            device.SetFailing(doomed);
+
+            const bool measured = ring.Begin();
+            run.doomed += measured && doomed;
+            run.errors += measured != (inFlight < depth);
+            run.errors += ring.Stats().skipped != skippedBefore + !measured;
+            expectedSkips += !measured;
+            if (measured) ring.End();
+
+            const uint64_t pollsBefore = device.Polls();
+            PipelineStatistics result;
+            if (ring.Collect(result)) {
+                // In order, exactly `latency` frames old
+                run.errors += result.iaVertices <= lastResult;
+                run.errors += result.iaVertices + latency != frame;
+                run.errors += ring.Stats().latency != latency;
+                lastResult = result.iaVertices;
+            }
+            run.maxPolls = std::max(run.maxPolls, device.Polls() - pollsBefore);
+            device.AdvanceFrame();
+        }
+
+        run.nsPerFrame = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / frames;
+        run.allocations = allocations.load() - allocationsBefore;
+        run.lag = ring.Stats().latency;
+
+        // Drain: everything begun is eventually collected or failed
+        for (uint32_t i = 0; i <= latency; ++i) {
+            PipelineStatistics result;
+            ring.Collect(result);
+            device.AdvanceFrame();
+        }
+
+        run.stats = ring.Stats();
+        run.errors += run.stats.skipped != expectedSkips;
+        run.errors += run.stats.begun + run.stats.skipped != frames;
+        run.errors += run.stats.collected + run.stats.failed != run.stats.begun;
+        run.errors += run.stats.failed != run.doomed;
+        // Collect() polls each slot at most once and stops at the first pending one
+        run.errors += run.maxPolls > depth;
+        run.errors += device.QueriesCreated() != depth;
+
+        ring.Release();
+        run.errors += device.LiveQueries() != 0;
+        return run;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t frames = 100000;
+    uint32_t depth = 3;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--depth") == 0) depth = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+    }
+    frames = std::max<uint64_t>(frames, 64);
+    depth = std::min(std::max(depth, 1u), QueryRing::kMaxFramesInFlight);
+
+    size_t errors = 0;
+    std::printf("ring depth %u, %llu frames\n", depth, static_cast<unsigned long long>(frames));
+    std::printf("%7s | %8s %9s %8s %6s | %7s %9s %6s | %8s\n", "latency", "begun", "collected", "skipped", "failed",
+        "lag", "max polls", "allocs", "ns/frame");
+
+    const uint32_t latencies[] = { 0, 1, 2, depth, depth + 2 };
+    for (const uint32_t latency : latencies) {
+        const RunResult run = Run(latency, depth, frames);
+        errors += run.errors + run.allocations;
+        // Skipping starts exactly when the GPU falls a full ring behind
+        errors += (run.stats.skipped != 0) != (latency >= depth);
+        errors += run.stats.collected == 0;
+        std::printf("%7u | %8llu %9llu %8llu %6llu | %7u %9llu %6zu | %8.1f\n", latency,
+            static_cast<unsigned long long>(run.stats.begun), static_cast<unsigned long long>(run.stats.collected),
+            static_cast<unsigned long long>(run.stats.skipped), static_cast<unsigned long long>(run.stats.failed),
+            run.lag, static_cast<unsigned long long>(run.maxPolls), run.allocations, run.nsPerFrame);
+    }
+
+    // Lost results free their slot: with the ring otherwise saturated a
+    // leaked slot would show up as extra skips
+    {
+        const uint64_t failFrames[] = { 10, 11, 12, 13, 40, frames / 2 };
+        const RunResult clean = Run(depth, depth, frames);
+        const RunResult lossy = Run(depth, depth, frames, failFrames, 6);
+        errors += lossy.errors + lossy.allocations;
+        errors += lossy.stats.failed == 0;
+        errors += lossy.stats.skipped != clean.stats.skipped;
+        std::printf("lossy  | %llu failed, %llu skipped (clean run %llu)\n",
+            static_cast<unsigned long long>(lossy.stats.failed), static_cast<unsigned long long>(lossy.stats.skipped),
+            static_cast<unsigned long long>(clean.stats.skipped));
+    }
+
+    // A failed creation leaves nothing held and the ring inert
+    {
+        SimulatedQueryDevice device;
+        device.SetCreateFailure(true);
+        QueryRing ring(device, depth);
+        errors += ring.Initialize();
+        errors += device.LiveQueries() != 0;
+        errors += ring.Begin();
+        PipelineStatistics result;
+        errors += ring.Collect(result);
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
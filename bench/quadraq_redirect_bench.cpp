@@ -0,0 +1,153 @@
+// ====================================================================
+//                       quadraq_redirect_bench.cpp
+//     TGDK Quantum GPU Accelerator — Compiled Redirect Index Check
+//     10k registered overrides and a miss-heavy texture stream: every
+//     answer checked against std::unordered_map, then hit, miss and
+//     mixed lookup cost against the maps the index replaced
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RedirectTable.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    GpuHandle Handle(size_t i) { return reinterpret_cast<GpuHandle>(static_cast<uintptr_t>(0x100000 + i * 16)); }
+
+    // Game-like paths; overrides and misses share directories and stems so
+    // misses differ late in the string
+    std::string TextureName(std::mt19937& rng, size_t serial) {
+        static const char* const folders[] = { "architecture/whiterun", "architecture/solitude", "landscape/trees",
+            "landscape/rocks", "clutter/food", "actors/character/female", "effects/fxfire", "dungeons/nordic" };
+        static const char* const suffixes[] = { ".dds", "_n.dds", "_m.dds", "_g.dds" };
+        char buffer[128];
+        std::snprintf(buffer, sizeof(buffer), "data/textures/%s/asset%06zu%s",
+            folders[rng() % 8], serial, suffixes[rng() % 4]);
+        return buffer;
+    }
+
+    template <typename Key, typename Lookup>
+    double NanosecondsPer(const std::vector<Key>& stream, size_t rounds, Lookup lookup) {
+        volatile uintptr_t sink = 0;
+        uintptr_t acc = 0;
+        const Clock::time_point start = Clock::now();
+        for (size_t r = 0; r < rounds; ++r)
+            for (const Key& key : stream) acc += reinterpret_cast<uintptr_t>(lookup(key));
+        sink = acc;
+        (void)sink;
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (stream.size() * rounds);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t overrideCount = 10000;
+    size_t streamLength = 200000;
+    size_t rounds = 5;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--overrides") == 0) overrideCount = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--lookups") == 0) streamLength = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--rounds") == 0) rounds = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    std::mt19937 rng(22);
+    std::vector<std::string> overrides, others;
+    for (size_t i = 0; i < overrideCount; ++i) overrides.push_back(TextureName(rng, i));
+    for (size_t i = 0; i < overrideCount * 4; ++i) others.push_back(TextureName(rng, overrideCount + i));
+
+    // Registered in batches of 64 names sharing a target, one rebuild each
+    RedirectTable table;
+    std::unordered_map<std::string, GpuHandle> reference;
+    constexpr size_t kBatch = 64;
+    const Clock::time_point buildStart = Clock::now();
+    for (size_t first = 0; first < overrideCount; first += kBatch) {
+        const size_t last = std::min(first + kBatch, overrideCount);
+        table.SetMany(std::vector<std::string_view>(overrides.begin() + first, overrides.begin() + last), Handle(first));
+    }
+    const double buildMs = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+    for (size_t i = 0; i < overrideCount; ++i) reference.emplace(overrides[i], Handle(i - i % kBatch));
+
+    // One more name into the full table: a whole rebuild
+    const std::string extra = "data/textures/extra/late_override.dds";
+    const Clock::time_point setStart = Clock::now();
+    table.Set(extra, Handle(overrideCount));
+    const double setMs = std::chrono::duration<double, std::milli>(Clock::now() - setStart).count();
+    table.Remove(extra);
+
+    // Every answer agrees with the reference map
+    size_t wrong = table.Size() != overrideCount;
+    for (const std::string& name : overrides) wrong += table.Find(name) != reference.at(name);
+    for (const std::string& name : others) wrong += table.Find(name) != nullptr;
+    // Near misses: prefixes and one-character edits of registered names
+    for (size_t i = 0; i < overrideCount; i += 7) {
+        const std::string& name = overrides[i];
+        wrong += table.Find(std::string_view(name).substr(0, name.size() - 1)) != nullptr;
+        std::string edited = name;
+        edited[edited.size() / 2] ^= 0x20;
+        wrong += table.Find(edited) != (reference.count(edited) ? reference.at(edited) : nullptr);
+    }
+
+    // Streams: hits only, misses only, and 1 hit in 20
+    std::vector<std::string_view> hits, misses, mixed;
+    for (size_t k = 0; k < streamLength; ++k) {
+        hits.push_back(overrides[rng() % overrides.size()]);
+        misses.push_back(others[rng() % others.size()]);
+        mixed.push_back(k % 20 == 0 ? hits.back() : misses.back());
+    }
+
+    std::unordered_map<std::string_view, GpuHandle> viewMap(reference.size());
+    for (const auto& entry : reference) viewMap.emplace(entry.first, entry.second);
+    std::mutex mapMutex;
+
+    auto snapshot = [&](std::string_view name) { return table.Find(name); };
+    auto keyed = [&](const NameKey& key) { return table.Find(key); };
+    auto locked = [&](std::string_view name) {
+        const std::string key(name);
+        std::lock_guard<std::mutex> lock(mapMutex);
+        const auto it = reference.find(key);
+        return it == reference.end() ? nullptr : it->second;
+    };
+    auto viewed = [&](std::string_view name) {
+        const auto it = viewMap.find(name);
+        return it == viewMap.end() ? nullptr : it->second;
+    };
+
+    std::printf("%zu overrides, snapshot %zu KiB; registered in %.1f ms, one more Set %.2f ms\n",
+        overrideCount, table.MemoryBytes() / 1024, buildMs, setMs);
+    std::printf("%6s | %9s %9s %9s | %9s %9s | ns per lookup\n", "stream", "index", "hashed", "pinned", "map", "locked");
+    const std::pair<const char*, const std::vector<std::string_view>*> streams[] = {
+        { "hits", &hits }, { "misses", &misses }, { "mixed", &mixed } };
+    for (const auto& stream : streams) {
+        // Pre-hashed keys, as the interceptor passes them
+        const std::vector<NameKey> keys(stream.second->begin(), stream.second->end());
+
+        const double index = NanosecondsPer(*stream.second, rounds, snapshot);
+        const double hashed = NanosecondsPer(keys, rounds, keyed);
+        double batch;
+        {
+            // One pin for the whole stream
+            EpochGuard guard;
+            batch = NanosecondsPer(keys, rounds, keyed);
+        }
+        const double map = NanosecondsPer(*stream.second, rounds, viewed);
+        const double mutexed = NanosecondsPer(*stream.second, rounds, locked);
+        std::printf("%6s | %9.1f %9.1f %9.1f | %9.1f %9.1f |\n", stream.first, index, hashed, batch, map, mutexed);
+    }
+
+    if (wrong) std::printf("FAIL: %zu answers differ from the reference map\n", wrong);
+    return wrong ? 1 : 0;
+}
@@ -0,0 +1,198 @@
+// ====================================================================
+//                     quadraq_redirect_mt_bench.cpp
+//     TGDK Quantum GPU Accelerator — Concurrent Redirect Lookups
+//     Reader threads look texture names up while a writer keeps
+//     retargeting, removing and re-adding overrides; every answer must
+//     be one the table could have held. Throughput is compared with
+//     the mutex-guarded string map the interceptor used before
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RedirectTable.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Override i alternates between two handles; the last quarter is also
+    // removed and re-added, so it may be absent
+    GpuHandle HandleA(size_t i) { return reinterpret_cast<GpuHandle>(static_cast<uintptr_t>(0x100000 + i * 16)); }
+    GpuHandle HandleB(size_t i) { return reinterpret_cast<GpuHandle>(static_cast<uintptr_t>(0x900000 + i * 16)); }
+
+    // The interceptor's previous lookup: a std::string per bind, one mutex
+    struct LockedMap {
+        std::mutex mutex;
+        std::unordered_map<std::string, GpuHandle> map;
+
+        GpuHandle Find(std::string_view name) {
+            const std::string key(name);
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto it = map.find(key);
+            return it == map.end() ? nullptr : it->second;
+        }
+        void Set(std::string_view name, GpuHandle target) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (target) map[std::string(name)] = target;
+            else map.erase(std::string(name));
+        }
+    };
+
+    struct Names {
+        std::vector<std::string> storage;
+        std::vector<std::string_view> overrides;    // registered, first `overrideCount`
+        std::vector<std::string_view> stream;       // what readers look up
+        std::vector<uint32_t> streamIndex;          // override index, or UINT32_MAX for a miss
+    };
+
+    Names MakeNames(size_t overrideCount, size_t streamLength) {
+        Names names;
+        const size_t distinct = overrideCount * 10;
+        names.storage.reserve(distinct);
+        char buffer[96];
+        for (size_t i = 0; i < distinct; ++i) {
+            std::snprintf(buffer, sizeof(buffer), "data/textures/%s/%s_%05zu_d.dds",
+                i % 3 == 0 ? "architecture" : i % 3 == 1 ? "landscape" : "clutter", i % 2 ? "stone" : "wood", i);
+            names.storage.emplace_back(buffer);
+        }
+        for (size_t i = 0; i < overrideCount; ++i) names.overrides.push_back(names.storage[i * 10]);
+
+        // One lookup in ten hits an override
+        for (size_t k = 0; k < streamLength; ++k) {
+            const size_t i = (k * 7919) % distinct;
+            names.stream.push_back(names.storage[i]);
+            names.streamIndex.push_back(i % 10 == 0 ? static_cast<uint32_t>(i / 10) : UINT32_MAX);
+        }
+        return names;
+    }
+
+    bool Plausible(GpuHandle got, uint32_t index, size_t overrideCount) {
+        if (index == UINT32_MAX) return got == nullptr;
+        if (got == HandleA(index) || got == HandleB(index)) return true;
+        return got == nullptr && index >= overrideCount - overrideCount / 4;
+    }
+
+    struct RunResult {
+        double lookupsPerSecond;
+        size_t wrong;
+    };
+
+    // `threads` readers for `ms` while the calling thread writes
+    template <typename Find, typename Write>
+    RunResult Run(const Names& names, size_t threads, int ms, Find find, Write write) {
+        std::atomic<bool> stop{ false };
+        std::atomic<size_t> lookups{ 0 }, wrong{ 0 };
+        std::vector<std::thread> readers;
+        const size_t overrideCount = names.overrides.size();
+
+        for (size_t t = 0; t < threads; ++t) {
+            readers.emplace_back([&, t] {
+                size_t k = t * 131, count = 0, bad = 0;
+                const size_t length = names.stream.size();
+                while (!stop.load(std::memory_order_relaxed)) {
+                    for (int batch = 0; batch < 256; ++batch) {
+                        bad += !Plausible(find(names.stream[k]), names.streamIndex[k], overrideCount);
+                        if (++k == length) k = 0;
+                    }
+                    count += 256;
+                }
+                lookups += count;
+                wrong += bad;
+            });
+        }
+
+        const Clock::time_point start = Clock::now();
+        for (size_t step = 0; Clock::now() - start < std::chrono::milliseconds(ms); ++step) {
+            write(step);
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+        stop = true;
+        for (std::thread& reader : readers) reader.join();
+
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return { lookups.load() / seconds, wrong.load() };
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t overrideCount = 1000;
+    size_t maxThreads = 4;
+    int ms = 300;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--overrides") == 0) overrideCount = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--threads") == 0) maxThreads = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--ms") == 0) ms = std::atoi(argv[i + 1]);
+    }
+    overrideCount = std::max<size_t>(overrideCount, 4);
+
+    const Names names = MakeNames(overrideCount, 1 << 16);
+    const size_t volatileFirst = overrideCount - overrideCount / 4;
+
+    RedirectTable table;
+    LockedMap locked;
+    for (size_t i = 0; i < overrideCount; ++i) {
+        table.Set(names.overrides[i], HandleA(i));
+        locked.Set(names.overrides[i], HandleA(i));
+    }
+
+    // Writer step w: retarget one name; every second step also drops or
+    // restores the volatile quarter (dropped in one rebuild, restored name
+    // by name so readers see it partially back)
+    auto writeTable = [&](size_t w) {
+        const size_t i = w % volatileFirst;
+        table.Set(names.overrides[i], w / volatileFirst % 2 ? HandleA(i) : HandleB(i));
+
+        if (w % 4 == 1) {
+            const std::vector<std::string_view> removed(names.overrides.begin() + volatileFirst, names.overrides.end());
+            table.SetMany(removed, nullptr);
+        }
+        else if (w % 4 == 3) {
+            for (size_t j = volatileFirst; j < overrideCount; ++j) table.Set(names.overrides[j], HandleA(j));
+        }
+    };
+    auto writeLocked = [&](size_t w) {
+        const size_t i = w % volatileFirst;
+        locked.Set(names.overrides[i], w / volatileFirst % 2 ? HandleA(i) : HandleB(i));
+        for (size_t j = volatileFirst; j < overrideCount; ++j) {
+            if (w % 4 == 1) locked.Set(names.overrides[j], nullptr);
+            if (w % 4 == 3) locked.Set(names.overrides[j], HandleA(j));
+        }
+    };
+
+    size_t wrong = 0;
+    std::printf("%zu overrides, 1 lookup in 10 hits, writer every 0.5 ms\n", overrideCount);
+    std::printf("%7s | %14s %14s | %7s\n", "threads", "snapshot M/s", "locked M/s", "swaps");
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        const uint64_t versionBefore = table.Version();
+        const RunResult snapshot = Run(names, threads, ms,
+            [&](std::string_view name) { return table.Find(name); }, writeTable);
+        const RunResult mutexed = Run(names, threads, ms,
+            [&](std::string_view name) { return locked.Find(name); }, writeLocked);
+        wrong += snapshot.wrong + mutexed.wrong;
+        std::printf("%7zu | %14.2f %14.2f | %7zu\n", threads, snapshot.lookupsPerSecond * 1e-6,
+            mutexed.lookupsPerSecond * 1e-6, static_cast<size_t>(table.Version() - versionBefore));
+    }
+
+    // Retired snapshots are all reclaimable once the readers are gone
+    EpochDomain::Global().Reclaim();
+    wrong += EpochDomain::Global().PendingRetired();
+    std::printf("snapshot now %zu names, version %llu, %zu retired pending\n", table.Size(),
+        static_cast<unsigned long long>(table.Version()), EpochDomain::Global().PendingRetired());
+
+    if (wrong) std::printf("FAIL: %zu implausible lookups or unreclaimed snapshots\n", wrong);
+    return wrong ? 1 : 0;
+}
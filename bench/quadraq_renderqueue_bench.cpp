@@ -0,0 +1,186 @@
+// ====================================================================
+//                     quadraq_renderqueue_bench.cpp
+//     TGDK Quantum GPU Accelerator — Deferred Draw Queue Check
+//     Submits a synthetic multi-pass frame through a recording
+//     context: order against a stable-sort reference, pass and
+//     no-reorder boundaries, cull retention, binds saved, and the
+//     push / sort / submit cost per draw
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RenderQueue.hpp"
+#include "RecordingRenderContext.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+    using Call = RecordingRenderContext::Call;
+
+    GpuHandle FakeHandle(uint32_t kind, uint32_t index) {
+        return reinterpret_cast<GpuHandle>(static_cast<uintptr_t>(0x10000 * (kind + 1) + index * 16));
+    }
+
+    struct Frame {
+        std::vector<QueuedDraw> draws;
+        std::vector<uint32_t> groups;
+    };
+
+    // Shadow pass, opaque pass, then blended draws that must keep their
+    // order. startVertex carries the arrival index so submission can be
+    // traced back.
+    Frame MakeFrame(size_t count, std::mt19937& rng) {
+        Frame frame;
+        frame.draws.resize(count);
+        frame.groups.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            QueuedDraw& draw = frame.draws[i];
+            draw.vertexShader = FakeHandle(0, rng() % 24);
+            draw.pixelShader = FakeHandle(1, rng() % 48);
+            draw.texture = FakeHandle(2, rng() % 512);
+            draw.vertexBuffer = FakeHandle(3, rng() % 96);
+            draw.stride = 32;
+            draw.offset = (rng() % 4) * 1024;
+            draw.vertexCount = 36;
+            draw.startVertex = static_cast<uint32_t>(i);
+            draw.depth = static_cast<float>(rng() % 10000) / 10000.0f;
+
+            const size_t pass = i * 10 / count;
+            frame.groups[i] = pass < 2 ? 1 : pass < 9 ? 0 : RenderQueue::kNoReorder;
+        }
+        return frame;
+    }
+
+    // Arrival indices in the order the queue should submit them: stable
+    // by key inside each run of equal sort groups, kept draws only.
+    std::vector<uint32_t> ReferenceOrder(const Frame& frame, const std::vector<bool>& keep) {
+        std::vector<uint32_t> order;
+        std::vector<uint32_t> run;
+        auto flush = [&] {
+            std::stable_sort(run.begin(), run.end(), [&](uint32_t a, uint32_t b) {
+                return RenderQueue::MakeSortKey(frame.draws[a]) < RenderQueue::MakeSortKey(frame.draws[b]);
+            });
+            order.insert(order.end(), run.begin(), run.end());
+            run.clear();
+        };
+
+        for (size_t i = 0; i < frame.draws.size(); ++i) {
+            const uint32_t group = frame.groups[i];
+            if (i > 0 && (group == RenderQueue::kNoReorder || group != frame.groups[i - 1])) flush();
+            if (keep[i]) run.push_back(static_cast<uint32_t>(i));
+        }
+        flush();
+        return order;
+    }
+
+    // Mismatches between the recorded submission and `expected`, plus
+    // binds the log shows that the stats did not count
+    size_t CheckSubmission(const RecordingRenderContext& context, const RenderQueueStats& stats,
+        const std::vector<uint32_t>& expected) {
+        size_t errors = 0;
+        size_t drawn = 0;
+        for (const auto& command : context.Commands()) {
+            if (command.call != Call::Draw) continue;
+            errors += drawn >= expected.size() || command.b != expected[drawn];
+            ++drawn;
+        }
+        errors += drawn != expected.size();
+        errors += stats.draws != expected.size();
+        errors += stats.submittedBinds != context.BindCount();
+        errors += stats.submittedBinds > stats.arrivalBinds;
+        return errors;
+    }
+
+    void PushFrame(RenderQueue& queue, const Frame& frame) {
+        for (size_t i = 0; i < frame.draws.size(); ++i) queue.Push(frame.draws[i], frame.groups[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t draws = 50000;
+    size_t frames = 20;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--draws") == 0) draws = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    std::mt19937 rng(10);
+    const Frame frame = MakeFrame(draws, rng);
+    RenderQueue queue;
+    queue.Reserve(draws);
+    size_t errors = 0;
+
+    // Full frame
+    RecordingRenderContext recorder;
+    PushFrame(queue, frame);
+    queue.Sort();
+    const RenderQueueStats stats = queue.Submit(recorder);
+    errors += CheckSubmission(recorder, stats, ReferenceOrder(frame, std::vector<bool>(draws, true)));
+
+    // Every third draw culled before sorting
+    std::vector<bool> keep(draws);
+    std::vector<uint64_t> mask((draws + 63) / 64);
+    for (size_t i = 0; i < draws; ++i) {
+        keep[i] = i % 3 != 0;
+        if (keep[i]) mask[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+    recorder.Clear();
+    PushFrame(queue, frame);
+    queue.Retain(mask.data());
+    queue.Sort();
+    const RenderQueueStats culled = queue.Submit(recorder);
+    errors += CheckSubmission(recorder, culled, ReferenceOrder(frame, keep));
+
+    std::printf("%8s | %9s %9s %9s | %8s %9s %9s\n",
+        "draws", "arrival", "submitted", "avoided", "segments", "shader", "texture");
+    std::printf("%8zu | %9zu %9zu %9zu | %8zu %9zu %9zu\n", stats.draws,
+        stats.arrivalBinds, stats.submittedBinds, stats.BindsAvoided(), stats.segments,
+        stats.shaderBinds, stats.textureBinds);
+    std::printf("%8zu | %9zu %9zu %9zu | %8zu %9zu %9zu  (culled)\n", culled.draws,
+        culled.arrivalBinds, culled.submittedBinds, culled.BindsAvoided(), culled.segments,
+        culled.shaderBinds, culled.textureBinds);
+
+    // Costs, with the recorder only counting
+    RecordingRenderContext counter(false);
+    double push = 0.0, sort = 0.0, submit = 0.0;
+    for (size_t f = 0; f < frames; ++f) {
+        const Clock::time_point start = Clock::now();
+        PushFrame(queue, frame);
+        const Clock::time_point pushed = Clock::now();
+        queue.Sort();
+        const Clock::time_point sorted = Clock::now();
+        queue.Submit(counter);
+        const Clock::time_point submitted = Clock::now();
+
+        push += std::chrono::duration<double, std::nano>(pushed - start).count();
+        sort += std::chrono::duration<double, std::nano>(sorted - pushed).count();
+        submit += std::chrono::duration<double, std::nano>(submitted - sorted).count();
+    }
+
+    // What the sort replaces: std::stable_sort of the same keys
+    std::vector<std::pair<uint64_t, uint32_t>> keyed(draws);
+    double reference = 0.0;
+    for (size_t f = 0; f < frames; ++f) {
+        for (size_t i = 0; i < draws; ++i) keyed[i] = { RenderQueue::MakeSortKey(frame.draws[i]), static_cast<uint32_t>(i) };
+        const Clock::time_point start = Clock::now();
+        std::stable_sort(keyed.begin(), keyed.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+        reference += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    const double scale = 1.0 / (static_cast<double>(draws) * frames);
+    std::printf("ns per draw: push %.1f, sort %.1f (std::stable_sort %.1f), submit %.1f\n",
+        push * scale, sort * scale, reference * scale, submit * scale);
+
+    if (errors) std::printf("FAIL: %zu submission errors\n", errors);
+    return errors ? 1 : 0;
+}
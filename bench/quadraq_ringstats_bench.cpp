@@ -0,0 +1,109 @@
+// ====================================================================
+//                      quadraq_ringstats_bench.cpp
+//     TGDK Quantum GPU Accelerator — Sliding-Window Statistics Check
+//     RingStats against full recomputation over the same window:
+//     agreement after long runs, and cost per frame by window size
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RingStats.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    double Seconds(Clock::time_point since) {
+        return std::chrono::duration<double>(Clock::now() - since).count();
+    }
+
+    // Frame times around 16 ms with jitter and the odd hitch
+    std::vector<float> FrameTimes(size_t count) {
+        std::mt19937 rng(1);
+        std::normal_distribution<float> jitter(0.0f, 0.002f);
+        std::vector<float> samples(count);
+        for (size_t i = 0; i < count; ++i) {
+            float dt = 0.016f + jitter(rng);
+            if (rng() % 500 == 0) dt += 0.1f;
+            samples[i] = std::fmax(dt, 0.001f);
+        }
+        return samples;
+    }
+
+    // What the predictor did before RingStats: keep a deque, rescan it
+    void Recompute(const std::deque<float>& window, double& mean, double& variance) {
+        double sum = 0.0;
+        for (float sample : window) sum += sample;
+        mean = sum / window.size();
+
+        double squares = 0.0;
+        for (float sample : window) squares += (sample - mean) * (sample - mean);
+        variance = squares / window.size();
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t sampleCount = 200000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--samples") == 0) sampleCount = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    const std::vector<float> samples = FrameTimes(sampleCount);
+    const size_t windows[] = { 8, 120, 1024, 8192 };
+    size_t failures = 0;
+
+    for (size_t window : windows) {
+        QUADRAQ::RingStats stats(window);
+        std::deque<float> reference;
+        double worstMean = 0.0, worstVariance = 0.0;
+
+        // Agreement, checked on a stride so large windows stay quick
+        for (size_t i = 0; i < sampleCount; ++i) {
+            stats.Push(samples[i]);
+            reference.push_back(samples[i]);
+            if (reference.size() > window) reference.pop_front();
+            if (i % 97 != 0 && i + 1 != sampleCount) continue;
+
+            double mean, variance;
+            Recompute(reference, mean, variance);
+            worstMean = std::fmax(worstMean, std::fabs(stats.Mean() - mean) / mean);
+            worstVariance = std::fmax(worstVariance, std::fabs(stats.Variance() - variance) / std::fmax(variance, 1e-12));
+        }
+
+        // Cost per frame: push plus the mean and stddev the predictor reads
+        volatile float sink = 0.0f;       // keeps the loops from being optimized out
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < sampleCount; ++i) {
+            stats.Push(samples[i]);
+            sink = sink + stats.Mean() + stats.StdDev();
+        }
+        const double ring = Seconds(start) * 1e9 / sampleCount;
+
+        const size_t naiveCount = std::min<size_t>(sampleCount, 20000);
+        reference.clear();
+        start = Clock::now();
+        for (size_t i = 0; i < naiveCount; ++i) {
+            reference.push_back(samples[i]);
+            if (reference.size() > window) reference.pop_front();
+            double mean, variance;
+            Recompute(reference, mean, variance);
+            sink = sink + static_cast<float>(mean + std::sqrt(variance));
+        }
+        const double naive = Seconds(start) * 1e9 / naiveCount;
+
+        const bool ok = worstMean < 1e-4 && worstVariance < 1e-3;
+        failures += ok ? 0 : 1;
+        std::printf("window %5zu | RingStats %7.1f ns/frame | recompute %10.1f ns/frame | worst error mean %.1e var %.1e%s\n",
+            window, ring, naive, worstMean, worstVariance, ok ? "" : "  FAIL");
+    }
+
+    return failures ? 1 : 0;
+}
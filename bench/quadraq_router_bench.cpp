@@ -0,0 +1,230 @@
+// ====================================================================
+//                       quadraq_router_bench.cpp
+//     TGDK Quantum GPU Accelerator — Per-Draw Routing Overhead
+//     Cost of the suppression decision at 1k / 10k / 100k draws a
+//     frame: per-draw mask load, batch evaluation, history-aware check,
+//     and the locked per-draw evaluation the frame policy replaced.
+//     Batches of any length agree with the per-draw verdicts, and
+//     SubmitDrawBatch draws exactly the surviving draws
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "QuantumDrawRouter.hpp"
+#include "EntropyPredictor.hpp"
+#include "RecordingRenderContext.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using QuantumDrawRouter::DrawCategory;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Stand-in for the backend the router used to ask on every draw
+    struct Backend {
+        virtual ~Backend() = default;
+        virtual bool ShouldSuppressDraw(float entropy) { return entropy > 1.0f; }
+    };
+
+    template <typename Frame>
+    double NanosecondsPerDraw(size_t draws, size_t frames, Frame frame) {
+        const Clock::time_point start = Clock::now();
+        for (size_t f = 0; f < frames; ++f) frame();
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (draws * frames);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t maxDraws = 100000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--max-draws") == 0) maxDraws = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    // Transparent and PostProcess draws are suppressed every frame
+    const uint32_t suppressed = QuantumDrawRouter::CategoryBit(DrawCategory::Transparent) |
+        QuantumDrawRouter::CategoryBit(DrawCategory::PostProcess);
+    EntropyPredictor::Initialize();
+    QuantumDrawRouter::EnableRouting(true);
+    QuantumDrawRouter::SetSuppressibleCategories(suppressed);
+    QuantumDrawRouter::SetEntropyThreshold(-1.0f);
+    QuantumDrawRouter::BeginFrame();
+
+    std::mt19937 rng(8);
+    std::vector<DrawCategory> categories(maxDraws);
+    std::vector<uint64_t> signatures(maxDraws);
+    for (size_t i = 0; i < maxDraws; ++i) {
+        categories[i] = static_cast<DrawCategory>(rng() % static_cast<uint32_t>(DrawCategory::Count));
+        signatures[i] = (static_cast<uint64_t>(rng()) << 32) | rng() | 1;
+    }
+
+    std::mutex routerMutex;
+    Backend backend;
+    Backend* backendPtr = &backend;
+    std::vector<uint64_t> mask((maxDraws + 63) / 64);
+    volatile size_t sink = 0;
+    size_t mismatches = 0;
+
+    // --- Batch verdicts and submission, lengths on and off 64-draw words ---
+    {
+        using QUADRAQ::RecordingRenderContext;
+        const size_t lengths[] = { 1, 63, 64, 65, 127, 1000, 4097 };
+        const uint32_t policies[] = { suppressed, 0u, QuantumDrawRouter::AllCategories };
+        int buffers[8];
+        size_t batches = 0, drawn = 0, wrong = 0;
+
+        for (uint32_t policy : policies) {
+            QuantumDrawRouter::SetSuppressibleCategories(policy);
+            for (size_t count : lengths) {
+                if (count > maxDraws) continue;
+                const size_t words = (count + 63) / 64;
+
+                // Stale bits past the last draw must not survive the call
+                std::vector<uint64_t> batchMask(words, ~0ull);
+                QuantumDrawRouter::EvaluateDrawBatch(categories.data(), count, batchMask.data());
+                for (size_t i = 0; i < words * 64; ++i) {
+                    const bool survives = (batchMask[i >> 6] >> (i & 63)) & 1;
+                    wrong += i < count ? survives == QuantumDrawRouter::ShouldSuppressDraw(categories[i]) : survives;
+                }
+
+                std::vector<QUADRAQ::GpuHandle> vertexBuffers(count);
+                std::vector<uint32_t> strides(count), offsets(count), vertexCounts(count), startVertices(count);
+                std::vector<uint64_t> visible(words, 0);
+                for (size_t i = 0; i < count; ++i) {
+                    vertexBuffers[i] = rng() % 16 ? &buffers[rng() % 8] : nullptr;
+                    strides[i] = 16 + 4 * (rng() % 4);
+                    offsets[i] = 64 * (rng() % 4);
+                    vertexCounts[i] = rng() % 16 ? 3 + rng() % 300 : 0;
+                    startVertices[i] = rng() % 1000;
+                    if (rng() % 4) visible[i >> 6] |= 1ull << (i & 63);
+                }
+
+                for (int variant = 0; variant < 2; ++variant) {
+                    QuantumDrawRouter::DrawBatch batch;
+                    batch.count = count;
+                    batch.categories = categories.data();
+                    batch.vertexBuffers = vertexBuffers.data();
+                    batch.strides = strides.data();
+                    batch.offsets = offsets.data();
+                    batch.vertexCounts = vertexCounts.data();
+                    batch.startVertices = startVertices.data();
+                    if (variant == 1) {
+                        batch.signatures = signatures.data();
+                        batch.visibleMask = visible.data();
+                    }
+
+                    // Reference: the per-draw check, with AttemptDraw's fingerprint by default
+                    std::vector<uint32_t> expected;
+                    for (size_t i = 0; i < count; ++i) {
+                        const uint64_t signature = batch.signatures ? signatures[i] :
+                            QUADRAQ::DrawSignatureTable::Fingerprint(vertexBuffers[i], strides[i], offsets[i], nullptr, nullptr, nullptr);
+                        const bool shown = !batch.visibleMask || ((visible[i >> 6] >> (i & 63)) & 1);
+                        if (shown && !QuantumDrawRouter::ShouldSuppressDraw(categories[i], signature))
+                            expected.push_back(static_cast<uint32_t>(i));
+                    }
+
+                    RecordingRenderContext recorder;
+                    std::vector<uint32_t> survivors(count);
+                    survivors.resize(QuantumDrawRouter::SubmitDrawBatch(&recorder, batch, survivors.data()));
+                    wrong += survivors != expected;
+
+                    // Each drawable survivor once, in order, with its own buffer bound
+                    size_t next = 0;
+                    QUADRAQ::GpuHandle bound = nullptr;
+                    uint32_t boundStride = 0, boundOffset = 0;
+                    for (const RecordingRenderContext::Command& command : recorder.Commands()) {
+                        if (command.call == RecordingRenderContext::Call::SetVertexBuffer) {
+                            bound = command.handle;
+                            boundStride = command.a;
+                            boundOffset = command.b;
+                            continue;
+                        }
+                        if (command.call != RecordingRenderContext::Call::Draw) continue;
+                        while (next < expected.size() && (!vertexBuffers[expected[next]] || !vertexCounts[expected[next]])) ++next;
+                        if (next == expected.size()) {
+                            ++wrong;
+                            break;
+                        }
+                        const uint32_t draw = expected[next++];
+                        wrong += bound != vertexBuffers[draw] || boundStride != strides[draw] || boundOffset != offsets[draw];
+                        wrong += command.a != vertexCounts[draw] || command.b != startVertices[draw];
+                        ++drawn;
+                    }
+                    while (next < expected.size() && (!vertexBuffers[expected[next]] || !vertexCounts[expected[next]])) ++next;
+                    wrong += next != expected.size();
+
+                    // Without a context the survivors are the same and nothing is drawn
+                    std::vector<uint32_t> listed(count);
+                    listed.resize(QuantumDrawRouter::SubmitDrawBatch(nullptr, batch, listed.data()));
+                    wrong += listed != expected;
+                    ++batches;
+                }
+            }
+        }
+        QuantumDrawRouter::SetSuppressibleCategories(suppressed);
+        mismatches += wrong;
+        std::printf("batches: %zu of %zu to %zu draws, %zu draws submitted, %zu disagree with the per-draw check\n",
+            batches, lengths[0], lengths[sizeof(lengths) / sizeof(lengths[0]) - 1], drawn, wrong);
+    }
+
+    std::printf("%8s | %9s %9s %9s %9s | %s\n", "draws", "mask", "batch", "history", "locked", "ns per draw");
+    for (size_t draws = 1000; draws <= maxDraws; draws *= 10) {
+        const size_t frames = std::max<size_t>(1, 2000000 / draws);
+
+        // Answers agree before anything is timed
+        QuantumDrawRouter::EvaluateDrawBatch(categories.data(), draws, mask.data());
+        for (size_t i = 0; i < draws; ++i) {
+            const bool expected = (suppressed >> static_cast<uint32_t>(categories[i])) & 1u;
+            const bool survives = (mask[i >> 6] >> (i & 63)) & 1;
+            mismatches += QuantumDrawRouter::ShouldSuppressDraw(categories[i]) != expected;
+            mismatches += QuantumDrawRouter::ShouldSuppressDraw(categories[i], signatures[i]) != expected;
+            mismatches += survives == expected;
+        }
+
+        const double perDraw = NanosecondsPerDraw(draws, frames, [&] {
+            size_t kept = 0;
+            for (size_t i = 0; i < draws; ++i) kept += !QuantumDrawRouter::ShouldSuppressDraw(categories[i]);
+            sink = kept;
+        });
+        const double batch = NanosecondsPerDraw(draws, frames, [&] {
+            sink = QuantumDrawRouter::EvaluateDrawBatch(categories.data(), draws, mask.data());
+        });
+        const double history = NanosecondsPerDraw(draws, frames, [&] {
+            size_t kept = 0;
+            for (size_t i = 0; i < draws; ++i) kept += !QuantumDrawRouter::ShouldSuppressDraw(categories[i], signatures[i]);
+            sink = kept;
+        });
+        // Before the frame policy: lock, read the predictor, ask the backend
+        const double locked = NanosecondsPerDraw(draws, frames, [&] {
+            size_t kept = 0;
+            for (size_t i = 0; i < draws; ++i) {
+                std::lock_guard<std::mutex> lock(routerMutex);
+                const float entropy = EntropyPredictor::GetCurrentEntropyRate();
+                const bool suppress = backendPtr->ShouldSuppressDraw(entropy) || entropy > -1.0f;
+                kept += !(suppress && ((suppressed >> static_cast<uint32_t>(categories[i])) & 1u));
+            }
+            sink = kept;
+        });
+
+        std::printf("%8zu | %9.2f %9.2f %9.2f %9.2f |\n", draws, perDraw, batch, history, locked);
+    }
+
+    // The history-aware check on a frame that suppresses nothing
+    QuantumDrawRouter::SetEntropyThreshold(1.0f);
+    QuantumDrawRouter::BeginFrame();
+    const double idle = NanosecondsPerDraw(maxDraws, 20, [&] {
+        size_t kept = 0;
+        for (size_t i = 0; i < maxDraws; ++i) kept += !QuantumDrawRouter::ShouldSuppressDraw(categories[i], signatures[i]);
+        sink = kept;
+    });
+    std::printf("history-aware check with nothing suppressed: %.2f ns per draw\n", idle);
+
+    if (mismatches) std::printf("FAIL: %zu verdicts disagree\n", mismatches);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,237 @@
+// ====================================================================
+//                        quadraq_shader_bench.cpp
+//     TGDK Quantum GPU Accelerator — Shader Registry Check
+//     ShaderRegistry and QualityShaderTable over a fake device whose
+//     shaders count their references: the same bytecode registered
+//     twice is held as one object, per-level resolution picks the right
+//     replacement, and shaders resolved while the table is being
+//     replaced or cleared are never ones already released
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "ShaderRegistry.hpp"
+#include "QualityShaderTable.hpp"
+#include "Hash.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct FakeShader {
+        uint64_t contentHash;
+        std::atomic<int> references{ 1 };      // the creator's
+        std::atomic<bool> destroyed{ false };
+
+        explicit FakeShader(uint64_t contentHash) : contentHash(contentHash) {}
+    };
+
+    // Like CreatePixelShader: a new object per call, even for the same
+    // bytecode. Objects are kept after their last release so a late
+    // reference shows up as a use of a destroyed shader.
+    class FakeShaderDevice : public IHandleOwner {
+    public:
+        FakeShader* Create(const std::string& bytecode) {
+            return &shaders.emplace_back(Fnv1a64(bytecode.data(), bytecode.size()));
+        }
+
+        void Retain(GpuHandle handle) override {
+            FakeShader* shader = static_cast<FakeShader*>(handle);
+            if (shader->references.fetch_add(1, std::memory_order_relaxed) == 0) ++revived;
+        }
+
+        void Release(GpuHandle handle) override {
+            FakeShader* shader = static_cast<FakeShader*>(handle);
+            const int before = shader->references.fetch_sub(1, std::memory_order_acq_rel);
+            if (before == 1) shader->destroyed.store(true, std::memory_order_release);
+            else if (before <= 0) ++overReleased;
+        }
+
+        size_t Live() const {
+            size_t live = 0;
+            for (const FakeShader& shader : shaders) live += !shader.destroyed.load(std::memory_order_acquire);
+            return live;
+        }
+
+        std::atomic<size_t> revived{ 0 }, overReleased{ 0 };
+
+    private:
+        std::deque<FakeShader> shaders;     // stable addresses; created by one thread
+    };
+}
+
+int main(int argc, char** argv) {
+    int ms = 200;
+    size_t readers = 3;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--ms") == 0) ms = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--readers") == 0) readers = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    size_t errors = 0;
+
+    // --- Same bytecode twice: one refcounted object ---
+    {
+        FakeShaderDevice device;
+        ShaderRegistry registry(device);
+        const std::string bytecode(512, 'a');
+        const GpuHandle originals[] = { device.Create("game-0"), device.Create("game-1") };
+
+        FakeShader* first = device.Create(bytecode);
+        FakeShader* second = device.Create(bytecode);
+        const GpuHandle a = registry.SetOverride(1, originals[0], first, first->contentHash, bytecode.size());
+        const GpuHandle b = registry.SetOverride(2, originals[1], second, second->contentHash, bytecode.size());
+        device.Release(first);
+        device.Release(second);
+
+        const ShaderRegistryStats stats = registry.Stats();
+        errors += a != first || b != first;
+        errors += stats.shaders != 1 || stats.deduplicated != 1 || stats.bytecodeBytes != bytecode.size();
+        errors += first->references.load() != 1 || !second->destroyed.load();
+
+        // The cached-shader path finds it by content and hands out a reference
+        const GpuHandle cached = registry.FindByContent(first->contentHash);
+        errors += cached != first;
+        device.Retain(cached);
+        errors += first->references.load() != 2;
+        device.Release(cached);
+
+        // Held until its last override goes
+        registry.RemoveOverride(1, originals[0]);
+        errors += first->destroyed.load();
+        registry.RemoveOverride(2, originals[1]);
+        errors += !first->destroyed.load() || registry.Stats().released != 1;
+        errors += device.revived.load() + device.overReleased.load();
+        std::printf("dedup: two objects from one bytecode held as one, released with its last override\n");
+    }
+
+    // --- Per-level resolution ---
+    {
+        FakeShaderDevice device;
+        QualityShaderTable table(device);
+        // The game's shaders; a level that leaves one alone hands it back retained
+        FakeShader* game[] = { device.Create("game-0"), device.Create("game-1") };
+        FakeShader* reduced = device.Create("reduced");
+        FakeShader* catchAll = device.Create("minimal-all");
+        FakeShader* flat = device.Create("flat");
+        table.Register(ShaderQuality::Reduced, game[0], reduced);
+        table.Register(ShaderQuality::Minimal, nullptr, catchAll);
+        table.Register(ShaderQuality::Flat, game[0], flat);
+        table.Register(ShaderQuality::Full, game[1], flat);         // ignored
+
+        struct Case {
+            ShaderQuality level;
+            FakeShader* original;
+            FakeShader* expected;
+        };
+        const Case cases[] = {
+            { ShaderQuality::Full, game[0], game[0] },
+            { ShaderQuality::Full, game[1], game[1] },
+            { ShaderQuality::Reduced, game[0], reduced },
+            { ShaderQuality::Reduced, game[1], game[1] },
+            { ShaderQuality::Minimal, game[0], catchAll },          // the catch-all hides Reduced's
+            { ShaderQuality::Minimal, game[1], catchAll },
+            { ShaderQuality::Flat, game[0], flat },                 // its own wins
+            { ShaderQuality::Flat, game[1], catchAll },
+            { ShaderQuality::Minimal, nullptr, catchAll },
+            { ShaderQuality::Reduced, nullptr, nullptr },
+        };
+        for (const Case& c : cases) {
+            const int before = c.expected ? c.expected->references.load() : 0;
+            const GpuHandle resolved = table.Resolve(c.level, c.original);
+            errors += resolved != c.expected;
+            if (!resolved) continue;
+            errors += c.expected->references.load() != before + 1;
+            device.Release(resolved);
+        }
+        errors += table.Registrations() != 3;
+
+        for (FakeShader* shader : { reduced, catchAll, flat }) device.Release(shader);
+        errors += device.Live() != 5;
+        table.Clear();
+        EpochDomain::Global().Reclaim();
+        for (FakeShader* shader : game) device.Release(shader);
+        errors += device.Live() != 0 || device.revived.load() + device.overReleased.load() != 0;
+        std::printf("levels: %zu lookups resolved as registered\n", sizeof(cases) / sizeof(cases[0]));
+    }
+
+    // --- Readers resolving while the table is replaced and cleared ---
+    {
+        FakeShaderDevice device;
+        ShaderRegistry registry(device);
+        QualityShaderTable table(device);
+        FakeShader* original = device.Create("game");
+
+        std::atomic<bool> stop{ false };
+        std::atomic<size_t> resolved{ 0 }, dead{ 0 };
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < readers; ++t) {
+            threads.emplace_back([&, t] {
+                size_t count = 0, bad = 0;
+                uint32_t level = static_cast<uint32_t>(t);
+                while (!stop.load(std::memory_order_relaxed)) {
+                    level = level % 3 + 1;
+                    const GpuHandle shader = table.Resolve(static_cast<ShaderQuality>(level), level == 2 ? nullptr : original);
+                    if (!shader) continue;
+                    if (shader != original) {
+                        bad += static_cast<FakeShader*>(shader)->destroyed.load(std::memory_order_acquire);
+                        ++count;
+                    }
+                    device.Release(shader);
+                }
+                resolved += count;
+                dead += bad;
+            });
+        }
+
+        std::mt19937 rng(20);
+        size_t registrations = 0, clears = 0;
+        const Clock::time_point start = Clock::now();
+        while (Clock::now() - start < std::chrono::milliseconds(ms)) {
+            // A few bytecodes recur, so some registrations deduplicate
+            FakeShader* created = device.Create("bytecode-" + std::to_string(rng() % 6));
+            const ShaderQuality level = static_cast<ShaderQuality>(1 + rng() % 3);
+            const GpuHandle target = rng() % 4 == 0 ? nullptr : original;
+            const uint32_t set = static_cast<uint32_t>(level);
+
+            // Same order as ShaderOverrideUnit::RegisterQualityShader
+            const GpuHandle canonical = registry.SetOverride(set, target, created, created->contentHash, 64);
+            table.Register(level, target, canonical);
+            device.Release(created);
+            ++registrations;
+
+            if (rng() % 16 == 0) {
+                table.Clear();
+                for (uint32_t s = 1; s < static_cast<uint32_t>(ShaderQuality::Count); ++s) registry.ClearSet(s);
+                ++clears;
+            }
+        }
+        stop = true;
+        for (std::thread& thread : threads) thread.join();
+
+        table.Clear();
+        registry.Clear();
+        EpochDomain::Global().Reclaim();
+        errors += original->references.load() != 1;
+        device.Release(original);
+        errors += dead.load() + device.revived.load() + device.overReleased.load();
+        errors += device.Live() != 0 || resolved.load() == 0;
+        std::printf("replace: %zu registrations, %zu clears, %zu resolves from %zu readers, %zu dead, %zu leaked\n",
+            registrations, clears, resolved.load(), readers, dead.load(), device.Live());
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
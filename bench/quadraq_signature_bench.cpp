@@ -0,0 +1,213 @@
+// ====================================================================
+//                      quadraq_signature_bench.cpp
+//     TGDK Quantum GPU Accelerator — Draw History Check
+//     DrawSignatureTable stays at its capacity under any number of
+//     signatures, evicts the least recently seen candidate, ages
+//     entries out in fixed per-frame slices and folds impact reports;
+//     the router's batch verdicts match its per-draw ones with history
+//     reported from another thread. Also reports Touch() cost
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "DrawSignatureTable.hpp"
+#include "QuantumDrawRouter.hpp"
+#include "EntropyPredictor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace QUADRAQ;
+using QuantumDrawRouter::DrawCategory;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t RandomSignature(std::mt19937_64& rng) {
+        const uint64_t s = rng();
+        return s ? s : 1;
+    }
+
+    bool Bit(const std::vector<uint64_t>& mask, size_t i) { return (mask[i >> 6] >> (i & 63)) & 1; }
+}
+
+int main(int argc, char** argv) {
+    size_t capacity = 4096;
+    size_t draws = 10000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--capacity") == 0) capacity = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--draws") == 0) draws = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    size_t errors = 0;
+    std::mt19937_64 rng(13);
+
+    // --- Bounded: capacity rounds up and never grows ---
+    {
+        DrawSignatureTable table(capacity - 1);
+        const size_t size = table.Stats().capacity;
+        errors += size < capacity - 1 || (size & (size - 1)) != 0;
+
+        // A quarter full: everything stays, nothing evicted
+        std::vector<uint64_t> kept;
+        for (size_t i = 0; i < size / 4; ++i) kept.push_back(RandomSignature(rng));
+        for (uint64_t signature : kept) table.Touch(signature);
+        for (uint64_t signature : kept) errors += table.Find(signature) == nullptr;
+        errors += table.Stats().occupied != kept.size() || table.Stats().evictions != 0;
+
+        // Half full: the two windows absorb nearly all of it
+        for (size_t i = size / 4; i < size / 2; ++i) table.Touch(RandomSignature(rng));
+        const uint64_t halfEvictions = table.Stats().evictions;
+        errors += halfEvictions > size / 200 + 1;
+
+        // Far more signatures than slots, timed
+        const size_t flood = size * 8;
+        const Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < flood; ++i) table.Touch(RandomSignature(rng));
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / flood;
+
+        const DrawSignatureStats stats = table.Stats();
+        errors += stats.capacity != size || stats.occupied > size;
+        errors += stats.inserts != size / 2 + flood;
+        errors += stats.occupied + stats.evictions != stats.inserts;
+        errors += stats.evictions == 0;
+
+        // Hits reuse their slot
+        const uint64_t fresh = RandomSignature(rng);
+        const DrawHistory* first = table.Touch(fresh);
+        errors += table.Touch(fresh) != first || table.Stats().inserts != stats.inserts + 1;
+        std::printf("bounded: %zu slots, %llu evicted at half load; %llu inserts, %zu occupied (%.0f%%), %llu evicted, %.1f ns per touch\n",
+            size, static_cast<unsigned long long>(halfEvictions), static_cast<unsigned long long>(stats.inserts),
+            stats.occupied, 100.0 * stats.occupied / size,
+            static_cast<unsigned long long>(stats.evictions), ns);
+    }
+
+    // --- Eviction: a full probe window loses its least recently seen entry ---
+    {
+        DrawSignatureTable table(64, 1000);
+        // Same low-bits home and same high-bits home for all of them
+        auto colliding = [](uint64_t k) { return ((32 + k * 64) << 32) | (k * 64); };
+        for (uint64_t k = 0; k < DrawSignatureTable::kProbeLimit; ++k) {
+            table.AdvanceFrame(static_cast<uint32_t>(k + 1));
+            table.Touch(colliding(k));
+        }
+        table.AdvanceFrame(20);
+        table.Touch(colliding(0));                          // 0 is now the newest
+        table.Touch(colliding(DrawSignatureTable::kProbeLimit));
+        errors += table.Stats().evictions != 1;
+        errors += table.Find(colliding(1)) != nullptr;      // seen at frame 2, the oldest left
+        for (uint64_t k = 0; k <= DrawSignatureTable::kProbeLimit; ++k)
+            errors += k != 1 && table.Find(colliding(k)) == nullptr;
+        std::printf("eviction: window of %zu, evicted the entry last seen at frame 2\n", DrawSignatureTable::kProbeLimit);
+    }
+
+    // --- Aging: idle entries expire within maxAge + one sweep, live ones stay ---
+    {
+        const uint32_t maxAge = 10;
+        DrawSignatureTable table(256, maxAge);
+        const uint64_t idle = RandomSignature(rng), live = RandomSignature(rng);
+        table.AdvanceFrame(1);
+        table.Touch(idle);
+        table.Touch(live);
+
+        // Whole table swept every 64 frames, a fixed slice each
+        uint32_t expiredAt = 0;
+        for (uint32_t frame = 2; frame <= 1 + maxAge + 64 + 1; ++frame) {
+            table.AdvanceFrame(frame);
+            table.Touch(live);
+            if (!expiredAt && !table.Find(idle)) expiredAt = frame;
+        }
+        errors += expiredAt == 0 || expiredAt <= 1 + maxAge;
+        errors += table.Find(live) == nullptr || table.Find(live)->framesSeen != 1 + maxAge + 64 + 1;
+        errors += table.Stats().expired != 1 || table.Stats().occupied != 1;
+        std::printf("aging: max age %u, idle entry expired at frame %u, live entry seen %u frames\n",
+            maxAge, expiredAt, table.Find(live) ? table.Find(live)->framesSeen : 0);
+
+        // Contribution is averaged, flags accumulate
+        table.ReportImpact(live, 1.0f, DrawImpact::Visible);
+        table.ReportImpact(live, 1.0f, DrawImpact::Critical);
+        const DrawHistory* history = table.Find(live);
+        errors += std::fabs(history->contribution - 0.4375f) > 1e-6f;
+        errors += history->impactFlags != (DrawImpact::Visible | DrawImpact::Critical);
+
+        table.Clear();
+        errors += table.Find(live) != nullptr || table.Stats().occupied != 0;
+        errors += DrawSignatureTable::Fingerprint(nullptr, 0, 0, nullptr, nullptr, nullptr) == 0;
+    }
+
+    // --- Router: batch and per-draw verdicts agree with history reported concurrently ---
+    {
+        const uint32_t suppressed = QuantumDrawRouter::CategoryBit(DrawCategory::Transparent) |
+            QuantumDrawRouter::CategoryBit(DrawCategory::Shadow);
+        EntropyPredictor::Initialize();
+        QuantumDrawRouter::EnableRouting(true);
+        QuantumDrawRouter::SetSuppressibleCategories(suppressed);
+        QuantumDrawRouter::SetEntropyThreshold(-1.0f);
+        QuantumDrawRouter::SetContributionFloor(0.5f);
+        QuantumDrawRouter::BeginFrame();
+
+        // Includes a partial last word; the suppressed draws' history stays
+        // well inside the router's table, so nothing reported is evicted
+        const size_t count = std::min<size_t>(draws, 4000) | 37;
+        std::vector<DrawCategory> categories(count);
+        std::vector<uint64_t> signatures(count);
+        for (size_t i = 0; i < count; ++i) {
+            categories[i] = static_cast<DrawCategory>(rng() % static_cast<uint32_t>(DrawCategory::Count));
+            signatures[i] = RandomSignature(rng);
+        }
+
+        // A backend thread flags every fifth suppressed draw Critical and
+        // gives every seventh a high contribution while the render thread
+        // keeps checking
+        std::atomic<bool> reported{ false };
+        std::thread backend([&] {
+            for (size_t i = 0; i < count; ++i) {
+                if (!((suppressed >> static_cast<uint32_t>(categories[i])) & 1u)) continue;
+                if (i % 5 == 0) QuantumDrawRouter::ReportDrawImpact(signatures[i], 0.0f, DrawImpact::Critical);
+                else if (i % 7 == 0) {
+                    for (int k = 0; k < 8; ++k) QuantumDrawRouter::ReportDrawImpact(signatures[i], 1.0f, DrawImpact::Visible);
+                }
+            }
+            reported = true;
+        });
+        std::vector<uint64_t> mask((count + 63) / 64);
+        while (!reported) QuantumDrawRouter::EvaluateDrawBatch(categories.data(), signatures.data(), count, mask.data());
+        backend.join();
+
+        const size_t survivors = QuantumDrawRouter::EvaluateDrawBatch(categories.data(), signatures.data(), count, mask.data());
+        size_t disagree = 0, expectedSurvivors = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const bool inSuppressed = (suppressed >> static_cast<uint32_t>(categories[i])) & 1u;
+            const bool expected = inSuppressed && i % 5 != 0 && i % 7 != 0;
+            expectedSurvivors += !expected;
+            disagree += Bit(mask, i) == expected;
+            disagree += QuantumDrawRouter::ShouldSuppressDraw(categories[i], signatures[i]) != expected;
+        }
+        for (size_t w = count / 64; w < mask.size(); ++w) disagree += (mask[w] >> (count & 63)) != 0;
+        disagree += survivors != expectedSurvivors;
+
+        // No signatures: the plain category verdict
+        std::vector<uint64_t> plain((count + 63) / 64);
+        QuantumDrawRouter::EvaluateDrawBatch(categories.data(), nullptr, count, plain.data());
+        for (size_t i = 0; i < count; ++i)
+            disagree += Bit(plain, i) == bool((suppressed >> static_cast<uint32_t>(categories[i])) & 1u);
+
+        QuantumDrawRouter::BeginFrame();
+        QuantumDrawRouter::ShouldSuppressDraw(DrawCategory::Transparent, signatures[0]);
+        errors += disagree;
+        errors += QuantumDrawRouter::GetSignatureStats().occupied == 0;
+        std::printf("router: %zu draws, %zu survive, %zu verdicts disagree between batch and per-draw\n",
+            count, survivors, disagree);
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
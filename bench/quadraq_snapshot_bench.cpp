@@ -0,0 +1,166 @@
+// ====================================================================
+//                      quadraq_snapshot_bench.cpp
+//     TGDK Quantum GPU Accelerator — Snapshot Publication Check
+//     Readers race a publishing writer: no torn or backward reads from
+//     SeqLock or EntropyPredictor::GetSnapshot(), and the read cost
+//     against the mutex-guarded copy it replaced
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "SeqLock.hpp"
+#include "EntropyPredictor.hpp"
+#include "FrameClock.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Every word carries the same publication number, so a torn read shows
+    struct Payload {
+        uint64_t words[6];
+    };
+
+    struct ReaderResult {
+        uint64_t reads = 0;
+        uint64_t torn = 0;
+        uint64_t backwards = 0;
+    };
+
+    template <typename Read>
+    double NanosecondsPerRead(size_t count, Read read) {
+        const Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < count; ++i) read();
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / count;
+    }
+}
+
+int main(int argc, char** argv) {
+    int durationMs = 500;
+    size_t readerCount = 3;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--ms") == 0) durationMs = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--readers") == 0) readerCount = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    bool ok = true;
+
+    // --- SeqLock: one writer publishing as fast as it can ---
+    {
+        QUADRAQ::SeqLock<Payload> lock;
+        std::atomic<bool> stop{ false };
+        std::vector<ReaderResult> results(readerCount);
+        std::vector<std::thread> readers;
+
+        for (size_t r = 0; r < readerCount; ++r) {
+            readers.emplace_back([&, r] {
+                ReaderResult& result = results[r];
+                uint64_t last = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    const Payload payload = lock.Load();
+                    ++result.reads;
+                    for (uint64_t word : payload.words) result.torn += word != payload.words[0];
+                    result.backwards += payload.words[0] < last;
+                    last = payload.words[0];
+                }
+            });
+        }
+
+        uint64_t published = 0;
+        const Clock::time_point end = Clock::now() + std::chrono::milliseconds(durationMs);
+        while (Clock::now() < end) {
+            Payload payload;
+            ++published;
+            for (uint64_t& word : payload.words) word = published;
+            lock.Store(payload);
+        }
+        stop = true;
+        for (std::thread& reader : readers) reader.join();
+
+        ReaderResult total;
+        for (const ReaderResult& result : results) {
+            total.reads += result.reads;
+            total.torn += result.torn;
+            total.backwards += result.backwards;
+        }
+        std::printf("SeqLock      %llu publications, %llu reads from %zu threads: %llu torn, %llu backwards\n",
+            static_cast<unsigned long long>(published), static_cast<unsigned long long>(total.reads), readerCount,
+            static_cast<unsigned long long>(total.torn), static_cast<unsigned long long>(total.backwards));
+        ok &= total.torn == 0 && total.backwards == 0;
+    }
+
+    // --- EntropyPredictor: UpdateCycle() on a virtual clock vs GetSnapshot() ---
+    {
+        FrameClock::SetVirtual(true);
+        EntropyPredictor::Initialize();
+        EntropyPredictor::SetEnabled(true);
+
+        std::atomic<bool> stop{ false };
+        std::vector<ReaderResult> results(readerCount);
+        std::vector<std::thread> readers;
+
+        // Frame times alternate 10 / 30 ms, so any window mean lies between
+        for (size_t r = 0; r < readerCount; ++r) {
+            readers.emplace_back([&, r] {
+                ReaderResult& result = results[r];
+                uint64_t last = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    const EntropyPredictor::Snapshot snapshot = EntropyPredictor::GetSnapshot();
+                    ++result.reads;
+                    result.backwards += snapshot.frameIndex < last;
+                    result.torn += snapshot.frameIndex != 0 &&
+                        (snapshot.meanFrameTime < 0.0099f || snapshot.meanFrameTime > 0.0301f);
+                    last = snapshot.frameIndex;
+                }
+            });
+        }
+
+        uint64_t frames = 0;
+        const Clock::time_point end = Clock::now() + std::chrono::milliseconds(durationMs);
+        while (Clock::now() < end) {
+            FrameClock::Advance(frames % 2 ? 30000000ull : 10000000ull);
+            EntropyPredictor::UpdateCycle();
+            ++frames;
+        }
+        stop = true;
+        for (std::thread& reader : readers) reader.join();
+
+        ReaderResult total;
+        for (const ReaderResult& result : results) {
+            total.reads += result.reads;
+            total.torn += result.torn;
+            total.backwards += result.backwards;
+        }
+        std::printf("GetSnapshot  %llu frames, %llu reads from %zu threads: %llu inconsistent, %llu backwards\n",
+            static_cast<unsigned long long>(frames), static_cast<unsigned long long>(total.reads), readerCount,
+            static_cast<unsigned long long>(total.torn), static_cast<unsigned long long>(total.backwards));
+        ok &= total.torn == 0 && total.backwards == 0;
+    }
+
+    // --- Uncontended read cost ---
+    {
+        std::mutex mutex;
+        EntropyPredictor::Snapshot guarded;
+        volatile float sink = 0.0f;
+
+        const size_t count = 2000000;
+        const double seqlock = NanosecondsPerRead(count, [&] { sink = sink + EntropyPredictor::GetSnapshot().meanFrameTime; });
+        const double locked = NanosecondsPerRead(count, [&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            const EntropyPredictor::Snapshot copy = guarded;
+            sink = sink + copy.meanFrameTime;
+        });
+        std::printf("read cost    GetSnapshot %.1f ns, mutex-guarded copy %.1f ns\n", seqlock, locked);
+    }
+
+    if (!ok) std::printf("FAIL: readers saw an inconsistent snapshot\n");
+    return ok ? 0 : 1;
+}
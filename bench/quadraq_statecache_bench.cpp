@@ -0,0 +1,169 @@
+// ====================================================================
+//                      quadraq_statecache_bench.cpp
+//     TGDK Quantum GPU Accelerator — Redundant Bind Elimination Check
+//     Replays an engine-style bind stream directly and through the
+//     state cache, checks that every draw sees the same pipeline state,
+//     and reports binds dropped and the per-call cost
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "StateCache.hpp"
+#include "RecordingRenderContext.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+    using Call = RecordingRenderContext::Call;
+
+    GpuHandle FakeHandle(uint32_t kind, uint32_t index) {
+        return reinterpret_cast<GpuHandle>(static_cast<uintptr_t>(0x10000 * (kind + 1) + index * 16));
+    }
+
+    // Pipeline state a command log leaves behind
+    struct DeviceState {
+        GpuHandle vertexShader = nullptr;
+        GpuHandle pixelShader = nullptr;
+        uint32_t topology = 0;
+        std::map<uint32_t, std::tuple<GpuHandle, uint32_t, uint32_t>> vertexBuffers;
+        std::map<std::pair<uint8_t, uint32_t>, GpuHandle> shaderResources;
+
+        bool operator==(const DeviceState& other) const {
+            return vertexShader == other.vertexShader && pixelShader == other.pixelShader &&
+                topology == other.topology && vertexBuffers == other.vertexBuffers &&
+                shaderResources == other.shaderResources;
+        }
+
+        void Apply(const RecordingRenderContext::Command& command) {
+            switch (command.call) {
+            case Call::SetVertexBuffer: vertexBuffers[command.slot] = { command.handle, command.a, command.b }; break;
+            case Call::SetVertexShader: vertexShader = command.handle; break;
+            case Call::SetPixelShader: pixelShader = command.handle; break;
+            case Call::SetShaderResource:
+                shaderResources[{ static_cast<uint8_t>(command.stage), command.slot }] = command.handle;
+                break;
+            case Call::SetPrimitiveTopology: topology = command.a; break;
+            default: break;
+            }
+        }
+    };
+
+    // Draws whose state differs between the two logs
+    size_t CompareDraws(const RecordingRenderContext& direct, const RecordingRenderContext& cached) {
+        DeviceState a, b;
+        size_t i = 0, j = 0, mismatches = 0;
+        const auto& left = direct.Commands();
+        const auto& right = cached.Commands();
+
+        for (;;) {
+            while (i < left.size() && left[i].call != Call::Draw) a.Apply(left[i++]);
+            while (j < right.size() && right[j].call != Call::Draw) b.Apply(right[j++]);
+            if (i == left.size() || j == right.size()) break;
+            mismatches += !(a == b) || left[i].a != right[j].a || left[i].b != right[j].b;
+            ++i;
+            ++j;
+        }
+        return mismatches + (i != left.size()) + (j != right.size());
+    }
+
+    // Every draw rebinds its full material the way engines usually do;
+    // consecutive draws mostly share it. Every `passLength` draws another
+    // component touches the context behind the cache's back.
+    template <typename Context>
+    void EmitFrame(Context& context, IRenderContext& device, StateCache* cache,
+        size_t draws, size_t passLength, uint32_t seed) {
+        std::mt19937 rng(seed);
+        uint32_t material = 0;
+        uint32_t mesh = 0;
+
+        for (size_t i = 0; i < draws; ++i) {
+            if (i % passLength == 0 && i) {
+                device.SetPixelShader(FakeHandle(9, static_cast<uint32_t>(i)));
+                device.SetShaderResource(ShaderStage::Pixel, 0, nullptr);
+                if (cache) cache->Invalidate();
+            }
+            if (rng() % 8 == 0) material = rng() % 64;
+            if (rng() % 4 == 0) mesh = rng() % 256;
+
+            context.SetPrimitiveTopology(i % passLength < passLength / 8 ? 5 : 4);
+            context.SetVertexShader(FakeHandle(0, material % 8));
+            context.SetPixelShader(FakeHandle(1, material));
+            for (uint32_t slot = 0; slot < 4; ++slot)
+                context.SetShaderResource(ShaderStage::Pixel, slot, FakeHandle(2, material * 4 + slot));
+            context.SetShaderResource(ShaderStage::Vertex, 0, FakeHandle(3, material % 4));
+            context.SetVertexBuffer(0, FakeHandle(4, mesh), 32, 0);
+            context.SetVertexBuffer(1, FakeHandle(5, 0), 16, (mesh % 4) * 4096);
+            // Past the tracked range: always forwarded
+            context.SetShaderResource(ShaderStage::Pixel, StateCache::kShaderResourceSlots + 2, FakeHandle(6, material));
+            context.Draw(36, static_cast<uint32_t>(i));
+        }
+    }
+
+    constexpr size_t kBindsPerDraw = 11;
+}
+
+int main(int argc, char** argv) {
+    size_t draws = 50000;
+    size_t frames = 20;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--draws") == 0) draws = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+    const size_t passLength = 1000;
+    size_t errors = 0;
+
+    RecordingRenderContext direct;
+    RecordingRenderContext cached;
+    StateCache cache(&cached);
+    EmitFrame(direct, direct, nullptr, draws, passLength, 11);
+    EmitFrame(cache, cached, &cache, draws, passLength, 11);
+
+    const size_t mismatches = CompareDraws(direct, cached);
+    const StateCacheCounters counters = cache.Current();
+    const size_t foreign = 2 * ((draws - 1) / passLength);
+    errors += mismatches;
+    errors += counters.issued + counters.elided != draws * kBindsPerDraw;
+    errors += counters.issued + foreign != cached.BindCount();
+
+    // Frame boundary publishes the counters and starts from nothing bound
+    cache.BeginFrame();
+    errors += cache.LastFrame().issued != counters.issued || cache.LastFrame().elided != counters.elided;
+    errors += cache.Current().issued != 0 || cache.Current().frameIndex != counters.frameIndex + 1;
+    cache.SetVertexShader(FakeHandle(0, 0));
+    errors += cache.Current().issued != 1;
+
+    std::printf("%8s | %9s %9s %9s | %s\n", "draws", "calls", "issued", "elided", "mismatched draws");
+    std::printf("%8zu | %9zu %9llu %9llu | %zu\n", draws, draws * kBindsPerDraw,
+        static_cast<unsigned long long>(counters.issued), static_cast<unsigned long long>(counters.elided), mismatches);
+
+    // Cost per bind call into a counting target, with and without the cache
+    RecordingRenderContext counter(false);
+    StateCache timed(&counter);
+    auto time = [&](auto& context, StateCache* invalidate) {
+        const Clock::time_point start = Clock::now();
+        for (size_t f = 0; f < frames; ++f) EmitFrame(context, counter, invalidate, draws, passLength, 11);
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+            (static_cast<double>(draws) * frames * (kBindsPerDraw + 1));
+    };
+    const double through = time(timed, &timed);
+    const size_t forwardedCached = counter.BindCount();
+    counter.Clear();
+    const double bare = time(counter, nullptr);
+    const size_t forwardedBare = counter.BindCount();
+    std::printf("ns per call: direct %.2f, through cache %.2f; binds reaching the context per frame %zu -> %zu\n",
+        bare, through, forwardedBare / frames, forwardedCached / frames);
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
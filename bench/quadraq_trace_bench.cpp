@@ -0,0 +1,265 @@
+// ====================================================================
+//                        quadraq_trace_bench.cpp
+//     TGDK Quantum GPU Accelerator — Frame Trace Round-Trip Check
+//     A synthetic capture with shrinking frames, multi-second and
+//     full-range hitches and a truncated last record: FrameTraceWriter
+//     encodes it byte for byte as the format says, FrameTraceReader
+//     decodes it bit-exact and rejects damaged files, and quadraq_replay
+//     suppresses the same frames as an in-process replay of it
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "EntropyPredictor.hpp"
+#include "QuantumDrawRouter.hpp"
+#include "FrameClock.hpp"
+#include "FrameTrace.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#else
+#include <sys/wait.h>
+#endif
+
+using namespace QUADRAQ;
+
+namespace {
+
+    constexpr uint32_t kTick = FrameTraceFormat::kDefaultTickNanoseconds;
+
+    // The format written out by hand, independently of FrameTrace.cpp
+    std::vector<uint8_t> Header(uint16_t version, uint32_t tick) {
+        std::vector<uint8_t> bytes(FrameTraceFormat::kMagic, FrameTraceFormat::kMagic + 4);
+        for (int i = 0; i < 2; ++i) bytes.push_back(static_cast<uint8_t>(version >> (8 * i)));
+        bytes.push_back(0);
+        bytes.push_back(0);
+        for (int i = 0; i < 4; ++i) bytes.push_back(static_cast<uint8_t>(tick >> (8 * i)));
+        return bytes;
+    }
+
+    void PutDelta(std::vector<uint8_t>& bytes, int64_t delta) {
+        uint64_t zigzag = delta < 0 ? (static_cast<uint64_t>(-(delta + 1)) << 1) | 1 : static_cast<uint64_t>(delta) << 1;
+        do {
+            const uint8_t low = zigzag & 0x7F;
+            zigzag >>= 7;
+            bytes.push_back(zigzag ? low | 0x80 : low);
+        } while (zigzag);
+    }
+
+    std::vector<uint8_t> Encode(const std::vector<uint64_t>& ticks, uint32_t tick = kTick) {
+        std::vector<uint8_t> bytes = Header(FrameTraceFormat::kVersion, tick);
+        int64_t previous = 0;
+        for (uint64_t t : ticks) {
+            PutDelta(bytes, static_cast<int64_t>(t) - previous);
+            previous = static_cast<int64_t>(t);
+        }
+        return bytes;
+    }
+
+    bool WriteFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return static_cast<bool>(out);
+    }
+
+    std::vector<uint8_t> ReadFile(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    // Every frame the reader returns, plus whatever error stopped it
+    std::vector<uint64_t> ReadAll(const std::string& path, std::string& error) {
+        std::vector<uint64_t> frames;
+        FrameTraceReader reader;
+        if (reader.Open(path)) {
+            uint64_t nanoseconds = 0;
+            while (reader.Next(nanoseconds)) frames.push_back(nanoseconds);
+        }
+        error = reader.Error();
+        return frames;
+    }
+
+    // Steady play, a stutter whose frames alternate short and long, a
+    // level shift, and hitches from seconds up to the writer's clamp
+    std::vector<uint64_t> SyntheticTicks(size_t frames) {
+        std::mt19937 rng(7);
+        std::vector<uint64_t> ticks;
+        for (size_t i = 0; i < frames; ++i) {
+            const size_t phase = i * 4 / frames;
+            if (phase == 0) ticks.push_back(16667 - 300 + rng() % 600);
+            else if (phase == 1) ticks.push_back(i % 2 ? 8000 + rng() % 500 : 40000 + rng() % 500);
+            else if (phase == 2) ticks.push_back(33333 - 300 + rng() % 600);
+            else ticks.push_back(16667 - 300 + rng() % 600);
+        }
+        ticks[frames / 8] = 2000000;            // 2 s
+        ticks[frames / 8 + 1] = 1;
+        ticks[frames * 5 / 8] = 30000000;       // 30 s
+        ticks[frames * 7 / 8] = UINT32_MAX;     // the largest the writer records
+        return ticks;
+    }
+
+    // The frames quadraq_replay suppresses with its defaults and `window`
+    uint64_t ReplayInProcess(const std::vector<uint64_t>& frames, size_t window) {
+        FrameClock::SetVirtual(true);
+        EntropyPredictor::Initialize();
+        EntropyPredictor::SetEnabled(true);
+        EntropyPredictor::SetSampleWindow(window);
+        EntropyPredictor::SetForecastingEnabled(true);
+        EntropyPredictor::SetOverloadPolicy(EntropyPredictor::OverloadPolicy());
+        QuantumDrawRouter::EnableRouting(true);
+        QuantumDrawRouter::SetEntropyThreshold(0.010f);
+
+        uint64_t suppressed = 0;
+        for (uint64_t nanoseconds : frames) {
+            FrameClock::Advance(nanoseconds);
+            EntropyPredictor::UpdateCycle();
+            QuantumDrawRouter::BeginFrame();
+            suppressed += QuantumDrawRouter::ShouldSuppressDraw() ? 1 : 0;
+        }
+        return suppressed;
+    }
+
+    // Runs the tool and reads its summary; false if it could not be run
+    bool RunReplay(const std::string& replay, const std::string& trace, size_t window,
+                   unsigned long long& frames, unsigned long long& suppressed, int& status) {
+        const std::string command = "\"" + replay + "\" \"" + trace + "\" --window " + std::to_string(window) +
+            " --transitions-only";
+        FILE* pipe = popen(command.c_str(), "r");
+        if (!pipe) return false;
+
+        frames = suppressed = ~0ull;
+        char line[512];
+        while (std::fgets(line, sizeof(line), pipe)) {
+            std::sscanf(line, "# frames %llu", &frames);
+            std::sscanf(line, "# suppressed %llu", &suppressed);
+        }
+        status = pclose(pipe);
+#ifndef _WIN32
+        status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t frameCount = 2000;
+    size_t window = 60;
+    std::string tracePath = "quadraq_trace_bench.qdt";
+    std::string replay;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--frames") == 0) frameCount = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--window") == 0) window = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--trace") == 0) tracePath = argv[i + 1];
+        else if (std::strcmp(argv[i], "--replay") == 0) replay = argv[i + 1];
+    }
+    if (frameCount < 16) frameCount = 16;
+
+    size_t errors = 0;
+    const std::vector<uint64_t> ticks = SyntheticTicks(frameCount);
+    std::vector<uint64_t> expected;
+    for (uint64_t t : ticks) expected.push_back(t * kTick);
+
+    size_t shrinking = 0;
+    for (size_t i = 1; i < ticks.size(); ++i) shrinking += ticks[i] < ticks[i - 1];
+
+    // --- Writer: the bytes the format describes ---
+    const std::string cleanPath = tracePath + ".clean";
+    {
+        FrameTraceWriter writer;
+        errors += !writer.Open(cleanPath);
+        for (uint64_t nanoseconds : expected) writer.Record(nanoseconds);
+        writer.Close();
+
+        errors += writer.FramesWritten() != frameCount || writer.FramesDropped() != 0;
+        errors += ReadFile(cleanPath) != Encode(ticks);
+        std::printf("writer: %zu frames (%zu shorter than the one before), %zu bytes, as encoded by hand\n",
+            frameCount, shrinking, ReadFile(cleanPath).size());
+    }
+
+    // --- Reader: bit-exact, stopping at the truncated record ---
+    {
+        std::vector<uint8_t> bytes = Encode(ticks);
+        bytes.push_back(0x80);                  // a record cut after its first byte
+        errors += !WriteFile(tracePath, bytes);
+
+        std::string error;
+        errors += ReadAll(cleanPath, error) != expected || !error.empty();
+        errors += ReadAll(tracePath, error) != expected || error != "truncated record";
+
+        // Deltas past 32 bits decode even though the writer never makes them
+        const std::vector<uint64_t> wide = { 1, uint64_t(1) << 40, 3, (uint64_t(1) << 62) - 1, 0 };
+        const std::string widePath = tracePath + ".wide";
+        WriteFile(widePath, Encode(wide, 1));
+        errors += ReadAll(widePath, error) != wide || !error.empty();
+
+        struct Damaged {
+            std::vector<uint8_t> bytes;
+            const char* error;
+            size_t frames;
+        };
+        std::vector<uint8_t> negative = Header(FrameTraceFormat::kVersion, kTick);
+        PutDelta(negative, 5);
+        PutDelta(negative, -6);
+        std::vector<uint8_t> overlong = Header(FrameTraceFormat::kVersion, kTick);
+        overlong.insert(overlong.end(), 10, 0xFF);
+        overlong.push_back(0x01);
+        std::vector<uint8_t> magic = Header(FrameTraceFormat::kVersion, kTick);
+        magic[3] = 'X';
+
+        const Damaged damaged[] = {
+            { negative, "negative frame time", 1 },
+            { overlong, "malformed varint", 0 },
+            { magic, "not a QUADRAQ frame trace", 0 },
+            { Header(FrameTraceFormat::kVersion + 1, kTick), "unsupported trace version 2", 0 },
+            { Header(FrameTraceFormat::kVersion, 0), "invalid tick length", 0 },
+            { std::vector<uint8_t>(FrameTraceFormat::kMagic, FrameTraceFormat::kMagic + 4), "truncated header", 0 },
+        };
+        const std::string damagedPath = tracePath + ".damaged";
+        for (const Damaged& d : damaged) {
+            WriteFile(damagedPath, d.bytes);
+            errors += ReadAll(damagedPath, error).size() != d.frames || error != d.error;
+        }
+        std::remove(widePath.c_str());
+        std::remove(damagedPath.c_str());
+        std::printf("reader: %zu frames bit-exact, truncated tail and %zu damaged files rejected\n",
+            expected.size(), sizeof(damaged) / sizeof(damaged[0]));
+    }
+
+    // --- Replay: the tool against the predictor and router in-process ---
+    {
+        const uint64_t reference = ReplayInProcess(expected, window);
+        errors += reference == 0 || reference == frameCount;
+
+        if (replay.empty()) {
+            std::printf("replay: %llu of %zu frames suppressed in-process (no --replay given)\n",
+                static_cast<unsigned long long>(reference), frameCount);
+        }
+        else {
+            unsigned long long frames = 0, suppressed = 0, cleanFrames = 0, cleanSuppressed = 0;
+            int status = 0, cleanStatus = 0;
+            errors += !RunReplay(replay, tracePath, window, frames, suppressed, status);
+            errors += !RunReplay(replay, cleanPath, window, cleanFrames, cleanSuppressed, cleanStatus);
+
+            // The truncated record stops the replay with an error, after every whole frame
+            errors += frames != frameCount || suppressed != reference || status != 1;
+            errors += cleanFrames != frameCount || cleanSuppressed != reference || cleanStatus != 0;
+            std::printf("replay: %llu of %llu frames suppressed, %llu expected, exit %d (truncated) / %d (clean)\n",
+                suppressed, frames, static_cast<unsigned long long>(reference), status, cleanStatus);
+        }
+    }
+    std::remove(cleanPath.c_str());
+    std::remove(tracePath.c_str());
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
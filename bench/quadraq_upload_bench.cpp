@@ -0,0 +1,279 @@
+// ====================================================================
+//                        quadraq_upload_bench.cpp
+//     TGDK Quantum GPU Accelerator — Upload Allocator Check
+//     UploadRing and ResourcePool over SimulatedUploadDevice: random
+//     frames whose allocations wrap with alignment kept and never
+//     overwrite bytes a pending fence protects, refusal while fences
+//     are outstanding, reclaim as they complete, frame-mark folding,
+//     Discard-then-NoOverwrite mapping and content-addressed sharing
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "UploadRing.hpp"
+#include "ResourcePool.hpp"
+#include "SimulatedUploadDevice.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Remembers the fence value each EndFrame() was handed
+    class FenceRecordingDevice : public SimulatedUploadDevice {
+    public:
+        using SimulatedUploadDevice::SimulatedUploadDevice;
+
+        uint64_t SignalFence() override { return lastFence = SimulatedUploadDevice::SignalFence(); }
+        uint64_t LastFence() const { return lastFence; }
+
+    private:
+        uint64_t lastFence = 0;
+    };
+
+    struct Live {
+        uint32_t offset;
+        uint32_t size;
+        uint64_t fence;                 // 0 while its frame is still open
+        std::vector<uint8_t> bytes;
+    };
+
+    bool Overlaps(const Live& a, uint32_t offset, uint32_t size) {
+        return offset < a.offset + a.size && a.offset < offset + size;
+    }
+
+    // Random frames against a model of what the GPU may still read
+    size_t CheckStreaming(uint32_t capacity, uint32_t latency, size_t frames, double& nsPerUpload, UploadStats& out) {
+        FenceRecordingDevice device(latency);
+        UploadRing ring(device, capacity);
+        size_t errors = !ring.Initialize();
+
+        std::mt19937 rng(17);
+        const uint32_t alignments[] = { 1, 4, 16, 64, 256 };
+        std::vector<Live> live;
+        std::vector<uint8_t> data(capacity);
+        double ns = 0.0;
+        size_t uploads = 0;
+
+        for (size_t frame = 0; frame < frames; ++frame) {
+            const size_t count = rng() % 12;
+            for (size_t k = 0; k < count; ++k) {
+                const uint32_t size = 1 + rng() % (capacity / 8);
+                const uint32_t alignment = alignments[rng() % 5];
+                const uint32_t seed = rng();
+                for (uint32_t b = 0; b < size; ++b) data[b] = static_cast<uint8_t>(seed + b * 31 + (b >> 8));
+
+                const uint64_t completed = device.CompletedFence();
+                const Clock::time_point start = Clock::now();
+                const UploadAllocation allocation = ring.Upload(data.data(), size, alignment);
+                ns += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+                ++uploads;
+
+                if (!allocation) {
+                    // Refused only while something is really held
+                    errors += live.empty();
+                    continue;
+                }
+                errors += allocation.offset % alignment != 0;
+                errors += allocation.offset + size > capacity;
+                errors += std::memcmp(device.Contents(allocation.buffer) + allocation.offset, data.data(), size) != 0;
+                for (const Live& other : live) {
+                    if (other.fence == 0 || other.fence > completed) errors += Overlaps(other, allocation.offset, size);
+                }
+                live.push_back({ allocation.offset, size, 0, std::vector<uint8_t>(data.begin(), data.begin() + size) });
+            }
+
+            ring.EndFrame();
+            for (Live& entry : live) {
+                if (entry.fence == 0) entry.fence = device.LastFence();
+            }
+            device.AdvanceFrame();
+
+            // Whatever is still protected must be intact
+            const uint64_t completed = device.CompletedFence();
+            const uint8_t* contents = device.Contents(ring.Buffer());
+            live.erase(std::remove_if(live.begin(), live.end(), [&](const Live& entry) { return entry.fence <= completed; }), live.end());
+            for (const Live& entry : live)
+                errors += std::memcmp(contents + entry.offset, entry.bytes.data(), entry.size) != 0;
+        }
+
+        nsPerUpload = ns / std::max<size_t>(uploads, 1);
+        out = ring.Stats();
+        errors += out.wraps == 0;
+        errors += device.Maps(MapMode::Discard) != 1;
+        errors += device.Maps(MapMode::NoOverwrite) != out.allocations - 1;
+        return errors;
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t frames = 20000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--frames") == 0) frames = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    size_t errors = 0;
+    const uint8_t payload[1024] = {};
+
+    // --- Random frames: wrapping, alignment, nothing protected overwritten ---
+    std::printf("%8s %7s | %10s %8s %6s %6s %8s | %9s\n", "capacity", "latency", "allocs", "failed", "wraps", "peak%",
+        "frames", "ns/upload");
+    const uint32_t latencies[] = { 0, 1, 2, 4 };
+    for (const uint32_t latency : latencies) {
+        const uint32_t capacity = 64 * 1024;
+        double ns = 0.0;
+        UploadStats stats;
+        errors += CheckStreaming(capacity, latency, frames, ns, stats);
+        std::printf("%8u %7u | %10llu %8llu %6llu %5.0f%% %8u | %9.1f\n", capacity, latency,
+            static_cast<unsigned long long>(stats.allocations), static_cast<unsigned long long>(stats.failed),
+            static_cast<unsigned long long>(stats.wraps), 100.0 * stats.peakBytesInFlight / capacity,
+            stats.framesInFlight, ns);
+    }
+
+    // --- Refusal while fences are outstanding, reclaim as they complete ---
+    {
+        SimulatedUploadDevice device(3);
+        UploadRing ring(device, 4096);
+        errors += !ring.Initialize();
+
+        // Unaligned head, then a 256-byte aligned allocation
+        errors += ring.Upload(payload, 100, 1).offset != 0;
+        errors += ring.Upload(payload, 10, 256).offset != 256;
+        errors += ring.Upload(payload, 3000, 16).offset != 272;
+        ring.EndFrame();
+        device.AdvanceFrame();
+        // head 3272: 824 bytes fit, 825 do not while fence 1 is pending
+        errors += !ring.Upload(payload, 824, 1);
+        ring.EndFrame();
+        device.AdvanceFrame();
+        errors += static_cast<bool>(ring.Upload(payload, 1, 1));
+        errors += ring.Stats().failed != 1 || ring.Stats().bytesInFlight != 4096;
+
+        // Fence 1 completes: the first frame's 3272 bytes come back,
+        // frame 2's 824 stay held
+        device.AdvanceFrame();
+        ring.EndFrame();
+        errors += ring.Stats().bytesInFlight != 824 || ring.Stats().framesInFlight != 1;
+        // Wraps: offset 4096 is the start of the next lap
+        const UploadAllocation wrapped = ring.Upload(payload, 1000, 64);
+        errors += !wrapped || wrapped.offset != 0;
+        errors += static_cast<bool>(ring.Upload(payload, 3000, 1));
+        errors += ring.Stats().wraps != 0 || ring.Stats().failed != 2;
+
+        // Tail end of a lap: too small a gap is skipped, the skip counted as a wrap
+        errors += !ring.Upload(payload, 2000, 1);
+        ring.EndFrame();
+        for (int i = 0; i < 3; ++i) device.AdvanceFrame();
+        ring.EndFrame();
+        errors += ring.Stats().bytesInFlight != 0 || ring.Stats().framesInFlight != 0;
+        const UploadAllocation lapEnd = ring.Upload(payload, 1000, 256);
+        errors += !lapEnd || lapEnd.offset != 3072;
+        const UploadAllocation skipped = ring.Upload(payload, 512, 1);
+        errors += !skipped || skipped.offset != 0 || ring.Stats().wraps != 1;
+
+        std::printf("refusal: %llu refused, %llu wraps, %u bytes in flight\n",
+            static_cast<unsigned long long>(ring.Stats().failed), static_cast<unsigned long long>(ring.Stats().wraps),
+            ring.Stats().bytesInFlight);
+    }
+
+    // --- More frames than marks: the newest mark absorbs the rest ---
+    {
+        const uint32_t frameCount = UploadRing::kMaxFramesInFlight + 4;
+        SimulatedUploadDevice device(frameCount + 10);
+        UploadRing ring(device, 64 * 1024);
+        errors += !ring.Initialize();
+        for (uint32_t f = 0; f < frameCount; ++f) {
+            errors += !ring.Upload(payload, 64, 64);
+            ring.EndFrame();
+            errors += ring.Stats().framesInFlight != std::min(f + 1, UploadRing::kMaxFramesInFlight);
+            device.AdvanceFrame();
+        }
+        errors += ring.Stats().bytesInFlight != frameCount * 64;
+
+        // Step the GPU one frame at a time: marks 1..15 retire a frame
+        // each, the folded frames only together with the last fence
+        uint32_t folded = 0;
+        while (ring.Stats().framesInFlight != 0) {
+            device.AdvanceFrame();
+            ring.EndFrame();
+            const uint64_t completed = device.CompletedFence();
+            const uint64_t held = completed < UploadRing::kMaxFramesInFlight ? frameCount - completed :
+                completed < frameCount ? frameCount - (UploadRing::kMaxFramesInFlight - 1) : 0;
+            errors += ring.Stats().bytesInFlight != held * 64;
+            folded += completed >= UploadRing::kMaxFramesInFlight && completed < frameCount;
+        }
+        errors += folded == 0;
+        std::printf("folding: %u frames on %u marks, folded frames held for %u extra GPU frames\n",
+            frameCount, UploadRing::kMaxFramesInFlight, folded);
+    }
+
+    // --- Discard on the first map, NoOverwrite after; again after Release ---
+    {
+        SimulatedUploadDevice device(1);
+        UploadRing ring(device, 4096);
+        errors += !ring.Initialize();
+        for (int i = 0; i < 5; ++i) ring.Upload(payload, 64);
+        errors += device.Maps(MapMode::Discard) != 1 || device.Maps(MapMode::NoOverwrite) != 4;
+        ring.Release();
+        errors += device.LiveBuffers() != 0;
+        errors += !ring.Initialize();
+        ring.Upload(payload, 64);
+        errors += device.Maps(MapMode::Discard) != 2 || device.Maps(MapMode::NoOverwrite) != 4;
+
+        // A ring without a buffer or a bad request allocates nothing
+        SimulatedUploadDevice broken;
+        broken.SetCreateFailure(true);
+        UploadRing dead(broken, 4096);
+        errors += dead.Initialize() || static_cast<bool>(dead.Upload(payload, 64));
+        errors += static_cast<bool>(ring.Upload(payload, 64, 3)) || static_cast<bool>(ring.Upload(payload, 64, 512));
+        errors += static_cast<bool>(ring.Upload(payload, 8192));
+    }
+
+    // --- ResourcePool: one buffer per distinct (bytes, kind) ---
+    {
+        SimulatedUploadDevice device;
+        ResourcePool pool(device);
+        uint8_t a[48], b[48];
+        for (int i = 0; i < 48; ++i) {
+            a[i] = static_cast<uint8_t>(i);
+            b[i] = static_cast<uint8_t>(i);
+        }
+        b[47] ^= 1;
+
+        const GpuHandle geometry = pool.Acquire(a, sizeof(a), BufferKind::Geometry);
+        const GpuHandle again = pool.Acquire(a, sizeof(a), BufferKind::Geometry);
+        const GpuHandle constant = pool.Acquire(a, sizeof(a), BufferKind::Constant);
+        const GpuHandle other = pool.Acquire(b, sizeof(b), BufferKind::Geometry);
+        const GpuHandle shorter = pool.Acquire(a, sizeof(a) - 1, BufferKind::Geometry);
+        errors += !geometry || again != geometry;
+        errors += !constant || constant == geometry;
+        errors += !other || other == geometry || other == constant;
+        errors += !shorter || shorter == geometry;
+        errors += std::memcmp(device.Contents(geometry), a, sizeof(a)) != 0;
+        errors += std::memcmp(device.Contents(other), b, sizeof(b)) != 0;
+        errors += pool.Acquire(a, sizeof(a), BufferKind::Constant) != constant;
+
+        static uint8_t large[ResourcePool::kMaxResourceBytes + 1];
+        errors += pool.Acquire(large, sizeof(large), BufferKind::Geometry) != nullptr;
+        errors += pool.Acquire(nullptr, 16, BufferKind::Geometry) != nullptr;
+
+        const ResourcePoolStats stats = pool.Stats();
+        errors += stats.creations != 4 || stats.hits != 2 || stats.failed != 2 || stats.resources != 4;
+        errors += device.BuffersCreated() != 4;
+        pool.Release();
+        errors += device.LiveBuffers() != 0;
+        std::printf("pool: %llu created, %llu hits, %llu refused\n", static_cast<unsigned long long>(stats.creations),
+            static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.failed));
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
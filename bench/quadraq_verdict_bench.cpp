@@ -0,0 +1,222 @@
+// ====================================================================
+//                        quadraq_verdict_bench.cpp
+//     TGDK Quantum GPU Accelerator — Verdict Cache Release Check
+//     VerdictCache with its release hooks parked on fake resources the
+//     way FlatDDSInterceptor parks them in D3D private data: destroying
+//     a resource forgets its verdict, a new resource at the same address
+//     never sees the old one, hooks fired after the cache is gone do
+//     nothing, and threads recycling addresses never read a stale verdict
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "VerdictCache.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace QUADRAQ;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    std::atomic<size_t> hooksLive{ 0 }, hooksDead{ 0 };
+
+    // The private-data interface: refcounted, fires its hook on the last release
+    class FakeWatch {
+    public:
+        explicit FakeWatch(VerdictCache::ReleaseHook hook) : hook(std::move(hook)) {}
+
+        void AddRef() { ++references; }
+        void Release() {
+            if (--references != 0) return;
+            ++(hook.Fire() ? hooksLive : hooksDead);
+            delete this;
+        }
+
+    private:
+        VerdictCache::ReleaseHook hook;
+        std::atomic<unsigned> references{ 1 };
+    };
+
+    // Stands in for an ID3D11Resource: keeps a reference to its private
+    // data interface and drops it when destroyed
+    class FakeResource {
+    public:
+        ~FakeResource() {
+            if (watch) watch->Release();
+        }
+
+        bool Watched() const { return watch != nullptr; }
+        void SetPrivateDataInterface(FakeWatch* data) {
+            data->AddRef();
+            watch = data;
+        }
+
+    private:
+        FakeWatch* watch = nullptr;
+    };
+
+    // Same steps as FlatDDSInterceptor's WatchRelease()
+    void WatchRelease(VerdictCache& cache, FakeResource* resource) {
+        if (resource->Watched()) return;
+        FakeWatch* watch = new FakeWatch(cache.Hook(resource));
+        resource->SetPrivateDataInterface(watch);
+        watch->Release();
+    }
+
+    // Fixed storage, so a destroyed resource's address is handed to the
+    // next one created in its slot
+    struct ResourceSlot {
+        alignas(FakeResource) unsigned char storage[sizeof(FakeResource)];
+        FakeResource* live = nullptr;
+        uint64_t generation = 0;
+
+        FakeResource* Create() {
+            ++generation;
+            return live = new (storage) FakeResource();
+        }
+        void Destroy() {
+            live->~FakeResource();
+            live = nullptr;
+        }
+    };
+
+    int targets[2];
+
+    // Differs between consecutive generations, null included
+    GpuHandle VerdictFor(uint64_t generation) {
+        switch (generation % 3) {
+        case 0: return nullptr;
+        case 1: return &targets[0];
+        default: return &targets[1];
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    int ms = 200;
+    size_t threads = 4;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--ms") == 0) ms = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--threads") == 0) threads = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+
+    size_t errors = 0;
+    GpuHandle replacement = nullptr;
+
+    // --- Released while cached, then the address reused ---
+    {
+        VerdictCache cache(64);
+        ResourceSlot slot;
+        FakeResource* first = slot.Create();
+        cache.Store(first, 1, &targets[0]);
+        WatchRelease(cache, first);
+        WatchRelease(cache, first);         // one watch per resource
+        errors += !cache.Lookup(first, 1, replacement) || replacement != &targets[0];
+
+        slot.Destroy();
+        errors += hooksLive.load() != 1;
+        errors += cache.Lookup(first, 1, replacement);
+
+        FakeResource* second = slot.Create();
+        errors += second != first;
+        errors += cache.Lookup(second, 1, replacement);
+        cache.Store(second, 1, nullptr);
+        WatchRelease(cache, second);
+        errors += !cache.Lookup(second, 1, replacement) || replacement != nullptr;
+
+        // Without the watch the old verdict would be served to the new resource
+        ResourceSlot bare;
+        FakeResource* unwatched = bare.Create();
+        cache.Store(unwatched, 1, &targets[1]);
+        bare.Destroy();
+        errors += !cache.Lookup(bare.Create(), 1, replacement) || replacement != &targets[1];
+        bare.Destroy();
+        slot.Destroy();
+        errors += hooksLive.load() != 2 || hooksDead.load() != 0;
+        std::printf("release: verdict forgotten on destroy, reused address missed, unwatched reuse served the stale verdict\n");
+    }
+
+    // --- Cache destroyed before the resources it watches ---
+    {
+        auto cache = std::make_unique<VerdictCache>(64);
+        std::vector<ResourceSlot> slots(32);
+        for (size_t i = 0; i < slots.size(); ++i) {
+            FakeResource* resource = slots[i].Create();
+            cache->Store(resource, 1, VerdictFor(i));
+            WatchRelease(*cache, resource);
+        }
+        const size_t liveBefore = hooksLive.load();
+        cache.reset();
+        for (ResourceSlot& slot : slots) slot.Destroy();
+        errors += hooksLive.load() != liveBefore || hooksDead.load() != slots.size();
+        std::printf("teardown: %zu hooks fired after the cache was destroyed, all ignored\n", hooksDead.load());
+    }
+
+    // --- Threads recycling addresses while the rules version moves ---
+    {
+        VerdictCache cache(256);            // small, so fill-up resets happen too
+        std::atomic<uint64_t> version{ 1 };
+        std::atomic<bool> stop{ false };
+        std::atomic<size_t> stale{ 0 }, hits{ 0 }, recycled{ 0 };
+
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::vector<ResourceSlot> slots(64);
+                for (ResourceSlot& slot : slots) slot.Create();
+                std::mt19937 rng(static_cast<uint32_t>(23 + t));
+                size_t localStale = 0, localHits = 0, localRecycled = 0;
+
+                while (!stop.load(std::memory_order_relaxed)) {
+                    ResourceSlot& slot = slots[rng() % slots.size()];
+                    if (rng() % 8 == 0) {
+                        slot.Destroy();
+                        slot.Create();
+                        ++localRecycled;
+                        continue;
+                    }
+
+                    const uint64_t rules = version.load(std::memory_order_acquire);
+                    GpuHandle found = nullptr;
+                    if (cache.Lookup(slot.live, rules, found)) {
+                        localStale += found != VerdictFor(slot.generation);
+                        ++localHits;
+                    } else {
+                        cache.Store(slot.live, rules, VerdictFor(slot.generation));
+                        WatchRelease(cache, slot.live);
+                    }
+                }
+                for (ResourceSlot& slot : slots) slot.Destroy();
+                stale += localStale;
+                hits += localHits;
+                recycled += localRecycled;
+            });
+        }
+
+        const Clock::time_point start = Clock::now();
+        while (Clock::now() - start < std::chrono::milliseconds(ms)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            version.fetch_add(1, std::memory_order_acq_rel);
+        }
+        stop = true;
+        for (std::thread& worker : workers) worker.join();
+
+        errors += stale.load();
+        errors += hits.load() == 0 || recycled.load() == 0;
+        std::printf("recycling: %zu threads, %zu hits, %zu addresses reused, %llu resets, %zu stale verdicts\n",
+            threads, hits.load(), recycled.load(), static_cast<unsigned long long>(cache.Stats().resets), stale.load());
+    }
+
+    if (errors) std::printf("FAIL: %zu errors\n", errors);
+    return errors ? 1 : 0;
+}
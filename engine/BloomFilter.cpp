@@ -0,0 +1,22 @@
+// ====================================================================
+//                            BloomFilter.cpp
+//     TGDK Quantum GPU Accelerator — Negative Lookup Filter
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "BloomFilter.hpp"
+
+namespace QUADRAQ {
+
+    void BloomFilter::Build(const std::vector<uint64_t>& keys) {
+        size_t wordCount = 1;
+        while (wordCount * 64 < keys.size() * kBitsPerKey) wordCount <<= 1;
+
+        words.assign(wordCount, 0);
+        wordMask = wordCount - 1;
+
+        for (uint64_t key : keys)
+            words[static_cast<size_t>(key) & wordMask] |= ProbeMask(key);
+    }
+
+} // namespace QUADRAQ
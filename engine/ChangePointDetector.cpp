@@ -0,0 +1,60 @@
+// ====================================================================
+//                       ChangePointDetector.cpp
+//     TGDK Quantum GPU Accelerator — Online Level-Shift Detection
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "ChangePointDetector.hpp"
+
+#include <algorithm>
+
+namespace QUADRAQ {
+
+    void ChangePointDetector::Configure(const Parameters& newParams) {
+        params = newParams;
+        if (params.minRunFrames == 0) params.minRunFrames = 1;
+        Reset();
+    }
+
+    void ChangePointDetector::Reset() {
+        mean = 0.0;
+        upSum = upMin = 0.0;
+        downSum = downMax = 0.0;
+        count = 0;
+    }
+
+    int ChangePointDetector::Push(float sample) {
+        ++count;
+        const double cap = params.threshold / static_cast<double>(params.minRunFrames);
+
+        // Once armed, a spike moves the segment mean no further than it
+        // moves the test; otherwise the frames after a hitch read as a
+        // downward shift against the inflated mean
+        const double step = sample - mean;
+        mean += (count < params.warmupFrames ? step : std::min(std::max(step, -cap), cap)) / static_cast<double>(count);
+
+        // Only learn the segment mean until armed
+        if (count < params.warmupFrames)
+            return 0;
+
+        const double deviation = std::min(std::max(sample - mean, -cap), cap);
+
+        // Page-Hinkley: cumulative deviation against its running extreme
+        upSum += deviation - params.driftTolerance;
+        upMin = std::min(upMin, upSum);
+        downSum += deviation + params.driftTolerance;
+        downMax = std::max(downMax, downSum);
+
+        int direction = 0;
+        if (upSum - upMin > params.threshold) direction = 1;
+        else if (downMax - downSum > params.threshold) direction = -1;
+
+        if (direction != 0) {
+            Reset();
+            count = 1;
+            mean = sample;
+        }
+        return direction;
+    }
+
+} // namespace QUADRAQ
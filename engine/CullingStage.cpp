@@ -0,0 +1,261 @@
+// ====================================================================
+//                           CullingStage.cpp
+//     TGDK Quantum GPU Accelerator — CPU Frustum & Small-Feature Culling
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "CullingStage.hpp"
+#include "BitOps.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define QUADRAQ_CULL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(QUADRAQ_CULL_X86) && (defined(__GNUC__) || defined(__clang__))
+#define QUADRAQ_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define QUADRAQ_TARGET_AVX2
+#endif
+
+namespace QUADRAQ {
+
+    namespace {
+        // Everything a kernel needs, flattened once per call
+        struct KernelParams {
+            CullingStage::Planes planes;
+            float wRow[4];
+            float sizeScale;            // 2 * pixelScale: diameter in pixels per unit of r / w
+            float minPixelSize;
+        };
+
+        // Bits for draws [0, n) of one 64-draw block
+        struct BlockBits {
+            uint64_t inFrustum;
+            uint64_t small;
+        };
+
+        void ScalarLanes(const KernelParams& p, const float* x, const float* y, const float* z, const float* r,
+            size_t begin, size_t end, BlockBits& bits) {
+            for (size_t i = begin; i < end; ++i) {
+                bool inside = true;
+                for (int k = 0; k < 6; ++k) {
+                    const float distance = p.planes.a[k] * x[i] + p.planes.b[k] * y[i] + p.planes.c[k] * z[i] + p.planes.d[k];
+                    inside &= distance >= -r[i];
+                }
+
+                // Camera inside or right behind the sphere: never "small"
+                const float w = p.wRow[0] * x[i] + p.wRow[1] * y[i] + p.wRow[2] * z[i] + p.wRow[3];
+                const bool small = w > r[i] && p.sizeScale * r[i] < p.minPixelSize * w;
+
+                bits.inFrustum |= static_cast<uint64_t>(inside) << i;
+                bits.small |= static_cast<uint64_t>(small) << i;
+            }
+        }
+
+        void ScalarBlock(const KernelParams& p, const float* x, const float* y, const float* z, const float* r,
+            size_t n, BlockBits& bits) {
+            ScalarLanes(p, x, y, z, r, 0, n, bits);
+        }
+
+#if defined(QUADRAQ_CULL_X86)
+        void SSEBlock(const KernelParams& p, const float* x, const float* y, const float* z, const float* r,
+            size_t n, BlockBits& bits) {
+            const size_t vectorEnd = n & ~size_t(3);
+            const __m128 wx = _mm_set1_ps(p.wRow[0]), wy = _mm_set1_ps(p.wRow[1]);
+            const __m128 wz = _mm_set1_ps(p.wRow[2]), ww = _mm_set1_ps(p.wRow[3]);
+            const __m128 sizeScale = _mm_set1_ps(p.sizeScale);
+            const __m128 minPixels = _mm_set1_ps(p.minPixelSize);
+
+            for (size_t i = 0; i < vectorEnd; i += 4) {
+                const __m128 px = _mm_loadu_ps(x + i), py = _mm_loadu_ps(y + i);
+                const __m128 pz = _mm_loadu_ps(z + i), pr = _mm_loadu_ps(r + i);
+                const __m128 negR = _mm_sub_ps(_mm_setzero_ps(), pr);
+
+                // Spelled out per plane: a loop here is not unrolled at -O2
+                auto outside = [&](int k) {
+                    __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.planes.a[k]), px), _mm_set1_ps(p.planes.d[k]));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(p.planes.b[k]), py));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(p.planes.c[k]), pz));
+                    return _mm_cmpge_ps(distance, negR);
+                };
+                const __m128 inside = _mm_and_ps(
+                    _mm_and_ps(_mm_and_ps(outside(0), outside(1)), _mm_and_ps(outside(2), outside(3))),
+                    _mm_and_ps(outside(4), outside(5)));
+
+                __m128 w = _mm_add_ps(_mm_mul_ps(wx, px), ww);
+                w = _mm_add_ps(w, _mm_mul_ps(wy, py));
+                w = _mm_add_ps(w, _mm_mul_ps(wz, pz));
+                const __m128 small = _mm_and_ps(_mm_cmpgt_ps(w, pr),
+                    _mm_cmplt_ps(_mm_mul_ps(sizeScale, pr), _mm_mul_ps(minPixels, w)));
+
+                bits.inFrustum |= static_cast<uint64_t>(_mm_movemask_ps(inside)) << i;
+                bits.small |= static_cast<uint64_t>(_mm_movemask_ps(small)) << i;
+            }
+            ScalarLanes(p, x, y, z, r, vectorEnd, n, bits);
+        }
+
+        QUADRAQ_TARGET_AVX2
+        void AVX2Block(const KernelParams& p, const float* x, const float* y, const float* z, const float* r,
+            size_t n, BlockBits& bits) {
+            const size_t vectorEnd = n & ~size_t(7);
+            const __m256 wx = _mm256_set1_ps(p.wRow[0]), wy = _mm256_set1_ps(p.wRow[1]);
+            const __m256 wz = _mm256_set1_ps(p.wRow[2]), ww = _mm256_set1_ps(p.wRow[3]);
+            const __m256 sizeScale = _mm256_set1_ps(p.sizeScale);
+            const __m256 minPixels = _mm256_set1_ps(p.minPixelSize);
+
+            for (size_t i = 0; i < vectorEnd; i += 8) {
+                const __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i);
+                const __m256 pz = _mm256_loadu_ps(z + i), pr = _mm256_loadu_ps(r + i);
+                const __m256 negR = _mm256_sub_ps(_mm256_setzero_ps(), pr);
+
+                auto outside = [&](int k) QUADRAQ_TARGET_AVX2 {
+                    __m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(p.planes.a[k]), px, _mm256_set1_ps(p.planes.d[k]));
+                    distance = _mm256_fmadd_ps(_mm256_set1_ps(p.planes.b[k]), py, distance);
+                    distance = _mm256_fmadd_ps(_mm256_set1_ps(p.planes.c[k]), pz, distance);
+                    return _mm256_cmp_ps(distance, negR, _CMP_GE_OQ);
+                };
+                const __m256 inside = _mm256_and_ps(
+                    _mm256_and_ps(_mm256_and_ps(outside(0), outside(1)), _mm256_and_ps(outside(2), outside(3))),
+                    _mm256_and_ps(outside(4), outside(5)));
+
+                __m256 w = _mm256_fmadd_ps(wx, px, ww);
+                w = _mm256_fmadd_ps(wy, py, w);
+                w = _mm256_fmadd_ps(wz, pz, w);
+                const __m256 small = _mm256_and_ps(_mm256_cmp_ps(w, pr, _CMP_GT_OQ),
+                    _mm256_cmp_ps(_mm256_mul_ps(sizeScale, pr), _mm256_mul_ps(minPixels, w), _CMP_LT_OQ));
+
+                bits.inFrustum |= static_cast<uint64_t>(_mm256_movemask_ps(inside)) << i;
+                bits.small |= static_cast<uint64_t>(_mm256_movemask_ps(small)) << i;
+            }
+            // The tail and the caller are legacy-SSE code; avoid the
+            // AVX-to-SSE transition penalty on every block
+            _mm256_zeroupper();
+            ScalarLanes(p, x, y, z, r, vectorEnd, n, bits);
+        }
+
+        bool CpuHasAVX2() {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) return false;
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            if (!osxsave || !fma || (_xgetbv(0) & 0x6) != 0x6) return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+        }
+#endif
+
+        using BlockKernel = void (*)(const KernelParams&, const float*, const float*, const float*, const float*, size_t, BlockBits&);
+
+        BlockKernel KernelFor(CullKernel kernel) {
+#if defined(QUADRAQ_CULL_X86)
+            switch (kernel) {
+            case CullKernel::AVX2: return AVX2Block;
+            case CullKernel::SSE: return SSEBlock;
+            default: break;
+            }
+#else
+            (void)kernel;
+#endif
+            return ScalarBlock;
+        }
+    }
+
+    CullingStage::CullingStage() : kernel(BestKernel()) {
+        const float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+        SetViewProjection(identity, 1.0f, 1.0f);
+    }
+
+    CullKernel CullingStage::BestKernel() {
+#if defined(QUADRAQ_CULL_X86)
+        static const CullKernel best = CpuHasAVX2() ? CullKernel::AVX2 : CullKernel::SSE;
+        return best;
+#else
+        return CullKernel::Scalar;
+#endif
+    }
+
+    void CullingStage::ForceKernel(CullKernel requested) {
+        kernel = std::min(requested, BestKernel());
+    }
+
+    void CullingStage::SetViewProjection(const float m[16], float viewportWidth, float viewportHeight) {
+        // Column j of the row-vector matrix maps (x, y, z, 1) to clip component j
+        auto column = [m](int j, int row) { return m[row * 4 + j]; };
+
+        // Gribb-Hartmann extraction, D3D clip volume: -w <= x, y <= w, 0 <= z <= w.
+        // Each plane is wWeight * column 3 + sign * column j.
+        struct PlaneRecipe { int column; float sign; float wWeight; };
+        const PlaneRecipe recipes[6] = {
+            { 0,  1.0f, 1.0f },     // left
+            { 0, -1.0f, 1.0f },     // right
+            { 1,  1.0f, 1.0f },     // bottom
+            { 1, -1.0f, 1.0f },     // top
+            { 2,  1.0f, 0.0f },     // near
+            { 2, -1.0f, 1.0f }      // far
+        };
+
+        for (int k = 0; k < 6; ++k) {
+            float plane[4];
+            for (int row = 0; row < 4; ++row)
+                plane[row] = recipes[k].wWeight * column(3, row) + recipes[k].sign * column(recipes[k].column, row);
+
+            const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+            const float inverse = length > 0.0f ? 1.0f / length : 0.0f;
+            planes.a[k] = plane[0] * inverse;
+            planes.b[k] = plane[1] * inverse;
+            planes.c[k] = plane[2] * inverse;
+            planes.d[k] = plane[3] * inverse;
+        }
+
+        for (int row = 0; row < 4; ++row) wRow[row] = column(3, row);
+
+        // NDC spans 2 units across the viewport; columns 0/1 carry the
+        // projection's x/y scale through any rotation
+        const float scaleX = std::sqrt(column(0, 0) * column(0, 0) + column(0, 1) * column(0, 1) + column(0, 2) * column(0, 2));
+        const float scaleY = std::sqrt(column(1, 0) * column(1, 0) + column(1, 1) * column(1, 1) + column(1, 2) * column(1, 2));
+        pixelScale = std::max(scaleX * viewportWidth, scaleY * viewportHeight) * 0.5f;
+    }
+
+    CullStats CullingStage::Cull(const BoundsSoA& bounds, uint64_t* visibleMask) const {
+        CullStats stats;
+        stats.tested = bounds.count;
+        if (bounds.count == 0) return stats;
+
+        KernelParams params;
+        params.planes = planes;
+        std::copy(wRow, wRow + 4, params.wRow);
+        params.sizeScale = 2.0f * pixelScale;
+        params.minPixelSize = minPixelSize;
+
+        const BlockKernel block = KernelFor(kernel);
+        const size_t words = (bounds.count + 63) / 64;
+        for (size_t w = 0; w < words; ++w) {
+            const size_t base = w * 64;
+            const size_t n = std::min<size_t>(64, bounds.count - base);
+
+            BlockBits bits{ 0, 0 };
+            block(params, bounds.centerX + base, bounds.centerY + base, bounds.centerZ + base, bounds.radius + base, n, bits);
+
+            const uint64_t laneMask = n == 64 ? ~0ull : (1ull << n) - 1;
+            const uint64_t visible = bits.inFrustum & ~bits.small & laneMask;
+            visibleMask[w] = visible;
+            stats.frustumCulled += PopCount64(~bits.inFrustum & laneMask);
+            stats.smallCulled += PopCount64(bits.inFrustum & bits.small & laneMask);
+        }
+        return stats;
+    }
+
+} // namespace QUADRAQ
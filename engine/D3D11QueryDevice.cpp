@@ -0,0 +1,48 @@
+// ====================================================================
+//                         D3D11QueryDevice.cpp
+//     TGDK Quantum GPU Accelerator — D3D11 Query Adapter
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "D3D11QueryDevice.hpp"
+
+namespace QUADRAQ {
+
+    GpuHandle D3D11QueryDevice::CreatePipelineQuery() {
+        D3D11_QUERY_DESC desc = {};
+        desc.Query = D3D11_QUERY_PIPELINE_STATISTICS;
+
+        ID3D11Query* query = nullptr;
+        if (!device || FAILED(device->CreateQuery(&desc, &query)))
+            return nullptr;
+        return query;
+    }
+
+    void D3D11QueryDevice::ReleaseQuery(GpuHandle query) {
+        if (query) static_cast<ID3D11Query*>(query)->Release();
+    }
+
+    void D3D11QueryDevice::Begin(GpuHandle query) {
+        context->Begin(static_cast<ID3D11Query*>(query));
+    }
+
+    void D3D11QueryDevice::End(GpuHandle query) {
+        context->End(static_cast<ID3D11Query*>(query));
+    }
+
+    QueryPoll D3D11QueryDevice::Poll(GpuHandle query, PipelineStatistics& stats) {
+        D3D11_QUERY_DATA_PIPELINE_STATISTICS data = {};
+        const HRESULT hr = context->GetData(static_cast<ID3D11Query*>(query), &data, sizeof(data), 0);
+
+        if (hr == S_FALSE) return QueryPoll::Pending;
+        if (FAILED(hr)) return QueryPoll::Failed;
+
+        stats.iaVertices = data.IAVertices;
+        stats.iaPrimitives = data.IAPrimitives;
+        stats.vsInvocations = data.VSInvocations;
+        stats.rasterPrimitives = data.CInvocations;
+        stats.psInvocations = data.PSInvocations;
+        return QueryPoll::Ready;
+    }
+
+} // namespace QUADRAQ
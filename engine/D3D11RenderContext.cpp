@@ -0,0 +1,62 @@
+// ====================================================================
+//                        D3D11RenderContext.cpp
+//     TGDK Quantum GPU Accelerator — D3D11 Device-Context Adapter
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "D3D11RenderContext.hpp"
+
+namespace QUADRAQ {
+
+    void D3D11RenderContext::SetVertexBuffer(uint32_t slot, GpuHandle buffer, uint32_t stride, uint32_t offset) {
+        ID3D11Buffer* vertexBuffer = static_cast<ID3D11Buffer*>(buffer);
+        UINT strides = stride;
+        UINT offsets = offset;
+        context->IASetVertexBuffers(slot, 1, &vertexBuffer, &strides, &offsets);
+    }
+
+    void D3D11RenderContext::SetVertexShader(GpuHandle shader) {
+        context->VSSetShader(static_cast<ID3D11VertexShader*>(shader), nullptr, 0);
+    }
+
+    void D3D11RenderContext::SetPixelShader(GpuHandle shader) {
+        context->PSSetShader(static_cast<ID3D11PixelShader*>(shader), nullptr, 0);
+    }
+
+    void D3D11RenderContext::SetShaderResource(ShaderStage stage, uint32_t slot, GpuHandle view) {
+        ID3D11ShaderResourceView* srv = static_cast<ID3D11ShaderResourceView*>(view);
+        if (stage == ShaderStage::Vertex)
+            context->VSSetShaderResources(slot, 1, &srv);
+        else
+            context->PSSetShaderResources(slot, 1, &srv);
+    }
+
+    void D3D11RenderContext::SetPrimitiveTopology(uint32_t topology) {
+        context->IASetPrimitiveTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(topology));
+    }
+
+    void D3D11RenderContext::Draw(uint32_t vertexCount, uint32_t startVertex) {
+        context->Draw(vertexCount, startVertex);
+    }
+
+    namespace {
+        std::mutex cacheMutex;
+        D3D11RenderContext adapter(nullptr);    // guarded by cacheMutex
+        StateCache cache;                       // guarded by cacheMutex
+
+        StateCache& LockedCache(ID3D11DeviceContext* context) {
+            if (adapter.Native() != context) adapter = D3D11RenderContext(context);
+            cache.SetTarget(context ? &adapter : nullptr);  // also invalidates
+            return cache;
+        }
+    }
+
+    StateCacheScope::StateCacheScope(ID3D11DeviceContext* context)
+        : lock(cacheMutex), cache(LockedCache(context)) {}
+
+    StateCacheCounters StateCacheTotals() {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        return cache.Current();
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,114 @@
+// ====================================================================
+//                         D3D11UploadDevice.cpp
+//     TGDK Quantum GPU Accelerator — D3D11 Upload Adapter
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "D3D11UploadDevice.hpp"
+
+namespace QUADRAQ {
+
+    namespace {
+        UINT BindFlags(BufferKind kind) {
+            return kind == BufferKind::Constant
+                ? D3D11_BIND_CONSTANT_BUFFER
+                : D3D11_BIND_VERTEX_BUFFER | D3D11_BIND_INDEX_BUFFER;
+        }
+    }
+
+    D3D11UploadDevice::D3D11UploadDevice(ID3D11Device* device, ID3D11DeviceContext* context)
+        : device(device), context(context) {
+        if (!device || !context) return;
+
+        D3D11_QUERY_DESC desc = {};
+        desc.Query = D3D11_QUERY_EVENT;
+        for (ID3D11Query*& query : fenceQueries) {
+            if (FAILED(device->CreateQuery(&desc, &query))) {
+                query = nullptr;
+                ReleaseFenceQueries();
+                return;
+            }
+        }
+    }
+
+    D3D11UploadDevice::~D3D11UploadDevice() {
+        ReleaseFenceQueries();
+    }
+
+    void D3D11UploadDevice::ReleaseFenceQueries() {
+        for (ID3D11Query*& query : fenceQueries) {
+            if (query) query->Release();
+            query = nullptr;
+        }
+    }
+
+    GpuHandle D3D11UploadDevice::CreateDynamicBuffer(uint32_t byteSize, BufferKind kind) {
+        D3D11_BUFFER_DESC desc = {};
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.ByteWidth = byteSize;
+        desc.BindFlags = BindFlags(kind);
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+        ID3D11Buffer* buffer = nullptr;
+        if (!device || FAILED(device->CreateBuffer(&desc, nullptr, &buffer)))
+            return nullptr;
+        return buffer;
+    }
+
+    GpuHandle D3D11UploadDevice::CreateStaticBuffer(const void* data, uint32_t byteSize, BufferKind kind) {
+        D3D11_BUFFER_DESC desc = {};
+        desc.Usage = D3D11_USAGE_IMMUTABLE;
+        desc.ByteWidth = byteSize;
+        desc.BindFlags = BindFlags(kind);
+
+        D3D11_SUBRESOURCE_DATA initData = {};
+        initData.pSysMem = data;
+
+        ID3D11Buffer* buffer = nullptr;
+        if (!device || FAILED(device->CreateBuffer(&desc, &initData, &buffer)))
+            return nullptr;
+        return buffer;
+    }
+
+    void D3D11UploadDevice::ReleaseBuffer(GpuHandle buffer) {
+        if (buffer) static_cast<ID3D11Buffer*>(buffer)->Release();
+    }
+
+    void* D3D11UploadDevice::Map(GpuHandle buffer, MapMode mode) {
+        const D3D11_MAP map = mode == MapMode::Discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+
+        D3D11_MAPPED_SUBRESOURCE mapped = {};
+        if (FAILED(context->Map(static_cast<ID3D11Buffer*>(buffer), 0, map, 0, &mapped)))
+            return nullptr;
+        return mapped.pData;
+    }
+
+    void D3D11UploadDevice::Unmap(GpuHandle buffer) {
+        context->Unmap(static_cast<ID3D11Buffer*>(buffer), 0);
+    }
+
+    uint64_t D3D11UploadDevice::SignalFence() {
+        const uint64_t value = ++signalled;
+        if (!IsValid()) return value;
+
+        const uint32_t slot = static_cast<uint32_t>(value % kFenceQueries);
+        context->End(fenceQueries[slot]);
+        fenceValues[slot] = value;
+        return value;
+    }
+
+    uint64_t D3D11UploadDevice::CompletedFence() {
+        // The GPU retires fences in order, so stop at the first pending one
+        while (completed < signalled) {
+            const uint32_t slot = static_cast<uint32_t>((completed + 1) % kFenceQueries);
+            ID3D11Query* query = fenceQueries[slot];
+            if (!query || fenceValues[slot] <= completed) break;
+
+            BOOL done = FALSE;
+            if (context->GetData(query, &done, sizeof(done), 0) != S_OK || !done) break;
+            completed = fenceValues[slot];
+        }
+        return completed;
+    }
+
+} // namespace QUADRAQ
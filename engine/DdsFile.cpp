@@ -0,0 +1,356 @@
+// ====================================================================
+//                             DdsFile.cpp
+//     TGDK Quantum GPU Accelerator — Zero-Copy DDS Reader
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "DdsFile.hpp"
+
+#include <cstring>
+
+namespace QUADRAQ {
+
+    namespace {
+        uint32_t GetLE32(const uint8_t* bytes) {
+            return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+                   (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        }
+
+        constexpr uint32_t FourCC(char a, char b, char c, char d) {
+            return static_cast<uint32_t>(static_cast<uint8_t>(a)) | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+                   (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+        }
+
+        // Header flags and caps
+        constexpr uint32_t kFlagDepth = 0x800000;           // DDSD_DEPTH
+        constexpr uint32_t kPixelAlphaPixels = 0x1;         // DDPF_ALPHAPIXELS
+        constexpr uint32_t kPixelAlpha = 0x2;               // DDPF_ALPHA
+        constexpr uint32_t kPixelFourCC = 0x4;              // DDPF_FOURCC
+        constexpr uint32_t kPixelRgb = 0x40;                // DDPF_RGB
+        constexpr uint32_t kPixelLuminance = 0x20000;       // DDPF_LUMINANCE
+        constexpr uint32_t kPixelBumpDuDv = 0x80000;        // DDPF_BUMPDUDV
+        constexpr uint32_t kCaps2Cubemap = 0x200;
+        constexpr uint32_t kCaps2AllFaces = 0xFC00;
+
+        // DX10 header
+        constexpr uint32_t kDimension1D = 2;                // D3D10_RESOURCE_DIMENSION_TEXTURE1D
+        constexpr uint32_t kDimension2D = 3;
+        constexpr uint32_t kDimension3D = 4;
+        constexpr uint32_t kMiscTextureCube = 0x4;          // D3D11_RESOURCE_MISC_TEXTURECUBE
+
+        struct PixelFormat {
+            uint32_t flags;
+            uint32_t fourCC;
+            uint32_t bitCount;
+            uint32_t masks[4];          // r, g, b, a
+
+            bool Is(uint32_t r, uint32_t g, uint32_t b, uint32_t a) const {
+                return masks[0] == r && masks[1] == g && masks[2] == b && masks[3] == a;
+            }
+        };
+
+        // How a DXGI format lays out a row; blockBytes 0 for per-pixel formats
+        struct FormatLayout {
+            uint32_t bitsPerPixel;
+            uint32_t blockBytes;        // per 4x4 block
+            bool packed;                // two pixels per 4-byte element
+        };
+
+        bool LayoutOf(uint32_t format, FormatLayout& layout) {
+            layout = { 0, 0, false };
+
+            if (format >= 1 && format <= 4) layout.bitsPerPixel = 128;            // R32G32B32A32
+            else if (format >= 5 && format <= 8) layout.bitsPerPixel = 96;        // R32G32B32
+            else if (format >= 9 && format <= 22) layout.bitsPerPixel = 64;       // R16G16B16A16 .. X32_TYPELESS_G8X24
+            else if (format >= 23 && format <= 47) layout.bitsPerPixel = 32;      // R10G10B10A2 .. X24_TYPELESS_G8
+            else if (format >= 48 && format <= 59) layout.bitsPerPixel = 16;      // R8G8 .. R16
+            else if (format >= 60 && format <= 65) layout.bitsPerPixel = 8;       // R8 .. A8
+            else if (format == 66) layout.bitsPerPixel = 1;                       // R1_UNORM
+            else if (format == 67) layout.bitsPerPixel = 32;                      // R9G9B9E5_SHAREDEXP
+            else if (format == 68 || format == 69) layout.packed = true;          // R8G8_B8G8, G8R8_G8B8
+            else if (format >= 70 && format <= 72) layout.blockBytes = 8;         // BC1
+            else if (format >= 73 && format <= 78) layout.blockBytes = 16;        // BC2, BC3
+            else if (format >= 79 && format <= 81) layout.blockBytes = 8;         // BC4
+            else if (format >= 82 && format <= 84) layout.blockBytes = 16;        // BC5
+            else if (format == 85 || format == 86) layout.bitsPerPixel = 16;      // B5G6R5, B5G5R5A1
+            else if (format >= 87 && format <= 93) layout.bitsPerPixel = 32;      // B8G8R8A8 family
+            else if (format >= 94 && format <= 99) layout.blockBytes = 16;        // BC6H, BC7
+            else if (format == 115) layout.bitsPerPixel = 16;                     // B4G4R4A4
+            else return false;
+            return true;
+        }
+
+        // DXGI format for a header without the DX10 extension, or 0
+        uint32_t LegacyFormat(const PixelFormat& pf) {
+            if (pf.flags & kPixelFourCC) {
+                switch (pf.fourCC) {
+                case FourCC('D', 'X', 'T', '1'): return 71;                     // BC1_UNORM
+                case FourCC('D', 'X', 'T', '2'):
+                case FourCC('D', 'X', 'T', '3'): return 74;                     // BC2_UNORM
+                case FourCC('D', 'X', 'T', '4'):
+                case FourCC('D', 'X', 'T', '5'): return 77;                     // BC3_UNORM
+                case FourCC('A', 'T', 'I', '1'):
+                case FourCC('B', 'C', '4', 'U'): return 80;                     // BC4_UNORM
+                case FourCC('B', 'C', '4', 'S'): return 81;                     // BC4_SNORM
+                case FourCC('A', 'T', 'I', '2'):
+                case FourCC('B', 'C', '5', 'U'): return 83;                     // BC5_UNORM
+                case FourCC('B', 'C', '5', 'S'): return 84;                     // BC5_SNORM
+                case FourCC('R', 'G', 'B', 'G'): return 68;                     // R8G8_B8G8_UNORM
+                case FourCC('G', 'R', 'G', 'B'): return 69;                     // G8R8_G8B8_UNORM
+                // D3DFORMAT values stored as the FourCC
+                case 36:  return 11;                                            // R16G16B16A16_UNORM
+                case 110: return 13;                                            // R16G16B16A16_SNORM
+                case 111: return 54;                                            // R16_FLOAT
+                case 112: return 34;                                            // R16G16_FLOAT
+                case 113: return 10;                                            // R16G16B16A16_FLOAT
+                case 114: return 41;                                            // R32_FLOAT
+                case 115: return 16;                                            // R32G32_FLOAT
+                case 116: return 2;                                             // R32G32B32A32_FLOAT
+                default:  return 0;
+                }
+            }
+
+            if (pf.flags & kPixelRgb) {
+                if (pf.bitCount == 32) {
+                    if (pf.Is(0xFF, 0xFF00, 0xFF0000, 0xFF000000)) return 28;             // R8G8B8A8_UNORM
+                    if (pf.Is(0xFF0000, 0xFF00, 0xFF, 0xFF000000)) return 87;             // B8G8R8A8_UNORM
+                    if (pf.Is(0xFF0000, 0xFF00, 0xFF, 0)) return 88;                      // B8G8R8X8_UNORM
+                    if (pf.Is(0x3FF, 0xFFC00, 0x3FF00000, 0xC0000000)) return 24;         // R10G10B10A2_UNORM
+                    if (pf.Is(0xFFFF, 0xFFFF0000, 0, 0)) return 35;                       // R16G16_UNORM
+                    if (pf.Is(0xFFFFFFFF, 0, 0, 0)) return 41;                            // R32_FLOAT
+                } else if (pf.bitCount == 16) {
+                    if (pf.Is(0x7C00, 0x3E0, 0x1F, 0x8000)) return 86;                    // B5G5R5A1_UNORM
+                    if (pf.Is(0xF800, 0x7E0, 0x1F, 0)) return 85;                         // B5G6R5_UNORM
+                    if (pf.Is(0xF00, 0xF0, 0xF, 0xF000)) return 115;                      // B4G4R4A4_UNORM
+                }
+                return 0;
+            }
+
+            if (pf.flags & kPixelLuminance) {
+                if (pf.bitCount == 8 && pf.Is(0xFF, 0, 0, 0)) return 61;                 // R8_UNORM
+                if (pf.bitCount == 16 && pf.Is(0xFFFF, 0, 0, 0)) return 56;              // R16_UNORM
+                if (pf.bitCount == 16 && pf.Is(0xFF, 0, 0, 0xFF00)) return 49;           // R8G8_UNORM
+                return 0;
+            }
+
+            if ((pf.flags & kPixelAlpha) && !(pf.flags & kPixelAlphaPixels)) {
+                return pf.bitCount == 8 ? 65 : 0;                                           // A8_UNORM
+            }
+
+            if (pf.flags & kPixelBumpDuDv) {
+                if (pf.bitCount == 16 && pf.Is(0xFF, 0xFF00, 0, 0)) return 51;           // R8G8_SNORM
+                if (pf.bitCount == 32 && pf.Is(0xFF, 0xFF00, 0xFF0000, 0xFF000000)) return 31;   // R8G8B8A8_SNORM
+                if (pf.bitCount == 32 && pf.Is(0xFFFF, 0xFFFF0000, 0, 0)) return 37;     // R16G16_SNORM
+                return 0;
+            }
+
+            return 0;
+        }
+
+        uint32_t FullMipChain(uint32_t width, uint32_t height, uint32_t depth) {
+            uint32_t largest = width > height ? width : height;
+            if (depth > largest) largest = depth;
+
+            uint32_t levels = 1;
+            while (largest > 1) {
+                largest >>= 1;
+                ++levels;
+            }
+            return levels;
+        }
+    }
+
+    bool DdsFile::Open(const std::string& path) {
+        Close();
+        error.clear();
+
+        if (!file.Open(path)) return Fail(file.Error());
+        return Parse(file.Data(), file.Size());
+    }
+
+    bool DdsFile::Open(const std::wstring& path) {
+        Close();
+        error.clear();
+
+        if (!file.Open(path)) return Fail(file.Error());
+        return Parse(file.Data(), file.Size());
+    }
+
+    bool DdsFile::OpenMemory(const void* data, size_t size) {
+        Close();
+        error.clear();
+        return Parse(static_cast<const uint8_t*>(data), size);
+    }
+
+    void DdsFile::Close() {
+        file.Close();
+        info = DdsInfo();
+        subresources.clear();
+        dataSize = 0;
+    }
+
+    DdsSubresource DdsFile::Subresource(uint32_t mip, uint32_t arraySlice) const {
+        if (mip >= info.mipLevels) return DdsSubresource();
+
+        const size_t index = static_cast<size_t>(arraySlice) * info.mipLevels + mip;
+        return index < subresources.size() ? subresources[index] : DdsSubresource();
+    }
+
+    bool DdsFile::Parse(const uint8_t* bytes, size_t size) {
+        if (size < sizeof(DdsFormat::kMagic) + DdsFormat::kHeaderSize) return Fail("truncated header");
+        if (std::memcmp(bytes, DdsFormat::kMagic, 4) != 0) return Fail("not a DDS file");
+
+        const uint8_t* header = bytes + 4;
+        if (GetLE32(header) != DdsFormat::kHeaderSize) return Fail("bad header size");
+        if (GetLE32(header + 72) != DdsFormat::kPixelFormatSize) return Fail("bad pixel format size");
+
+        const uint32_t flags = GetLE32(header + 4);
+        const uint32_t caps2 = GetLE32(header + 108);
+
+        PixelFormat pixelFormat;
+        pixelFormat.flags = GetLE32(header + 76);
+        pixelFormat.fourCC = GetLE32(header + 80);
+        pixelFormat.bitCount = GetLE32(header + 84);
+        for (size_t i = 0; i < 4; ++i) pixelFormat.masks[i] = GetLE32(header + 88 + 4 * i);
+
+        DdsInfo parsed;
+        parsed.width = GetLE32(header + 12);
+        parsed.height = GetLE32(header + 8);
+        parsed.depth = 1;
+        parsed.mipLevels = GetLE32(header + 24);
+        if (parsed.mipLevels == 0) parsed.mipLevels = 1;
+        parsed.arraySize = 1;
+
+        size_t dataOffset = 4 + DdsFormat::kHeaderSize;
+
+        if ((pixelFormat.flags & kPixelFourCC) && pixelFormat.fourCC == FourCC('D', 'X', '1', '0')) {
+            if (size < dataOffset + DdsFormat::kDx10HeaderSize) return Fail("truncated DX10 header");
+
+            const uint8_t* dx10 = bytes + dataOffset;
+            dataOffset += DdsFormat::kDx10HeaderSize;
+
+            parsed.format = GetLE32(dx10);
+            const uint32_t dimension = GetLE32(dx10 + 4);
+            const uint32_t miscFlag = GetLE32(dx10 + 8);
+            parsed.arraySize = GetLE32(dx10 + 12);
+            if (parsed.arraySize == 0) return Fail("DX10 array size is 0");
+
+            switch (dimension) {
+            case kDimension1D:
+                // Some writers leave height as 0 for 1D
+                if (parsed.height > 1) return Fail("1D texture with height " + std::to_string(parsed.height));
+                parsed.height = 1;
+                parsed.dimension = DdsDimension::Texture1D;
+                break;
+            case kDimension2D:
+                parsed.dimension = DdsDimension::Texture2D;
+                parsed.cube = (miscFlag & kMiscTextureCube) != 0;
+                break;
+            case kDimension3D:
+                if (!(flags & kFlagDepth)) return Fail("3D texture without depth flag");
+                if (parsed.arraySize > 1) return Fail("3D texture arrays are not supported");
+                parsed.depth = GetLE32(header + 20);
+                parsed.dimension = DdsDimension::Texture3D;
+                break;
+            default:
+                return Fail("bad DX10 resource dimension " + std::to_string(dimension));
+            }
+        } else {
+            parsed.legacyHeader = true;
+            parsed.format = LegacyFormat(pixelFormat);
+            if (parsed.format == 0) return Fail("unsupported legacy pixel format");
+
+            // DDSD_DEPTH decides; some writers omit DDSCAPS2_VOLUME
+            if (flags & kFlagDepth) {
+                parsed.depth = GetLE32(header + 20);
+                parsed.dimension = DdsDimension::Texture3D;
+            } else if (caps2 & kCaps2Cubemap) {
+                // D3D10+ cannot create partial cube maps
+                if ((caps2 & kCaps2AllFaces) != kCaps2AllFaces) return Fail("partial cube map");
+                parsed.cube = true;
+            }
+        }
+
+        FormatLayout layout;
+        if (!LayoutOf(parsed.format, layout)) return Fail("unsupported DXGI format " + std::to_string(parsed.format));
+
+        if (parsed.width == 0 || parsed.height == 0 || parsed.depth == 0) return Fail("zero-sized texture");
+
+        const uint32_t faces = parsed.cube ? 6 : 1;
+        if (parsed.dimension == DdsDimension::Texture3D) {
+            if (parsed.width > DdsFormat::kMaxVolumeDimension || parsed.height > DdsFormat::kMaxVolumeDimension ||
+                parsed.depth > DdsFormat::kMaxVolumeDimension)
+                return Fail("volume larger than " + std::to_string(DdsFormat::kMaxVolumeDimension));
+        } else {
+            if (parsed.width > DdsFormat::kMaxTextureDimension || parsed.height > DdsFormat::kMaxTextureDimension)
+                return Fail("texture larger than " + std::to_string(DdsFormat::kMaxTextureDimension));
+            if (parsed.cube && parsed.width != parsed.height) return Fail("cube map faces are not square");
+            if (parsed.arraySize > DdsFormat::kMaxArraySize / faces)
+                return Fail("array of " + std::to_string(parsed.arraySize) + " is too large");
+        }
+
+        if (parsed.mipLevels > DdsFormat::kMaxMipLevels ||
+            parsed.mipLevels > FullMipChain(parsed.width, parsed.height, parsed.depth))
+            return Fail(std::to_string(parsed.mipLevels) + " mips exceed the full chain");
+
+        // Lay the subresources out in file order, checking each against the file
+        std::vector<DdsSubresource> views;
+        views.reserve(static_cast<size_t>(parsed.arraySize) * faces * parsed.mipLevels);
+
+        uint64_t offset = dataOffset;
+        for (uint32_t slice = 0; slice < parsed.arraySize * faces; ++slice) {
+            uint32_t width = parsed.width;
+            uint32_t height = parsed.height;
+            uint32_t depth = parsed.depth;
+
+            for (uint32_t mip = 0; mip < parsed.mipLevels; ++mip) {
+                uint64_t rowPitch;
+                uint64_t rows;
+                if (layout.blockBytes != 0) {
+                    rowPitch = static_cast<uint64_t>((width + 3) / 4) * layout.blockBytes;
+                    rows = (height + 3) / 4;
+                } else if (layout.packed) {
+                    rowPitch = static_cast<uint64_t>((width + 1) / 2) * 4;
+                    rows = height;
+                } else {
+                    rowPitch = (static_cast<uint64_t>(width) * layout.bitsPerPixel + 7) / 8;
+                    rows = height;
+                }
+
+                const uint64_t slicePitch = rowPitch * rows;
+                if (slicePitch > UINT32_MAX) return Fail("subresource slice larger than 4 GiB");
+
+                const uint64_t bytesNeeded = slicePitch * depth;
+                if (bytesNeeded > size - offset)
+                    return Fail("truncated pixel data at slice " + std::to_string(slice) + " mip " + std::to_string(mip));
+
+                DdsSubresource view;
+                view.data = bytes + offset;
+                view.size = static_cast<size_t>(bytesNeeded);
+                view.width = width;
+                view.height = height;
+                view.depth = depth;
+                view.rowPitch = static_cast<uint32_t>(rowPitch);
+                view.slicePitch = static_cast<uint32_t>(slicePitch);
+                views.push_back(view);
+
+                offset += bytesNeeded;
+                width = width > 1 ? width / 2 : 1;
+                height = height > 1 ? height / 2 : 1;
+                depth = depth > 1 ? depth / 2 : 1;
+            }
+        }
+
+        info = parsed;
+        subresources.swap(views);
+        dataSize = static_cast<size_t>(offset - dataOffset);
+        return true;
+    }
+
+    bool DdsFile::Fail(const std::string& message) {
+        Close();
+        error = message;
+        return false;
+    }
+
+} // namespace QUADRAQ
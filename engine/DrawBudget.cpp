@@ -0,0 +1,94 @@
+// ====================================================================
+//                           DrawBudget.cpp
+//     TGDK Quantum GPU Accelerator — Cost-Aware Draw Suppression
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "DrawBudget.hpp"
+
+#include <algorithm>
+
+namespace QUADRAQ {
+
+    namespace {
+        constexpr size_t kSmallRange = 32;
+    }
+
+    DrawBudgetResult DrawBudgetSelector::Select(const float* costs, const uint8_t* classes, size_t count, float excess,
+        const float* classWeights, size_t classCount, uint64_t* survivorMask) {
+
+        DrawBudgetResult result;
+        const size_t words = (count + 63) / 64;
+        std::fill(survivorMask, survivorMask + words, ~0ull);
+        if (count & 63) survivorMask[words - 1] = (1ull << (count & 63)) - 1;
+        if (count == 0 || excess <= 0.0f) return result;
+
+        candidates.clear();
+        for (size_t i = 0; i < count; ++i) {
+            const size_t cls = classes ? classes[i] : 0;
+            const float weight = cls < classCount ? classWeights[cls] : 0.0f;
+            if (weight < 0.0f || !(costs[i] > 0.0f)) continue;
+            candidates.push_back({ weight / costs[i], costs[i], static_cast<uint32_t>(i) });
+        }
+
+        // Find the shortest ratio-ordered prefix whose cost covers `need`.
+        // Everything left of `lo` is in it, everything from `hi` on is not.
+        Candidate* items = candidates.data();
+        size_t lo = 0;
+        size_t hi = candidates.size();
+        double need = excess;       // double: summation order must not flip the cut
+
+        while (hi - lo > kSmallRange) {
+            const float a = items[lo].ratio;
+            const float b = items[lo + (hi - lo) / 2].ratio;
+            const float c = items[hi - 1].ratio;
+            const float pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+            Candidate* first = items + lo;
+            Candidate* last = items + hi;
+            Candidate* lt = std::partition(first, last, [pivot](const Candidate& x) { return x.ratio < pivot; });
+            Candidate* gt = std::partition(lt, last, [pivot](const Candidate& x) { return x.ratio == pivot; });
+
+            double below = 0.0;
+            for (Candidate* x = first; x != lt; ++x) below += x->cost;
+            double equal = 0.0;
+            for (Candidate* x = lt; x != gt; ++x) equal += x->cost;
+
+            if (below >= need) {
+                hi = static_cast<size_t>(lt - items);
+            }
+            else if (below + equal >= need) {
+                need -= below;
+                lo = static_cast<size_t>(lt - items);
+                hi = static_cast<size_t>(gt - items);
+                break;      // equal ratios: any order within the run is fine
+            }
+            else {
+                need -= below + equal;
+                lo = static_cast<size_t>(gt - items);
+            }
+        }
+
+        if (hi - lo > 1) {
+            std::sort(items + lo, items + hi, [](const Candidate& x, const Candidate& y) { return x.ratio < y.ratio; });
+        }
+        size_t cut = hi;
+        for (size_t i = lo; i < hi; ++i) {
+            if (need <= 0.0) {
+                cut = i;
+                break;
+            }
+            need -= items[i].cost;
+        }
+
+        for (size_t i = 0; i < cut; ++i) {
+            const uint32_t draw = items[i].draw;
+            survivorMask[draw >> 6] &= ~(1ull << (draw & 63));
+            result.droppedCost += items[i].cost;
+        }
+        result.dropped = cut;
+        result.unmetExcess = static_cast<float>(std::max(need, 0.0));
+        return result;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,130 @@
+// ====================================================================
+//                        DrawSignatureTable.cpp
+//     TGDK Quantum GPU Accelerator — Cross-Frame Draw History
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "DrawSignatureTable.hpp"
+
+#include <algorithm>
+
+namespace QUADRAQ {
+
+    namespace {
+        constexpr size_t kSweepDivisor = 64;        // whole table aged every 64 frames
+        constexpr float kContributionGain = 0.25f;
+
+        uint64_t Mix(uint64_t x) {
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            x *= 0xC4CEB9FE1A85EC53ull;
+            x ^= x >> 33;
+            return x;
+        }
+
+        uint64_t HandleBits(const void* handle) {
+            return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+        }
+    }
+
+    DrawSignatureTable::DrawSignatureTable(size_t capacity, uint32_t maxAgeFrames)
+        : maxAge(std::max<uint32_t>(maxAgeFrames, 1)) {
+        size_t size = kProbeLimit;
+        while (size < capacity) size <<= 1;
+        slots.resize(size);
+        mask = size - 1;
+        stats.capacity = size;
+    }
+
+    uint64_t DrawSignatureTable::Fingerprint(const void* vertexBuffer, uint32_t stride, uint32_t offset,
+        const void* vertexShader, const void* pixelShader, const void* texture) {
+        uint64_t h = Mix(HandleBits(vertexBuffer) ^ (static_cast<uint64_t>(stride) << 32 | offset));
+        h = Mix(h ^ HandleBits(vertexShader));
+        h = Mix(h ^ HandleBits(pixelShader));
+        h = Mix(h ^ HandleBits(texture));
+        return h ? h : 1;   // 0 marks an empty slot
+    }
+
+    DrawHistory* DrawSignatureTable::Touch(uint64_t signature) {
+        if (signature == 0) signature = 1;
+        ++stats.lookups;
+
+        // Two homes of kProbeLimit / 2 slots each; deletions leave holes, so
+        // both windows are always scanned in full
+        DrawHistory* empty = nullptr;
+        DrawHistory* oldest = nullptr;
+        for (size_t i = 0; i < kProbeLimit; ++i) {
+            DrawHistory& slot = slots[Slot(signature, i)];
+            if (slot.signature == signature) {
+                if (slot.lastSeenFrame != frame) {
+                    slot.lastSeenFrame = frame;
+                    if (slot.framesSeen != UINT16_MAX) ++slot.framesSeen;
+                }
+                return &slot;
+            }
+            if (slot.signature == 0) {
+                if (!empty) empty = &slot;
+            }
+            else if (!oldest || frame - slot.lastSeenFrame > frame - oldest->lastSeenFrame) {
+                oldest = &slot;
+            }
+        }
+
+        DrawHistory* target = empty;
+        if (!target) {
+            target = oldest;
+            ++stats.evictions;
+        }
+        else {
+            ++stats.occupied;
+        }
+
+        *target = DrawHistory{};
+        target->signature = signature;
+        target->lastSeenFrame = frame;
+        target->framesSeen = 1;
+        ++stats.inserts;
+        return target;
+    }
+
+    const DrawHistory* DrawSignatureTable::Find(uint64_t signature) const {
+        if (signature == 0) signature = 1;
+
+        for (size_t i = 0; i < kProbeLimit; ++i) {
+            const DrawHistory& slot = slots[Slot(signature, i)];
+            if (slot.signature == signature) return &slot;
+        }
+        return nullptr;
+    }
+
+    void DrawSignatureTable::ReportImpact(uint64_t signature, float contribution, uint8_t impactFlags) {
+        DrawHistory* history = Touch(signature);
+        history->contribution += kContributionGain * (contribution - history->contribution);
+        history->impactFlags |= impactFlags;
+    }
+
+    void DrawSignatureTable::AdvanceFrame(uint32_t frameIndex) {
+        frame = frameIndex;
+
+        const size_t slice = std::max<size_t>(slots.size() / kSweepDivisor, 1);
+        for (size_t i = 0; i < slice; ++i) {
+            DrawHistory& slot = slots[sweepCursor];
+            sweepCursor = (sweepCursor + 1) & mask;
+
+            if (slot.signature != 0 && frame - slot.lastSeenFrame > maxAge) {
+                slot = DrawHistory{};
+                --stats.occupied;
+                ++stats.expired;
+            }
+        }
+    }
+
+    void DrawSignatureTable::Clear() {
+        std::fill(slots.begin(), slots.end(), DrawHistory{});
+        sweepCursor = 0;
+        stats = DrawSignatureStats{};
+        stats.capacity = slots.size();
+    }
+
+} // namespace QUADRAQ
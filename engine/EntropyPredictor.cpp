@@ -7,34 +7,107 @@
 
 #include "EntropyPredictor.hpp"
 #include "TGDK_IAIBackend.hpp"
-#include <DDSTextureLoader.h>
+#include "RingStats.hpp"
+#include "FrameTimeHistogram.hpp"
+#include "FrameTimeForecaster.hpp"
+#include "ChangePointDetector.hpp"
+#include "SignalChannelBank.hpp"
+#include "FrameClock.hpp"
+#include "FrameTrace.hpp"
+#include "SeqLock.hpp"
 
-#include <chrono>
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <mutex>
-#include <deque>
 
 
 namespace EntropyPredictor {
 
     static IAIBackend* gAIBackendPtr = nullptr;
-    static std::deque<float> frameTimes;
-    static const size_t sampleWindow = 120; // Sliding window of last N frames
-    static std::chrono::high_resolution_clock::time_point lastTime;
+    static const size_t defaultSampleWindow = 120; // Sliding window of last N frames
+    static QUADRAQ::RingStats frameTimes(defaultSampleWindow);
+    static uint64_t lastTime = 0;          // FrameClock nanoseconds
+    static QUADRAQ::FrameTraceWriter capture;
+
+    // Tail-latency sketches: 1 s in 100 ms slices, 1 min in 5 s slices, whole session
+    static QUADRAQ::WindowedFrameTimeHistogram<10> lastSecond(100000);
+    static QUADRAQ::WindowedFrameTimeHistogram<12> lastMinute(5000000);
+    static QUADRAQ::FrameTimeHistogram session;
     static std::mutex entropyMutex;
 
+    // Overload detection: forecast (or measured) frame time with hysteresis
+    static QUADRAQ::FrameTimeForecaster forecaster;
+    static OverloadPolicy overloadPolicy;
+    static bool forecastingEnabled = true;
+    static uint32_t overloadStreak = 0;     // consecutive frames past the enter/exit threshold
+
+    // Scene transitions: level-shift detector plus a fixed subscriber table
+    struct SceneSubscriber {
+        SceneTransitionCallback callback = nullptr;
+        void* userData = nullptr;
+    };
+    static const size_t maxSceneSubscribers = 16;
+    static QUADRAQ::ChangePointDetector sceneDetector;
+    static std::array<SceneSubscriber, maxSceneSubscribers> sceneSubscribers;
+    static uint32_t sceneIndex = 0;
+
+    // Named input channels (frame time, GPU counters, CPU load, ...).
+    // Built-in ids are registered on first use, in Channels:: order.
+    static QUADRAQ::SignalChannelBank& ChannelBankLocked() {
+        static QUADRAQ::SignalChannelBank bank;
+        if (bank.Count() == 0) {
+            bank.Register("frame_time", 2.0f);
+            bank.Register("vs_invocations");
+            bank.Register("ps_invocations");
+            bank.Register("raster_primitives");
+            bank.Register("cpu_load");
+        }
+        return bank;
+    }
+
     static float entropyRate = 0.0f;
     static bool initialized = false;
     static bool enabled = false;
-
-    // Add a static variable to track overload state
     static bool overload = false;
+    static uint64_t frameIndex = 0;
+
+    // Lock-free view for draw-time readers. Only written under entropyMutex.
+    static QUADRAQ::SeqLock<Snapshot> published;
+
+    static void PublishLocked() {
+        Snapshot snapshot;
+        snapshot.entropyRate = entropyRate;
+        snapshot.meanFrameTime = frameTimes.Mean();
+        snapshot.overloaded = overload;
+        snapshot.frameIndex = frameIndex;
+        snapshot.forecastLevel = forecaster.Level();
+        snapshot.forecastTrend = forecaster.Trend();
+        snapshot.forecastConfidence = forecaster.Confidence();
+        snapshot.sceneIndex = sceneIndex;
+        snapshot.fusedScore = ChannelBankLocked().FusedScore();
+        published.Store(snapshot);
+    }
+
+    static void ResetLocked() {
+        frameTimes.Clear();
+        lastSecond.Clear();
+        lastMinute.Clear();
+        session.Clear();
+        forecaster.Reset();
+        sceneDetector.Reset();
+        ChannelBankLocked().Clear();
+        lastTime = FrameClock::NowNanoseconds();
+        entropyRate = 0.0f;
+        overload = false;
+        overloadStreak = 0;
+        PublishLocked();
+    }
 
     bool Initialize() {
         std::lock_guard<std::mutex> lock(entropyMutex);
-        frameTimes.clear();
-        lastTime = std::chrono::high_resolution_clock::now();
-        entropyRate = 0.0f;
+        ResetLocked();
         initialized = true;
 
         if (GetAIBackend()) {
@@ -48,12 +121,14 @@ namespace EntropyPredictor {
         std::lock_guard<std::mutex> lock(entropyMutex);
         enabled = enable;
         if (enable) {
-            if (!initialized) Initialize();
+            if (!initialized) {
+                ResetLocked();
+                initialized = true;
+            }
             if (gAIBackendPtr) gAIBackendPtr->Log("EntropyPredictor :: Enabled");
         }
         else {
-            frameTimes.clear();
-            entropyRate = 0.0f;
+            ResetLocked();
             initialized = false;
             if (gAIBackendPtr) gAIBackendPtr->Log("EntropyPredictor :: Disabled");
         }
@@ -64,40 +139,271 @@ namespace EntropyPredictor {
         return enabled;
     }
 
-    bool EntropyPredictor::IsOverloaded() {
-        return overload;
+    bool IsOverloaded() {
+        return published.Load().overloaded;
     }
 
     float GetCurrentEntropyRate() {
+        return published.Load().entropyRate;
+    }
+
+    Snapshot GetSnapshot() {
+        return published.Load();
+    }
+
+    float PredictNextFrameTime(uint32_t framesAhead) {
+        const Snapshot snapshot = published.Load();
+        if (framesAhead == 0) framesAhead = 1;
+        return std::max(0.0f, snapshot.forecastLevel + snapshot.forecastTrend * static_cast<float>(framesAhead));
+    }
+
+    float GetForecastConfidence() {
+        return published.Load().forecastConfidence;
+    }
+
+    void SetForecastingEnabled(bool enable) {
         std::lock_guard<std::mutex> lock(entropyMutex);
-        return entropyRate;
+        forecastingEnabled = enable;
+        overloadStreak = 0;
+
+        if (gAIBackendPtr)
+            gAIBackendPtr->Log(std::string("EntropyPredictor :: Forecasting ") + (enable ? "ENABLED" : "DISABLED"));
     }
 
-    void UpdateCycle() {
+    bool IsForecastingEnabled() {
         std::lock_guard<std::mutex> lock(entropyMutex);
+        return forecastingEnabled;
+    }
+
+    void SetOverloadPolicy(const OverloadPolicy& policy) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        overloadPolicy = policy;
+        if (overloadPolicy.exitFrameTime > overloadPolicy.enterFrameTime)
+            overloadPolicy.exitFrameTime = overloadPolicy.enterFrameTime;
+        if (overloadPolicy.enterFrames == 0) overloadPolicy.enterFrames = 1;
+        if (overloadPolicy.exitFrames == 0) overloadPolicy.exitFrames = 1;
+        if (overloadPolicy.horizonFrames == 0) overloadPolicy.horizonFrames = 1;
+        if (overloadPolicy.fusedExitScore > overloadPolicy.fusedEnterScore)
+            overloadPolicy.fusedExitScore = overloadPolicy.fusedEnterScore;
+        overloadStreak = 0;
+    }
+
+    OverloadPolicy GetOverloadPolicy() {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        return overloadPolicy;
+    }
+
+    void SetSampleWindow(size_t frames) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        frameTimes.Resize(frames);
+        entropyRate = 0.0f;
+        PublishLocked();
+
+        if (gAIBackendPtr)
+            gAIBackendPtr->Log("EntropyPredictor :: Sample window set to " + std::to_string(frameTimes.Capacity()));
+    }
+
+    size_t GetSampleWindow() {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        return frameTimes.Capacity();
+    }
+
+    Percentiles GetFrameTimePercentiles(Horizon horizon) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+
+        const QUADRAQ::FrameTimeHistogram* histogram = &session;
+        if (horizon == Horizon::LastSecond) histogram = &lastSecond.Aggregate();
+        else if (horizon == Horizon::LastMinute) histogram = &lastMinute.Aggregate();
+
+        Percentiles result;
+        result.p50 = histogram->Quantile(0.50) * 1e-6f;
+        result.p95 = histogram->Quantile(0.95) * 1e-6f;
+        result.p99 = histogram->Quantile(0.99) * 1e-6f;
+        result.p999 = histogram->Quantile(0.999) * 1e-6f;
+        result.samples = histogram->Count();
+        return result;
+    }
+
+    int SubscribeSceneTransition(SceneTransitionCallback callback, void* userData) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        if (!callback) return -1;
+
+        for (size_t i = 0; i < sceneSubscribers.size(); ++i) {
+            if (!sceneSubscribers[i].callback) {
+                sceneSubscribers[i].callback = callback;
+                sceneSubscribers[i].userData = userData;
+                return static_cast<int>(i);
+            }
+        }
+
+        if (gAIBackendPtr)
+            gAIBackendPtr->LogError("EntropyPredictor :: Scene transition subscriber table full.");
+        return -1;
+    }
+
+    void UnsubscribeSceneTransition(int id) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        if (id < 0 || static_cast<size_t>(id) >= sceneSubscribers.size()) return;
+        sceneSubscribers[id] = SceneSubscriber{};
+    }
+
+    void SetSceneDetection(const SceneDetectionParameters& params) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        sceneDetector.Configure(params);
+    }
+
+    ChannelId RegisterChannel(const char* name, float weight) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        const ChannelId id = ChannelBankLocked().Register(name, weight);
+        if (id == InvalidChannel && gAIBackendPtr)
+            gAIBackendPtr->LogError("EntropyPredictor :: Could not register channel " + std::string(name ? name : "(null)"));
+        return id;
+    }
+
+    ChannelId FindChannel(const char* name) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        return ChannelBankLocked().Find(name);
+    }
+
+    void PushChannelSample(ChannelId channel, float value) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        if (!initialized || !enabled) return;
+        ChannelBankLocked().Push(channel, value);
+    }
+
+    bool GetChannelStats(ChannelId channel, ChannelStats& out) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        QUADRAQ::SignalChannelBank& bank = ChannelBankLocked();
+        if (channel >= bank.Count()) return false;
+
+        out.name = bank.Name(channel);
+        out.last = bank.Last(channel);
+        out.mean = bank.Stats(channel).Mean();
+        out.stdDev = bank.Stats(channel).StdDev();
+        out.zScore = bank.ZScore(channel);
+        out.weight = bank.Weight(channel);
+        out.live = bank.IsLive(channel);
+        return true;
+    }
+
+    float GetFusedOverloadScore() {
+        return published.Load().fusedScore;
+    }
+
+    bool StartCapture(const std::string& path) {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        if (capture.IsOpen()) return false;
+
+        if (!capture.Open(path)) {
+            if (gAIBackendPtr) gAIBackendPtr->LogError("EntropyPredictor :: Could not open capture " + path);
+            return false;
+        }
+
+        if (gAIBackendPtr) gAIBackendPtr->Log("EntropyPredictor :: Capturing frame times to " + path);
+        return true;
+    }
+
+    void StopCapture() {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        if (!capture.IsOpen()) return;
+
+        capture.Close();
+        if (gAIBackendPtr)
+            gAIBackendPtr->Log("EntropyPredictor :: Capture closed (" + std::to_string(capture.FramesWritten()) +
+                " frames, " + std::to_string(capture.FramesDropped()) + " dropped)");
+    }
+
+    bool IsCapturing() {
+        std::lock_guard<std::mutex> lock(entropyMutex);
+        return capture.IsOpen();
+    }
+
+    // Raises overload after `enterFrames` consecutive frames above the enter
+    // threshold and clears it after `exitFrames` consecutive frames below
+    // the exit threshold. Frames in between reset the streak.
+    static void EvaluateOverloadLocked(float dt) {
+        float signal = dt;
+        if (forecastingEnabled) {
+            // Holt forecasts are linear, so the horizon maximum is at one end
+            signal = std::max(forecaster.Predict(1), forecaster.Predict(overloadPolicy.horizonFrames));
+        }
+
+        // Fused channel score can raise overload on its own; clearing needs both calm
+        const float fused = ChannelBankLocked().FusedScore();
+        const bool fusedActive = overloadPolicy.fusedEnterScore > 0.0f;
+        const bool pastThreshold = overload
+            ? signal < overloadPolicy.exitFrameTime && (!fusedActive || fused < overloadPolicy.fusedExitScore)
+            : signal > overloadPolicy.enterFrameTime || (fusedActive && fused > overloadPolicy.fusedEnterScore);
+        overloadStreak = pastThreshold ? overloadStreak + 1 : 0;
+
+        const uint32_t required = overload ? overloadPolicy.exitFrames : overloadPolicy.enterFrames;
+        if (overloadStreak >= required) {
+            overload = !overload;
+            overloadStreak = 0;
+
+            if (gAIBackendPtr)
+                gAIBackendPtr->Log(std::string("EntropyPredictor :: Overload ") + (overload ? "RAISED" : "CLEARED") +
+                    " (signal " + std::to_string(signal * 1000.0f) + " ms)");
+        }
+    }
+
+    void UpdateCycle() {
+        std::unique_lock<std::mutex> lock(entropyMutex);
         if (!initialized || !enabled) return;
 
-        auto now = std::chrono::high_resolution_clock::now();
-        float dt = std::chrono::duration<float>(now - lastTime).count();
+        const uint64_t now = FrameClock::NowNanoseconds();
+        const uint64_t elapsed = now - lastTime;
+        float dt = static_cast<float>(elapsed) * 1e-9f;
         lastTime = now;
 
-        frameTimes.push_back(dt);
-        if (frameTimes.size() > sampleWindow)
-            frameTimes.pop_front();
+        if (capture.IsOpen())
+            capture.Record(elapsed);
 
-        // Calculate standard deviation of delta times (frame jitter)
-        float mean = 0.0f;
-        for (float t : frameTimes) mean += t;
-        mean /= static_cast<float>(frameTimes.size());
+        // A level shift means the window still describes the old scene:
+        // restart the statistics from this frame instead of waiting it out.
+        SceneTransitionEvent sceneEvent;
+        const int shift = sceneDetector.Push(dt);
+        if (shift != 0) {
+            sceneEvent.frameIndex = frameIndex;
+            sceneEvent.previousMeanFrameTime = frameTimes.Mean();
+            sceneEvent.frameTime = dt;
+            sceneEvent.direction = shift;
+            sceneEvent.sceneIndex = ++sceneIndex;
 
-        float variance = 0.0f;
-        for (float t : frameTimes) variance += (t - mean) * (t - mean);
-        variance /= static_cast<float>(frameTimes.size());
+            frameTimes.Clear();
+            forecaster.Reset();
+        }
 
-        entropyRate = std::sqrt(variance);
+        // Standard deviation of delta times (frame jitter), updated in O(1)
+        frameTimes.Push(dt);
+        entropyRate = frameTimes.StdDev();
+
+        const uint32_t micros = static_cast<uint32_t>(std::fmin(dt * 1e6f, 4.0e9f));
+        lastSecond.Record(micros);
+        lastMinute.Record(micros);
+        session.Record(micros);
+
+        QUADRAQ::SignalChannelBank& bank = ChannelBankLocked();
+        bank.Advance();
+        bank.Push(Channels::FrameTime, dt);
+        forecaster.Push(dt);
+        EvaluateOverloadLocked(dt);
+        ++frameIndex;
+        PublishLocked();
 
         if (gAIBackendPtr)
             gAIBackendPtr->Log("EntropyPredictor :: EntropyRate = " + std::to_string(entropyRate));
+
+        if (shift == 0) return;
+
+        // Dispatch outside the lock so subscribers may call back into the predictor
+        std::array<SceneSubscriber, maxSceneSubscribers> subscribers = sceneSubscribers;
+        lock.unlock();
+
+        for (const SceneSubscriber& subscriber : subscribers) {
+            if (subscriber.callback)
+                subscriber.callback(sceneEvent, subscriber.userData);
+        }
     }
 
 }
@@ -0,0 +1,159 @@
+// ====================================================================
+//                           EpochDomain.cpp
+//     TGDK Quantum GPU Accelerator — Epoch-Based Reclamation
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "EpochDomain.hpp"
+
+namespace QUADRAQ {
+
+    // Per-thread slot claims, returned when the thread exits. A thread can
+    // read through a few domains at once; beyond that it uses overflow.
+    struct EpochThreadState {
+        static constexpr size_t kDomains = 4;
+
+        struct Registration {
+            EpochDomain* domain = nullptr;
+            size_t slot = EpochDomain::kReaderSlots;
+            uint32_t depth = 0;
+        };
+
+        Registration registrations[kDomains];
+
+        ~EpochThreadState() {
+            for (Registration& registration : registrations) {
+                if (registration.domain && registration.slot < EpochDomain::kReaderSlots)
+                    registration.domain->ReleaseSlot(registration.slot);
+            }
+        }
+
+        Registration* Find(EpochDomain& domain) {
+            for (Registration& registration : registrations) {
+                if (registration.domain == &domain) return &registration;
+            }
+            for (Registration& registration : registrations) {
+                if (!registration.domain) {
+                    registration.domain = &domain;
+                    registration.slot = domain.ThreadSlot();
+                    return &registration;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    namespace {
+        thread_local EpochThreadState threadState;
+    }
+
+    // ================================================================
+    //                          Domain
+    // ================================================================
+
+    EpochDomain& EpochDomain::Global() {
+        // Never destroyed: reader threads may outlive static destruction
+        static EpochDomain* domain = new EpochDomain();
+        return *domain;
+    }
+
+    EpochDomain::~EpochDomain() {
+        for (const Retired& entry : retired)
+            entry.deleter(entry.object);
+    }
+
+    void EpochDomain::Retire(void* object, Deleter deleter) {
+        if (!object) return;
+
+        std::lock_guard<std::mutex> lock(retiredMutex);
+        retired.push_back({ object, deleter, epoch.fetch_add(1, std::memory_order_seq_cst) });
+    }
+
+    size_t EpochDomain::Reclaim() {
+        const uint64_t oldest = OldestPinned();
+
+        std::vector<Retired> expired;
+        {
+            std::lock_guard<std::mutex> lock(retiredMutex);
+
+            size_t kept = 0;
+            for (const Retired& entry : retired) {
+                if (entry.epoch < oldest) expired.push_back(entry);
+                else retired[kept++] = entry;
+            }
+            retired.resize(kept);
+        }
+
+        for (const Retired& entry : expired)
+            entry.deleter(entry.object);
+        return expired.size();
+    }
+
+    size_t EpochDomain::PendingRetired() const {
+        std::lock_guard<std::mutex> lock(retiredMutex);
+        return retired.size();
+    }
+
+    size_t EpochDomain::ThreadSlot() {
+        for (size_t i = 0; i < kReaderSlots; ++i) {
+            if (!slots[i].claimed.load(std::memory_order_relaxed) &&
+                !slots[i].claimed.exchange(true, std::memory_order_acquire))
+                return i;
+        }
+        return kReaderSlots;
+    }
+
+    void EpochDomain::ReleaseSlot(size_t slot) {
+        slots[slot].epoch.store(0, std::memory_order_release);
+        slots[slot].claimed.store(false, std::memory_order_release);
+    }
+
+    // Objects retired before this epoch are unreachable by every reader
+    uint64_t EpochDomain::OldestPinned() const {
+        if (overflowReaders.load(std::memory_order_seq_cst) != 0) return 0;
+
+        uint64_t oldest = UINT64_MAX;
+        for (const ReaderSlot& slot : slots) {
+            const uint64_t pinned = slot.epoch.load(std::memory_order_seq_cst);
+            if (pinned != 0 && pinned < oldest) oldest = pinned;
+        }
+        return oldest;
+    }
+
+    // ================================================================
+    //                          Guard
+    // ================================================================
+
+    // A reader that saw an object pinned an epoch no later than the one
+    // the object was retired under: its pin precedes its pointer load,
+    // which precedes the writer's swap and then the retirement's epoch
+    // bump, all sequentially consistent.
+    EpochGuard::EpochGuard(EpochDomain& domain)
+        : domain(domain), depth(nullptr), slot(EpochDomain::kReaderSlots), outermost(true) {
+        EpochThreadState::Registration* registration = threadState.Find(domain);
+
+        if (registration) {
+            depth = &registration->depth;
+            slot = registration->slot;
+            outermost = (*depth)++ == 0;
+        }
+        if (!outermost) return;
+
+        if (slot < EpochDomain::kReaderSlots)
+            domain.slots[slot].epoch.store(domain.epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        else
+            domain.overflowReaders.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    EpochGuard::~EpochGuard() {
+        if (outermost) {
+            if (slot < EpochDomain::kReaderSlots)
+                domain.slots[slot].epoch.store(0, std::memory_order_release);
+            else
+                domain.overflowReaders.fetch_sub(1, std::memory_order_release);
+        }
+
+        if (depth) --*depth;
+    }
+
+} // namespace QUADRAQ
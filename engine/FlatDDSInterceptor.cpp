@@ -7,12 +7,18 @@
 #include "FlatDDSInterceptor.hpp"
 #include "TGDK_IAIBackend.hpp"
 #include "QUADRAQ.hpp"
+#include "VerdictCache.hpp"
+#include "NamePatternSet.hpp"
+#include "DdsFile.hpp"
 
 #include <d3d11.h>
 #include <wrl.h>
-#include <unordered_map>
+#include <atomic>
 #include <string>
 #include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include <DDSTextureLoader.h>
 
 using namespace Microsoft::WRL;
@@ -21,8 +27,188 @@ namespace FlatDDSInterceptor {
 
     static IAIBackend* gAIBackendPtr = nullptr;
     static ID3D11ShaderResourceView* flatTextureSRV = nullptr;
-    static std::unordered_map<std::string, ID3D11ShaderResourceView*> redirectMap;
-    static std::mutex interceptMutex;
+    static QUADRAQ::RedirectTable redirectTable(QUADRAQ::NameCase::Folded);  // name -> flatTextureSRV
+    static std::mutex interceptMutex;               // writers only
+    static QUADRAQ::NamePatternSet overrideRules;   // non-exact rules
+    // Both folded: names match ignoring ASCII case, like the rules do
+    static std::vector<std::string> ruleExactNames;         // exact rules of the current rule set, writers only
+    static std::unordered_set<std::string> registeredNames; // RegisterOverride names, writers only
+    static std::atomic<ID3D11ShaderResourceView*> ruleTarget{ nullptr };   // flatTextureSRV when the rules were added
+    static std::atomic<bool> haveOverrideRules{ false };
+    static std::atomic<uint64_t> rulesVersion{ 0 };
+    static QUADRAQ::VerdictCache verdictCache;      // resource -> replacement, per OverridesVersion()
+
+    // Grows whenever either the exact names or the rules change
+    static uint64_t OverridesVersion() {
+        return redirectTable.Version() + rulesVersion.load(std::memory_order_acquire);
+    }
+
+    // {6F1D2C7A-3B84-4E59-9A0D-5C2E81B7F4A3}
+    static const GUID kReleaseWatchGuid =
+        { 0x6f1d2c7a, 0x3b84, 0x4e59, { 0x9a, 0x0d, 0x5c, 0x2e, 0x81, 0xb7, 0xf4, 0xa3 } };
+
+    // Parked in a resource's private data. D3D drops its reference when the
+    // resource is destroyed, which forgets the cached verdict before the
+    // address can be handed to a new resource. The module is pinned once
+    // the first watch is out, so Release() is never left pointing into an
+    // unloaded DLL. Watches can outlive this module's statics, since the
+    // game may destroy textures during or after static destruction; the
+    // hook does nothing once verdictCache is gone.
+    class ReleaseWatch final : public IUnknown {
+    public:
+        explicit ReleaseWatch(QUADRAQ::VerdictCache::ReleaseHook hook) : hook(std::move(hook)) {}
+
+        HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** object) override {
+            if (!object) return E_POINTER;
+            if (riid != __uuidof(IUnknown)) {
+                *object = nullptr;
+                return E_NOINTERFACE;
+            }
+            *object = static_cast<IUnknown*>(this);
+            AddRef();
+            return S_OK;
+        }
+
+        ULONG STDMETHODCALLTYPE AddRef() override { return ++references; }
+
+        ULONG STDMETHODCALLTYPE Release() override {
+            const ULONG remaining = --references;
+            if (remaining == 0) {
+                hook.Fire();
+                delete this;
+            }
+            return remaining;
+        }
+
+    private:
+        QUADRAQ::VerdictCache::ReleaseHook hook;
+        std::atomic<ULONG> references{ 1 };
+    };
+
+    static void WatchRelease(ID3D11Resource* resource) {
+        UINT size = 0;
+        if (SUCCEEDED(resource->GetPrivateData(kReleaseWatchGuid, &size, nullptr))) return;
+
+        static std::once_flag pinned;
+        std::call_once(pinned, [] {
+            HMODULE module = nullptr;
+            GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN,
+                reinterpret_cast<LPCWSTR>(&WatchRelease), &module);
+        });
+
+        ComPtr<ReleaseWatch> watch;
+        watch.Attach(new ReleaseWatch(verdictCache.Hook(resource)));
+        resource->SetPrivateDataInterface(kReleaseWatchGuid, watch.Get());
+    }
+
+    static ID3D11ShaderResourceView* Resolve(ID3D11Resource* resource, std::string_view name, uint64_t version) {
+        ID3D11ShaderResourceView* replacement = InterceptTexture(name);
+        verdictCache.Store(resource, version, replacement);
+        WatchRelease(resource);
+        return replacement;
+    }
+
+    // Immutable texture initialized straight from the mapped subresources
+    static HRESULT CreateTextureFromDds(ID3D11Device* device, const QUADRAQ::DdsFile& dds, ID3D11ShaderResourceView** view) {
+        if (!device) return E_INVALIDARG;
+
+        const QUADRAQ::DdsInfo& info = dds.Info();
+        const DXGI_FORMAT format = static_cast<DXGI_FORMAT>(info.format);
+        const UINT arraySize = info.arraySize * (info.cube ? 6 : 1);
+
+        std::vector<D3D11_SUBRESOURCE_DATA> initialData(dds.SubresourceCount());
+        for (size_t i = 0; i < initialData.size(); ++i) {
+            const QUADRAQ::DdsSubresource& subresource = dds.Subresources()[i];
+            initialData[i].pSysMem = subresource.data;
+            initialData[i].SysMemPitch = subresource.rowPitch;
+            initialData[i].SysMemSlicePitch = subresource.slicePitch;
+        }
+
+        ComPtr<ID3D11Resource> texture;
+        D3D11_SHADER_RESOURCE_VIEW_DESC viewDesc = {};
+        viewDesc.Format = format;
+        HRESULT hr = E_FAIL;
+
+        switch (info.dimension) {
+        case QUADRAQ::DdsDimension::Texture1D: {
+            D3D11_TEXTURE1D_DESC desc = {};
+            desc.Width = info.width;
+            desc.MipLevels = info.mipLevels;
+            desc.ArraySize = arraySize;
+            desc.Format = format;
+            desc.Usage = D3D11_USAGE_IMMUTABLE;
+            desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+            ComPtr<ID3D11Texture1D> texture1D;
+            hr = device->CreateTexture1D(&desc, initialData.data(), &texture1D);
+            texture = texture1D;
+
+            if (arraySize > 1) {
+                viewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE1DARRAY;
+                viewDesc.Texture1DArray.MipLevels = info.mipLevels;
+                viewDesc.Texture1DArray.ArraySize = arraySize;
+            } else {
+                viewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE1D;
+                viewDesc.Texture1D.MipLevels = info.mipLevels;
+            }
+            break;
+        }
+        case QUADRAQ::DdsDimension::Texture2D: {
+            D3D11_TEXTURE2D_DESC desc = {};
+            desc.Width = info.width;
+            desc.Height = info.height;
+            desc.MipLevels = info.mipLevels;
+            desc.ArraySize = arraySize;
+            desc.Format = format;
+            desc.SampleDesc.Count = 1;
+            desc.Usage = D3D11_USAGE_IMMUTABLE;
+            desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+            desc.MiscFlags = info.cube ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
+
+            ComPtr<ID3D11Texture2D> texture2D;
+            hr = device->CreateTexture2D(&desc, initialData.data(), &texture2D);
+            texture = texture2D;
+
+            if (info.cube && info.arraySize > 1) {
+                viewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBEARRAY;
+                viewDesc.TextureCubeArray.MipLevels = info.mipLevels;
+                viewDesc.TextureCubeArray.NumCubes = info.arraySize;
+            } else if (info.cube) {
+                viewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE;
+                viewDesc.TextureCube.MipLevels = info.mipLevels;
+            } else if (arraySize > 1) {
+                viewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+                viewDesc.Texture2DArray.MipLevels = info.mipLevels;
+                viewDesc.Texture2DArray.ArraySize = arraySize;
+            } else {
+                viewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+                viewDesc.Texture2D.MipLevels = info.mipLevels;
+            }
+            break;
+        }
+        case QUADRAQ::DdsDimension::Texture3D: {
+            D3D11_TEXTURE3D_DESC desc = {};
+            desc.Width = info.width;
+            desc.Height = info.height;
+            desc.Depth = info.depth;
+            desc.MipLevels = info.mipLevels;
+            desc.Format = format;
+            desc.Usage = D3D11_USAGE_IMMUTABLE;
+            desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+            ComPtr<ID3D11Texture3D> texture3D;
+            hr = device->CreateTexture3D(&desc, initialData.data(), &texture3D);
+            texture = texture3D;
+
+            viewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE3D;
+            viewDesc.Texture3D.MipLevels = info.mipLevels;
+            break;
+        }
+        }
+
+        if (FAILED(hr)) return hr;
+        return device->CreateShaderResourceView(texture.Get(), &viewDesc, view);
+    }
 
     bool LoadFlatTexture(ID3D11Device* device, const std::wstring& ddsPath) {
         std::lock_guard<std::mutex> lock(interceptMutex);
@@ -30,41 +216,145 @@ namespace FlatDDSInterceptor {
         if (flatTextureSRV)
             return true;
 
-        HRESULT hr = DirectX::CreateDDSTextureFromFile(device, ddsPath.c_str(), nullptr, &flatTextureSRV);
+        // The path is opened wide, so non-ASCII names reach the in-tree
+        // reader intact; DirectXTK stays as the fallback for formats it rejects
+        QUADRAQ::DdsFile dds;
+        HRESULT hr = E_FAIL;
+        if (dds.Open(ddsPath))
+            hr = CreateTextureFromDds(device, dds, &flatTextureSRV);
+        else if (gAIBackendPtr)
+            gAIBackendPtr->Log("FlatDDSInterceptor :: " + dds.Error() + ", using DirectXTK loader.");
+
+        if (FAILED(hr))
+            hr = DirectX::CreateDDSTextureFromFile(device, ddsPath.c_str(), nullptr, &flatTextureSRV);
         if (FAILED(hr)) {
             if (gAIBackendPtr) gAIBackendPtr->LogError("FlatDDSInterceptor :: Failed to load flat DDS.");
             return false;
         }
 
         if (gAIBackendPtr)
-            gAIBackendPtr->Log("FlatDDSInterceptor :: Flat DDS loaded from " + std::string(ddsPath.begin(), ddsPath.end()));
+            gAIBackendPtr->Log("FlatDDSInterceptor :: Flat DDS loaded from " + QUADRAQ::WidePathToUtf8(ddsPath));
 
         return true;
     }
 
-    void RegisterOverride(const std::string& originalName) {
+    void RegisterOverride(std::string_view originalName) {
         std::lock_guard<std::mutex> lock(interceptMutex);
-        redirectMap[originalName] = flatTextureSRV;
+        registeredNames.insert(QUADRAQ::FoldName(originalName));
+        redirectTable.Set(originalName, flatTextureSRV);
     }
 
-    ID3D11ShaderResourceView* InterceptTexture(const std::string& textureName) {
+    void RegisterOverrides(const std::vector<std::string_view>& originalNames) {
         std::lock_guard<std::mutex> lock(interceptMutex);
-        auto it = redirectMap.find(textureName);
-        if (it != redirectMap.end()) {
+        for (std::string_view name : originalNames) registeredNames.insert(QUADRAQ::FoldName(name));
+        redirectTable.SetMany(originalNames, flatTextureSRV);
+    }
+
+    static bool ApplyOverrideRules(QUADRAQ::NamePatternSet& parsed, const std::string& source) {
+        if (!parsed.Error().empty()) {
             if (gAIBackendPtr)
-                gAIBackendPtr->Log("FlatDDSInterceptor :: Overriding texture: " + textureName);
-            return it->second;
+                gAIBackendPtr->LogError("FlatDDSInterceptor :: Override rules " + source + " rejected: " + parsed.Error());
+            return false;
         }
-        return nullptr;
+
+        std::vector<std::string> exactNames;
+        std::vector<QUADRAQ::NamePattern> rules;
+        const std::vector<QUADRAQ::NamePattern> patterns = parsed.Patterns();
+        for (const QUADRAQ::NamePattern& pattern : patterns) {
+            if (pattern.kind == QUADRAQ::PatternKind::Exact) exactNames.push_back(QUADRAQ::FoldName(pattern.text));
+            else rules.push_back(pattern);
+        }
+
+        std::lock_guard<std::mutex> lock(interceptMutex);
+
+        // The new set replaces the previous one: its exact names leave the
+        // table unless this set or RegisterOverride still wants them
+        const std::unordered_set<std::string> keep(exactNames.begin(), exactNames.end());
+        std::vector<std::string_view> stale;
+        for (const std::string& name : ruleExactNames) {
+            if (!keep.count(name) && !registeredNames.count(name)) stale.push_back(name);
+        }
+        if (!stale.empty()) redirectTable.SetMany(stale, nullptr);
+
+        redirectTable.SetMany(std::vector<std::string_view>(exactNames.begin(), exactNames.end()), flatTextureSRV);
+        ruleExactNames = std::move(exactNames);
+
+        haveOverrideRules.store(!rules.empty(), std::memory_order_release);
+        overrideRules.Assign(std::move(rules));
+        ruleTarget.store(flatTextureSRV, std::memory_order_release);
+        rulesVersion.fetch_add(1, std::memory_order_acq_rel);
+
+        if (gAIBackendPtr)
+            gAIBackendPtr->Log("FlatDDSInterceptor :: " + std::to_string(patterns.size()) + " override rules from " + source);
+        return true;
+    }
+
+    bool LoadOverrideRules(const std::string& path) {
+        QUADRAQ::NamePatternSet parsed;
+        parsed.Load(path);
+        return ApplyOverrideRules(parsed, path);
+    }
+
+    bool SetOverrideRules(std::string_view rules) {
+        QUADRAQ::NamePatternSet parsed;
+        parsed.Parse(rules);
+        return ApplyOverrideRules(parsed, "(inline)");
+    }
+
+    // Lock-free like the exact names; rule matching is memoized per name
+    static ID3D11ShaderResourceView* MatchRules(std::string_view textureName) {
+        if (!haveOverrideRules.load(std::memory_order_acquire)) return nullptr;
+        return overrideRules.Match(textureName) >= 0 ? ruleTarget.load(std::memory_order_acquire) : nullptr;
+    }
+
+    ID3D11ShaderResourceView* InterceptTexture(std::string_view textureName) {
+        if (QUADRAQ::GpuHandle exact = redirectTable.Find(textureName))
+            return static_cast<ID3D11ShaderResourceView*>(exact);
+        return MatchRules(textureName);
+    }
+
+    ID3D11ShaderResourceView* InterceptTexture(const QUADRAQ::NameKey& textureKey) {
+        if (QUADRAQ::GpuHandle exact = redirectTable.Find(textureKey))
+            return static_cast<ID3D11ShaderResourceView*>(exact);
+        return MatchRules(textureKey.name);
+    }
+
+    ID3D11ShaderResourceView* InterceptResource(ID3D11Resource* resource) {
+        if (!resource) return nullptr;
+
+        const uint64_t version = OverridesVersion();
+        QUADRAQ::GpuHandle replacement = nullptr;
+        if (verdictCache.Lookup(resource, version, replacement))
+            return static_cast<ID3D11ShaderResourceView*>(replacement);
+
+        // First sight: unnamed resources get a cached "no override" too
+        char name[256];
+        UINT size = sizeof(name);
+        if (FAILED(resource->GetPrivateData(WKPDID_D3DDebugObjectName, &size, name))) size = 0;
+        while (size != 0 && name[size - 1] == '\0') --size;
+
+        return Resolve(resource, std::string_view(name, size), version);
+    }
+
+    void NoteResource(ID3D11Resource* resource, std::string_view name) {
+        if (resource) Resolve(resource, name, OverridesVersion());
     }
 
     void Clear() {
         std::lock_guard<std::mutex> lock(interceptMutex);
+        // Unpublish before releasing so new lookups cannot return the view
+        redirectTable.Clear();
+        overrideRules.Clear();
+        ruleExactNames.clear();
+        registeredNames.clear();
+        haveOverrideRules.store(false, std::memory_order_release);
+        ruleTarget.store(nullptr, std::memory_order_release);
+        rulesVersion.fetch_add(1, std::memory_order_acq_rel);
+        verdictCache.Clear();
         if (flatTextureSRV) {
             flatTextureSRV->Release();
             flatTextureSRV = nullptr;
         }
-        redirectMap.clear();
 
         if (gAIBackendPtr)
             gAIBackendPtr->Log("FlatDDSInterceptor :: Cleared overrides.");
@@ -0,0 +1,36 @@
+// ====================================================================
+//                           FrameClock.cpp
+//     TGDK Quantum GPU Accelerator — Frame Timing Source
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "FrameClock.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace FrameClock {
+
+    static std::atomic<bool> virtualMode{ false };
+    static std::atomic<uint64_t> virtualNow{ 0 };
+
+    uint64_t NowNanoseconds() {
+        if (virtualMode.load(std::memory_order_acquire))
+            return virtualNow.load(std::memory_order_acquire);
+
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void SetVirtual(bool enable) {
+        virtualMode.store(enable, std::memory_order_release);
+    }
+
+    bool IsVirtual() {
+        return virtualMode.load(std::memory_order_acquire);
+    }
+
+    void Advance(uint64_t nanoseconds) {
+        virtualNow.fetch_add(nanoseconds, std::memory_order_acq_rel);
+    }
+}
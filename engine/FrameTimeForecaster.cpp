@@ -0,0 +1,69 @@
+// ====================================================================
+//                      FrameTimeForecaster.cpp
+//     TGDK Quantum GPU Accelerator — Frame-Time Forecasting
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "FrameTimeForecaster.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace QUADRAQ {
+
+    namespace {
+        const uint32_t kWarmupFrames = 8;
+        const float kResidualSmoothing = 0.1f;
+    }
+
+    FrameTimeForecaster::FrameTimeForecaster(float alpha, float beta) {
+        SetSmoothing(alpha, beta);
+    }
+
+    void FrameTimeForecaster::SetSmoothing(float a, float b) {
+        alpha = std::min(std::max(a, 0.01f), 1.0f);
+        beta = std::min(std::max(b, 0.0f), 1.0f);
+    }
+
+    void FrameTimeForecaster::Reset() {
+        level = 0.0f;
+        trend = 0.0f;
+        residualVariance = 0.0f;
+        count = 0;
+    }
+
+    void FrameTimeForecaster::Push(float sample) {
+        if (count == 0) {
+            level = sample;
+            trend = 0.0f;
+        }
+        else {
+            const float error = sample - Predict(1);
+            residualVariance += kResidualSmoothing * (error * error - residualVariance);
+
+            const float previousLevel = level;
+            level = alpha * sample + (1.0f - alpha) * (level + trend);
+            trend = beta * (level - previousLevel) + (1.0f - beta) * trend;
+        }
+
+        if (count < kWarmupFrames) ++count;
+    }
+
+    float FrameTimeForecaster::Predict(uint32_t stepsAhead) const {
+        if (stepsAhead == 0) stepsAhead = 1;
+        return std::max(0.0f, level + trend * static_cast<float>(stepsAhead));
+    }
+
+    float FrameTimeForecaster::ResidualStdDev() const {
+        return std::sqrt(residualVariance);
+    }
+
+    float FrameTimeForecaster::Confidence() const {
+        if (count < 2 || level <= 0.0f) return 0.0f;
+
+        const float warmup = static_cast<float>(count) / static_cast<float>(kWarmupFrames);
+        const float relativeError = ResidualStdDev() / level;
+        return warmup / (1.0f + relativeError);
+    }
+
+} // namespace QUADRAQ
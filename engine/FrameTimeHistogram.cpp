@@ -0,0 +1,75 @@
+// ====================================================================
+//                       FrameTimeHistogram.cpp
+//     TGDK Quantum GPU Accelerator — Streaming Frame-Time Percentiles
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "FrameTimeHistogram.hpp"
+
+namespace QUADRAQ {
+
+    namespace {
+        uint32_t HighestBit(uint32_t value) {
+            uint32_t bit = 0;
+            while (value >>= 1) ++bit;
+            return bit;
+        }
+    }
+
+    size_t FrameTimeHistogram::BucketIndex(uint32_t micros) {
+        if (micros > kMaxMicros) micros = kMaxMicros;
+        if (micros < kSubBuckets) return micros;
+
+        // Octave 1 starts at 2^kSubBucketBits; keep the next 5 bits below the MSB
+        const uint32_t msb = HighestBit(micros);
+        const uint32_t octave = msb - kSubBucketBits + 1;
+        const uint32_t sub = (micros >> (msb - kSubBucketBits)) & (kSubBuckets - 1);
+        return static_cast<size_t>(octave) * kSubBuckets + sub;
+    }
+
+    uint32_t FrameTimeHistogram::BucketLowerBound(size_t index) {
+        const uint32_t octave = static_cast<uint32_t>(index / kSubBuckets);
+        const uint32_t sub = static_cast<uint32_t>(index % kSubBuckets);
+        if (octave == 0) return sub;
+        return (kSubBuckets + sub) << (octave - 1);
+    }
+
+    uint32_t FrameTimeHistogram::BucketMidpoint(size_t index) {
+        const uint32_t octave = static_cast<uint32_t>(index / kSubBuckets);
+        if (octave <= 1) return BucketLowerBound(index);
+        return BucketLowerBound(index) + ((1u << (octave - 1)) >> 1);
+    }
+
+    void FrameTimeHistogram::Clear() {
+        counts.fill(0);
+        total = 0;
+    }
+
+    void FrameTimeHistogram::Record(uint32_t micros) {
+        RecordBucket(BucketIndex(micros));
+    }
+
+    void FrameTimeHistogram::Subtract(const FrameTimeHistogram& other) {
+        if (other.total == 0) return;
+        for (size_t i = 0; i < kBucketCount; ++i)
+            counts[i] -= other.counts[i];
+        total -= other.total;
+    }
+
+    uint32_t FrameTimeHistogram::Quantile(double q) const {
+        if (total == 0) return 0;
+        if (q < 0.0) q = 0.0;
+        if (q > 1.0) q = 1.0;
+
+        uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total) + 0.5);
+        if (rank == 0) rank = 1;
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= rank) return BucketMidpoint(i);
+        }
+        return kMaxMicros;
+    }
+
+} // namespace QUADRAQ
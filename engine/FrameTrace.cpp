@@ -0,0 +1,202 @@
+// ====================================================================
+//                           FrameTrace.cpp
+//     TGDK Quantum GPU Accelerator — Frame-Time Capture Format
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "FrameTrace.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+namespace QUADRAQ {
+
+    namespace {
+        const auto kWriterInterval = std::chrono::milliseconds(20);
+
+        void PutLE(std::vector<uint8_t>& bytes, uint64_t value, size_t width) {
+            for (size_t i = 0; i < width; ++i)
+                bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+
+        uint64_t GetLE(const uint8_t* bytes, size_t width) {
+            uint64_t value = 0;
+            for (size_t i = 0; i < width; ++i)
+                value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+            return value;
+        }
+
+        void PutVarint(std::vector<uint8_t>& bytes, int64_t delta) {
+            uint64_t zigzag = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+            while (zigzag >= 0x80) {
+                bytes.push_back(static_cast<uint8_t>(zigzag | 0x80));
+                zigzag >>= 7;
+            }
+            bytes.push_back(static_cast<uint8_t>(zigzag));
+        }
+    }
+
+    // ================================================================
+    //                          Writer
+    // ================================================================
+
+    FrameTraceWriter::FrameTraceWriter(uint32_t tick)
+        : tickNanoseconds(tick ? tick : FrameTraceFormat::kDefaultTickNanoseconds) {}
+
+    FrameTraceWriter::~FrameTraceWriter() {
+        Close();
+    }
+
+    bool FrameTraceWriter::Open(const std::string& path) {
+        if (IsOpen()) return false;
+
+        out.open(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+
+        std::vector<uint8_t> header(FrameTraceFormat::kMagic, FrameTraceFormat::kMagic + 4);
+        PutLE(header, FrameTraceFormat::kVersion, 2);
+        PutLE(header, 0, 2);
+        PutLE(header, tickNanoseconds, 4);
+        out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        written.store(0, std::memory_order_relaxed);
+        dropped.store(0, std::memory_order_relaxed);
+        previousTicks = 0;
+
+        running.store(true, std::memory_order_release);
+        worker = std::thread(&FrameTraceWriter::WriterLoop, this);
+        return true;
+    }
+
+    void FrameTraceWriter::Close() {
+        if (!running.exchange(false, std::memory_order_acq_rel)) return;
+
+        if (worker.joinable()) worker.join();
+        Drain();
+        out.close();
+    }
+
+    bool FrameTraceWriter::Record(uint64_t frameNanoseconds) {
+        if (!running.load(std::memory_order_relaxed)) return false;
+
+        const size_t position = head.load(std::memory_order_relaxed);
+        if (position - tail.load(std::memory_order_acquire) >= kQueueSize) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        uint64_t ticks = (frameNanoseconds + tickNanoseconds / 2) / tickNanoseconds;
+        if (ticks > UINT32_MAX) ticks = UINT32_MAX;
+
+        queue[position & (kQueueSize - 1)] = static_cast<uint32_t>(ticks);
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    void FrameTraceWriter::WriterLoop() {
+        while (running.load(std::memory_order_acquire)) {
+            Drain();
+            std::this_thread::sleep_for(kWriterInterval);
+        }
+    }
+
+    void FrameTraceWriter::Drain() {
+        const size_t end = head.load(std::memory_order_acquire);
+        size_t position = tail.load(std::memory_order_relaxed);
+        if (position == end) return;
+
+        std::vector<uint8_t> bytes;
+        bytes.reserve((end - position) * 2);
+
+        for (; position != end; ++position) {
+            const int64_t ticks = queue[position & (kQueueSize - 1)];
+            PutVarint(bytes, ticks - previousTicks);
+            previousTicks = ticks;
+        }
+
+        written.fetch_add(end - tail.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        tail.store(end, std::memory_order_release);
+
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        out.flush();
+    }
+
+    // ================================================================
+    //                          Reader
+    // ================================================================
+
+    bool FrameTraceReader::Open(const std::string& path) {
+        Close();
+
+        in.open(path, std::ios::binary);
+        if (!in.is_open()) {
+            error = "cannot open " + path;
+            return false;
+        }
+
+        uint8_t header[FrameTraceFormat::kHeaderSize];
+        if (!in.read(reinterpret_cast<char*>(header), sizeof(header))) {
+            error = "truncated header";
+            return false;
+        }
+        if (std::memcmp(header, FrameTraceFormat::kMagic, 4) != 0) {
+            error = "not a QUADRAQ frame trace";
+            return false;
+        }
+
+        version = static_cast<uint16_t>(GetLE(header + 4, 2));
+        tickNanoseconds = static_cast<uint32_t>(GetLE(header + 8, 4));
+        if (version != FrameTraceFormat::kVersion) {
+            error = "unsupported trace version " + std::to_string(version);
+            return false;
+        }
+        if (tickNanoseconds == 0) {
+            error = "invalid tick length";
+            return false;
+        }
+        return true;
+    }
+
+    void FrameTraceReader::Close() {
+        if (in.is_open()) in.close();
+        in.clear();
+        tickNanoseconds = 0;
+        version = 0;
+        previousTicks = 0;
+        error.clear();
+    }
+
+    bool FrameTraceReader::Next(uint64_t& frameNanoseconds) {
+        if (!in.is_open()) return false;
+
+        uint64_t zigzag = 0;
+        for (unsigned shift = 0;; shift += 7) {
+            const int byte = in.get();
+            if (byte == std::char_traits<char>::eof()) {
+                if (shift != 0) error = "truncated record";
+                return false;
+            }
+            if (shift > 63) {
+                error = "malformed varint";
+                return false;
+            }
+
+            zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) break;
+        }
+
+        const int64_t delta = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+        previousTicks += delta;
+        if (previousTicks < 0) {
+            error = "negative frame time";
+            return false;
+        }
+
+        frameNanoseconds = static_cast<uint64_t>(previousTicks) * tickNanoseconds;
+        return true;
+    }
+
+} // namespace QUADRAQ
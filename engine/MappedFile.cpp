@@ -0,0 +1,205 @@
+// ====================================================================
+//                            MappedFile.cpp
+//     TGDK Quantum GPU Accelerator — Read-Only Memory-Mapped Files
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace QUADRAQ {
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        Swap(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            Swap(other);
+        }
+        return *this;
+    }
+
+    std::string WidePathToUtf8(const std::wstring& path) {
+        std::string out;
+        out.reserve(path.size());
+        for (size_t i = 0; i < path.size(); ++i) {
+            uint32_t c = static_cast<uint32_t>(path[i]);
+            if (sizeof(wchar_t) == 2 && c >= 0xD800 && c <= 0xDFFF) {
+                const uint32_t low = i + 1 < path.size() ? static_cast<uint32_t>(path[i + 1]) : 0;
+                if (c <= 0xDBFF && low >= 0xDC00 && low <= 0xDFFF) {
+                    c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                    ++i;
+                }
+                else {
+                    c = 0xFFFD;
+                }
+            }
+            else if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+                c = 0xFFFD;
+            }
+
+            if (c < 0x80) {
+                out += static_cast<char>(c);
+            }
+            else if (c < 0x800) {
+                out += static_cast<char>(0xC0 | (c >> 6));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            }
+            else if (c < 0x10000) {
+                out += static_cast<char>(0xE0 | (c >> 12));
+                out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            }
+            else {
+                out += static_cast<char>(0xF0 | (c >> 18));
+                out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            }
+        }
+        return out;
+    }
+
+    void MappedFile::Swap(MappedFile& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        std::swap(open, other.open);
+#ifdef _WIN32
+        std::swap(file, other.file);
+        std::swap(mapping, other.mapping);
+#else
+        std::swap(descriptor, other.descriptor);
+#endif
+        std::swap(error, other.error);
+    }
+
+#ifdef _WIN32
+
+    bool MappedFile::Open(const std::string& path) {
+        Close();
+        error.clear();
+
+        HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        return Map(handle, path);
+    }
+
+    bool MappedFile::Open(const std::wstring& path) {
+        Close();
+        error.clear();
+
+        HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        return Map(handle, WidePathToUtf8(path));
+    }
+
+    bool MappedFile::Map(void* opened, const std::string& name) {
+        HANDLE handle = static_cast<HANDLE>(opened);
+        if (handle == INVALID_HANDLE_VALUE) {
+            error = "cannot open " + name;
+            return false;
+        }
+        file = handle;
+
+        LARGE_INTEGER length = {};
+        if (!GetFileSizeEx(handle, &length)) {
+            error = "cannot stat " + name;
+            Close();
+            return false;
+        }
+        size = static_cast<size_t>(length.QuadPart);
+
+        if (size != 0) {
+            mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping)
+                data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            if (!data) {
+                error = "cannot map " + name;
+                Close();
+                return false;
+            }
+        }
+
+        open = true;
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file) CloseHandle(file);
+
+        data = nullptr;
+        mapping = nullptr;
+        file = nullptr;
+        size = 0;
+        open = false;
+    }
+
+#else
+
+    bool MappedFile::Open(const std::string& path) {
+        Close();
+        error.clear();
+
+        descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0) {
+            error = "cannot open " + path;
+            return false;
+        }
+
+        struct stat info = {};
+        if (fstat(descriptor, &info) != 0) {
+            error = "cannot stat " + path;
+            Close();
+            return false;
+        }
+        size = static_cast<size_t>(info.st_size);
+
+        if (size != 0) {
+            void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (view == MAP_FAILED) {
+                error = "cannot map " + path;
+                Close();
+                return false;
+            }
+            data = static_cast<const uint8_t*>(view);
+        }
+
+        open = true;
+        return true;
+    }
+
+    bool MappedFile::Open(const std::wstring& path) {
+        return Open(WidePathToUtf8(path));
+    }
+
+    void MappedFile::Close() {
+        if (data) munmap(const_cast<uint8_t*>(data), size);
+        if (descriptor >= 0) ::close(descriptor);
+
+        data = nullptr;
+        descriptor = -1;
+        size = 0;
+        open = false;
+    }
+
+#endif
+
+} // namespace QUADRAQ
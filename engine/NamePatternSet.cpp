@@ -0,0 +1,448 @@
+// ====================================================================
+//                          NamePatternSet.cpp
+//     TGDK Quantum GPU Accelerator — Compiled Name Pattern Rules
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "NamePatternSet.hpp"
+#include "BitOps.hpp"
+#include "Hash.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace QUADRAQ {
+
+    namespace {
+        uint8_t Fold(char c) {
+            const uint8_t byte = static_cast<uint8_t>(c);
+            return (byte >= 'A' && byte <= 'Z') ? static_cast<uint8_t>(byte + ('a' - 'A')) : byte;
+        }
+
+        // `stored` is already folded
+        bool EqualFolded(const char* stored, size_t length, std::string_view name) {
+            if (length != name.size()) return false;
+            for (size_t i = 0; i < length; ++i) {
+                if (static_cast<uint8_t>(stored[i]) != Fold(name[i])) return false;
+            }
+            return true;
+        }
+
+                std::string_view Trim(std::string_view text) {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')) text.remove_suffix(1);
+            return text;
+        }
+
+        bool ParseKind(std::string_view word, PatternKind& kind) {
+            if (word == "exact") kind = PatternKind::Exact;
+            else if (word == "prefix") kind = PatternKind::Prefix;
+            else if (word == "suffix") kind = PatternKind::Suffix;
+            else if (word == "contains") kind = PatternKind::Contains;
+            else if (word == "glob") kind = PatternKind::Glob;
+            else return false;
+            return true;
+        }
+    }
+
+    // ================================================================
+    //                          Rules
+    // ================================================================
+
+    NamePatternSet::NamePatternSet(EpochDomain& domain) : domain(domain) {}
+
+    NamePatternSet::~NamePatternSet() {
+        // No reader may use a set that is being destroyed
+        delete current.load(std::memory_order_acquire);
+        domain.Reclaim();
+    }
+
+    void NamePatternSet::Add(PatternKind kind, std::string_view text) {
+        std::lock_guard<std::mutex> lock(mutex);
+        patterns.push_back({ kind, std::string(text) });
+        PublishLocked();
+    }
+
+    bool NamePatternSet::Parse(std::string_view rules) {
+        std::vector<NamePattern> parsed;
+        size_t lineNumber = 0;
+
+        while (!rules.empty()) {
+            const size_t end = rules.find('\n');
+            const std::string_view line = Trim(rules.substr(0, end));
+            rules.remove_prefix(end == std::string_view::npos ? rules.size() : end + 1);
+            ++lineNumber;
+
+            if (line.empty() || line.front() == '#') continue;
+
+            const size_t split = line.find_first_of(" \t");
+            PatternKind kind;
+            if (!ParseKind(line.substr(0, split), kind)) {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = "line " + std::to_string(lineNumber) + ": unknown rule kind";
+                return false;
+            }
+
+            const std::string_view text = split == std::string_view::npos ? std::string_view() : Trim(line.substr(split));
+            if (text.empty()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = "line " + std::to_string(lineNumber) + ": missing pattern";
+                return false;
+            }
+            parsed.push_back({ kind, std::string(text) });
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        error.clear();
+        patterns.insert(patterns.end(), parsed.begin(), parsed.end());
+        PublishLocked();
+        return true;
+    }
+
+    bool NamePatternSet::Load(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            error = "cannot open " + path;
+            return false;
+        }
+
+        const std::string rules((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        return Parse(rules);
+    }
+
+    void NamePatternSet::Assign(std::vector<NamePattern> rules) {
+        std::lock_guard<std::mutex> lock(mutex);
+        patterns = std::move(rules);
+        PublishLocked();
+    }
+
+    void NamePatternSet::Clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (patterns.empty()) return;
+
+        patterns.clear();
+        PublishLocked();
+    }
+
+    std::vector<NamePattern> NamePatternSet::Patterns() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return patterns;
+    }
+
+    NamePatternStats NamePatternSet::Stats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // The writer lock keeps the snapshot current, so no pin is needed
+        const Snapshot* snapshot = current.load(std::memory_order_acquire);
+
+        NamePatternStats stats;
+        stats.patterns = patterns.size();
+        stats.automatonStates = snapshot ? snapshot->outputLink.size() : 0;
+        stats.memoized = snapshot ? snapshot->memoized.load(std::memory_order_relaxed) : 0;
+        stats.memoHits = memoHits.load(std::memory_order_relaxed);
+        stats.scans = scans.load(std::memory_order_relaxed);
+        stats.verified = verified.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void NamePatternSet::DeleteSnapshot(void* snapshot) {
+        delete static_cast<Snapshot*>(snapshot);
+    }
+
+    void NamePatternSet::PublishLocked() {
+        Snapshot* next = patterns.empty() ? nullptr : Compile(patterns);
+        const Snapshot* previous = current.exchange(next, std::memory_order_seq_cst);
+        if (previous) domain.Retire(const_cast<Snapshot*>(previous), &DeleteSnapshot);
+        domain.Reclaim();
+    }
+
+    // ================================================================
+    //                          Matching
+    // ================================================================
+
+    int NamePatternSet::Match(std::string_view name) const {
+        EpochGuard guard(domain);
+
+        const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+        if (!snapshot) return -1;
+
+        uint64_t key = FoldedHash64(name.data(), name.size());
+        if (key == 0) key = 1;
+
+        // Short linear probe; a name that finds no slot is just not memoized
+        const size_t mask = kMemoSlots - 1;
+        MemoSlot* free = nullptr;
+        for (size_t i = 0; i < 8; ++i) {
+            MemoSlot& slot = snapshot->memo[(static_cast<size_t>(key) + i) & mask];
+            const uint64_t seen = slot.key.load(std::memory_order_acquire);
+            if (seen == key) {
+                const int32_t rule = slot.rule.load(std::memory_order_acquire);
+                if (rule == 0) break;       // another thread is still scanning it
+                const uint64_t stored = slot.name.load(std::memory_order_relaxed);
+                if (!EqualFolded(snapshot->memoNames.get() + (stored >> 32), static_cast<uint32_t>(stored), name))
+                    continue;               // same hash, different name
+                memoHits.fetch_add(1, std::memory_order_relaxed);
+                return rule - 2;
+            }
+            if (seen == 0) {
+                free = &slot;
+                break;
+            }
+        }
+
+        const int rule = ScanSnapshot(*snapshot, name);
+
+        // Room for the name first; bytes claimed by a lost race stay unused
+        if (!free || name.size() > kMemoNameBytes) return rule;
+        const size_t offset = snapshot->memoNameBytes.fetch_add(name.size(), std::memory_order_relaxed);
+        if (offset + name.size() > kMemoNameBytes) return rule;
+
+        uint64_t expected = 0;
+        if (free->key.compare_exchange_strong(expected, key, std::memory_order_acq_rel)) {
+            char* stored = snapshot->memoNames.get() + offset;
+            for (size_t i = 0; i < name.size(); ++i) stored[i] = static_cast<char>(Fold(name[i]));
+            free->name.store((static_cast<uint64_t>(offset) << 32) | name.size(), std::memory_order_relaxed);
+            free->rule.store(rule + 2, std::memory_order_release);
+            snapshot->memoized.fetch_add(1, std::memory_order_relaxed);
+        }
+        return rule;
+    }
+
+    int NamePatternSet::Scan(std::string_view name) const {
+        EpochGuard guard(domain);
+
+        const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+        return snapshot ? ScanSnapshot(*snapshot, name) : -1;
+    }
+
+    namespace {
+        // Candidate bookkeeping for one thread's scans, across every set
+        // it matches against; stamps only grow, so entries left by another
+        // set are never mistaken for current ones
+        struct ScanScratch {
+            std::vector<uint32_t> stamp;        // per rule: last scan that saw one of its literals
+            std::vector<uint64_t> seen;         // per rule, valid while its stamp is current
+            std::vector<int32_t> candidates;
+            uint32_t current = 0;
+        };
+
+        thread_local ScanScratch scanScratch;
+    }
+
+    int NamePatternSet::ScanSnapshot(const Snapshot& snapshot, std::string_view name) const {
+        scans.fetch_add(1, std::memory_order_relaxed);
+
+        ScanScratch& scratch = scanScratch;
+        const size_t ruleCount = snapshot.rules.size();
+        if (scratch.stamp.size() < ruleCount) {
+            scratch.stamp.resize(ruleCount, 0u);
+            scratch.seen.resize(ruleCount, 0);
+            scratch.candidates.reserve(ruleCount);
+        }
+        if (++scratch.current == 0) {
+            std::fill(scratch.stamp.begin(), scratch.stamp.end(), 0u);
+            scratch.current = 1;
+        }
+        const uint32_t stamp = scratch.current;
+
+        auto seen = [&](const Output& output) {
+            uint64_t& literals = scratch.seen[output.rule];
+            if (scratch.stamp[output.rule] != stamp) {
+                scratch.stamp[output.rule] = stamp;
+                literals = 0;
+            }
+
+            const uint64_t required = snapshot.rules[output.rule].literals;
+            if (literals == required) return;
+
+            literals |= output.literal;
+            if (literals == required) scratch.candidates.push_back(output.rule);
+        };
+
+        std::vector<int32_t>& candidates = scratch.candidates;
+        candidates.assign(snapshot.unanchored.begin(), snapshot.unanchored.end());
+
+        const size_t classCount = snapshot.classCount;
+        int32_t state = 0;
+        for (char c : name) {
+            state = snapshot.transitions[static_cast<size_t>(state) * classCount + snapshot.classOf[Fold(c)]];
+
+            int32_t emitting = snapshot.outputStart[state] != snapshot.outputStart[state + 1] ? state : snapshot.outputLink[state];
+            for (; emitting >= 0; emitting = snapshot.outputLink[emitting]) {
+                for (uint32_t i = snapshot.outputStart[emitting]; i < snapshot.outputStart[emitting + 1]; ++i)
+                    seen(snapshot.outputs[i]);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        uint64_t checked = 0;
+        int match = -1;
+        for (int32_t rule : candidates) {
+            ++checked;
+            if (Verify(snapshot.rules[rule], name)) {
+                match = rule;
+                break;
+            }
+        }
+        verified.fetch_add(checked, std::memory_order_relaxed);
+        return match;
+    }
+
+    bool NamePatternSet::Verify(const Rule& rule, std::string_view name) {
+        const std::string& text = rule.folded;
+
+        auto equalAt = [&](size_t offset) {
+            for (size_t i = 0; i < text.size(); ++i) {
+                if (Fold(name[offset + i]) != static_cast<uint8_t>(text[i])) return false;
+            }
+            return true;
+        };
+
+        switch (rule.kind) {
+        case PatternKind::Exact:    return name.size() == text.size() && equalAt(0);
+        case PatternKind::Prefix:   return name.size() >= text.size() && equalAt(0);
+        case PatternKind::Suffix:   return name.size() >= text.size() && equalAt(name.size() - text.size());
+        case PatternKind::Contains: return true;    // a candidate only once the whole text occurred
+        case PatternKind::Glob:     break;
+        }
+
+        // Backtracking to the last '*' is enough for globs
+        size_t p = 0, n = 0;
+        size_t starP = std::string::npos, starN = 0;
+        while (n < name.size()) {
+            if (p < text.size() && (text[p] == '?' || static_cast<uint8_t>(text[p]) == Fold(name[n]))) {
+                ++p;
+                ++n;
+            } else if (p < text.size() && text[p] == '*') {
+                starP = p++;
+                starN = n;
+            } else if (starP != std::string::npos) {
+                p = starP + 1;
+                n = ++starN;
+            } else {
+                return false;
+            }
+        }
+        while (p < text.size() && text[p] == '*') ++p;
+        return p == text.size();
+    }
+
+    // ================================================================
+    //                          Automaton
+    // ================================================================
+
+    NamePatternSet::Snapshot* NamePatternSet::Compile(const std::vector<NamePattern>& patterns) {
+        auto* snapshot = new Snapshot();
+        std::vector<Rule>& rules = snapshot->rules;
+        std::vector<int32_t>& unanchored = snapshot->unanchored;
+        uint8_t* classOf = snapshot->classOf;
+        size_t& classCount = snapshot->classCount;
+        std::vector<int32_t>& transitions = snapshot->transitions;
+        std::vector<int32_t>& outputLink = snapshot->outputLink;
+        std::vector<uint32_t>& outputStart = snapshot->outputStart;
+        std::vector<Output>& outputs = snapshot->outputs;
+
+        struct Literal {
+            int32_t rule;
+            size_t offset;              // into the rule's folded text
+            size_t length;
+            uint64_t bit;
+        };
+        std::vector<Literal> literals;
+
+        for (size_t index = 0; index < patterns.size(); ++index) {
+            Rule rule;
+            rule.kind = patterns[index].kind;
+            rule.literals = 0;
+            for (char c : patterns[index].text) rule.folded.push_back(static_cast<char>(Fold(c)));
+
+            auto require = [&](size_t offset, size_t length) {
+                const size_t count = static_cast<size_t>(PopCount64(rule.literals));
+                if (length == 0 || count == kMaxLiterals) return;
+
+                const uint64_t bit = 1ull << count;
+                rule.literals |= bit;
+                literals.push_back({ static_cast<int32_t>(index), offset, length, bit });
+            };
+
+            if (rule.kind != PatternKind::Glob) {
+                require(0, rule.folded.size());
+            } else {
+                for (size_t begin = 0; begin <= rule.folded.size();) {
+                    const size_t end = std::min(rule.folded.find_first_of("*?", begin), rule.folded.size());
+                    require(begin, end - begin);
+                    begin = end + 1;
+                }
+            }
+
+            if (rule.literals == 0) unanchored.push_back(static_cast<int32_t>(index));
+            rules.push_back(std::move(rule));
+        }
+
+        for (const Literal& literal : literals) {
+            for (size_t i = 0; i < literal.length; ++i) {
+                const uint8_t byte = static_cast<uint8_t>(rules[literal.rule].folded[literal.offset + i]);
+                if (classOf[byte] == 0 && classCount < 256) classOf[byte] = static_cast<uint8_t>(classCount++);
+            }
+        }
+
+        // Trie of the literals
+        transitions.assign(classCount, -1);
+        std::vector<std::vector<Output>> emitted(1);
+
+        for (const Literal& literal : literals) {
+            int32_t state = 0;
+            for (size_t i = 0; i < literal.length; ++i) {
+                const uint8_t byte = static_cast<uint8_t>(rules[literal.rule].folded[literal.offset + i]);
+                const size_t slot = static_cast<size_t>(state) * classCount + classOf[byte];
+                if (transitions[slot] < 0) {
+                    transitions[slot] = static_cast<int32_t>(emitted.size());
+                    emitted.emplace_back();
+                    transitions.resize(emitted.size() * classCount, -1);
+                }
+                state = transitions[slot];
+            }
+            emitted[state].push_back({ literal.rule, literal.bit });
+        }
+
+        // Breadth-first failure links complete the transition table
+        const size_t stateCount = emitted.size();
+        std::vector<int32_t> failure(stateCount, 0);
+        std::vector<int32_t> order;
+        order.reserve(stateCount);
+        outputLink.assign(stateCount, -1);
+
+        for (size_t c = 0; c < classCount; ++c) {
+            int32_t& next = transitions[c];
+            if (next < 0) next = 0;
+            else order.push_back(next);
+        }
+
+        for (size_t head = 0; head < order.size(); ++head) {
+            const int32_t state = order[head];
+            const int32_t fallback = failure[state];
+            outputLink[state] = !emitted[fallback].empty() ? fallback : outputLink[fallback];
+
+            for (size_t c = 0; c < classCount; ++c) {
+                int32_t& next = transitions[static_cast<size_t>(state) * classCount + c];
+                const int32_t viaFailure = transitions[static_cast<size_t>(fallback) * classCount + c];
+                if (next < 0) {
+                    next = viaFailure;
+                } else {
+                    failure[next] = viaFailure;
+                    order.push_back(next);
+                }
+            }
+        }
+
+        outputStart.assign(stateCount + 1, 0);
+        for (size_t state = 0; state < stateCount; ++state) {
+            outputs.insert(outputs.end(), emitted[state].begin(), emitted[state].end());
+            outputStart[state + 1] = static_cast<uint32_t>(outputs.size());
+        }
+        return snapshot;
+    }
+
+} // namespace QUADRAQ
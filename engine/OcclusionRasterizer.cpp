@@ -0,0 +1,315 @@
+// ====================================================================
+//                       OcclusionRasterizer.cpp
+//     TGDK Quantum GPU Accelerator — Software Occlusion Culling
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "OcclusionRasterizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define QUADRAQ_OCCLUSION_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace QUADRAQ {
+
+    namespace {
+        constexpr float kMinClipW = 1e-5f;
+        constexpr uint32_t kMaxWorkers = 7;
+
+        uint32_t RoundUp(uint32_t value, uint32_t multiple) {
+            return std::max(multiple, (value + multiple - 1) / multiple * multiple);
+        }
+
+        // Bounds of n / d for n in [n0, n1] and d in [d0, d1], d0 > 0
+        float DivideMin(float n0, float d0, float d1) { return n0 / (n0 >= 0.0f ? d1 : d0); }
+        float DivideMax(float n1, float d0, float d1) { return n1 / (n1 >= 0.0f ? d0 : d1); }
+    }
+
+    OcclusionRasterizer::OcclusionRasterizer(uint32_t w, uint32_t h, uint32_t workerThreads)
+        : width(RoundUp(w, kBinWidth)), height(RoundUp(h, kBinHeight)) {
+        binsX = width / kBinWidth;
+        binsY = height / kBinHeight;
+        blocksX = width / kBlockSize;
+
+        depth.assign(static_cast<size_t>(width) * height, 1.0f);
+        blockMaxDepth.assign(static_cast<size_t>(blocksX) * (height / kBlockSize), 1.0f);
+        binTriangles.resize(static_cast<size_t>(binsX) * binsY);
+
+        if (workerThreads == 0) {
+            const uint32_t hardware = std::thread::hardware_concurrency();
+            workerThreads = std::min(hardware > 1 ? hardware - 1 : 0u, kMaxWorkers);
+        }
+        for (uint32_t i = 0; i < workerThreads; ++i)
+            workers.emplace_back(&OcclusionRasterizer::WorkerLoop, this);
+    }
+
+    OcclusionRasterizer::~OcclusionRasterizer() {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            stopping = true;
+        }
+        poolWake.notify_all();
+        for (auto& worker : workers) worker.join();
+    }
+
+    void OcclusionRasterizer::BeginFrame(const float m[16]) {
+        std::copy(m, m + 16, viewProjection);
+        for (int j = 0; j < 4; ++j)
+            columnLength[j] = std::sqrt(m[j] * m[j] + m[4 + j] * m[4 + j] + m[8 + j] * m[8 + j]);
+
+        triangles.clear();
+        for (auto& bin : binTriangles) bin.clear();
+        stats = OcclusionStats{};
+    }
+
+    void OcclusionRasterizer::AddOccluder(const float* positions, size_t vertexCount, const uint32_t* indices, size_t triangleCount) {
+        stats.occluderTriangles += triangleCount;
+
+        const float* m = viewProjection;
+        clip.resize(vertexCount * 4);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            const float x = positions[v * 3], y = positions[v * 3 + 1], z = positions[v * 3 + 2];
+            for (int j = 0; j < 4; ++j)
+                clip[v * 4 + j] = x * m[j] + y * m[4 + j] + z * m[8 + j] + m[12 + j];
+        }
+
+        const float halfW = 0.5f * static_cast<float>(width);
+        const float halfH = 0.5f * static_cast<float>(height);
+
+        for (size_t t = 0; t < triangleCount; ++t) {
+            float sx[3], sy[3], sz[3];
+            bool rejected = false;
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t index = indices[t * 3 + k];
+                if (index >= vertexCount) { rejected = true; break; }
+
+                const float* c = &clip[index * 4];
+                if (c[3] < kMinClipW || c[2] < 0.0f) { rejected = true; break; }
+
+                const float inverseW = 1.0f / c[3];
+                sx[k] = (c[0] * inverseW + 1.0f) * halfW;
+                sy[k] = (1.0f - c[1] * inverseW) * halfH;
+                sz[k] = std::min(c[2] * inverseW, 1.0f);
+            }
+            if (rejected) continue;
+
+            float area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+            if (area == 0.0f) continue;
+            if (area < 0.0f) {
+                std::swap(sx[1], sx[2]);
+                std::swap(sy[1], sy[2]);
+                std::swap(sz[1], sz[2]);
+                area = -area;
+            }
+
+            ScreenTriangle tri;
+            tri.minX = std::min({ sx[0], sx[1], sx[2] });
+            tri.maxX = std::max({ sx[0], sx[1], sx[2] });
+            tri.minY = std::min({ sy[0], sy[1], sy[2] });
+            tri.maxY = std::max({ sy[0], sy[1], sy[2] });
+            if (tri.maxX < 0.0f || tri.maxY < 0.0f || tri.minX >= width || tri.minY >= height) continue;
+
+            for (int k = 0; k < 3; ++k) {
+                const int a = k, b = (k + 1) % 3;
+                tri.edgeA[k] = sy[a] - sy[b];
+                tri.edgeB[k] = sx[b] - sx[a];
+                tri.edgeC[k] = sx[a] * sy[b] - sx[b] * sy[a];
+            }
+
+            const float inverseArea = 1.0f / area;
+            tri.zx = ((sz[1] - sz[0]) * (sy[2] - sy[0]) - (sz[2] - sz[0]) * (sy[1] - sy[0])) * inverseArea;
+            tri.zy = ((sz[2] - sz[0]) * (sx[1] - sx[0]) - (sz[1] - sz[0]) * (sx[2] - sx[0])) * inverseArea;
+            tri.z0 = sz[0] - tri.zx * sx[0] - tri.zy * sy[0];
+
+            const uint32_t index = static_cast<uint32_t>(triangles.size());
+            triangles.push_back(tri);
+
+            const uint32_t bx0 = static_cast<uint32_t>(std::max(tri.minX, 0.0f)) / kBinWidth;
+            const uint32_t by0 = static_cast<uint32_t>(std::max(tri.minY, 0.0f)) / kBinHeight;
+            const uint32_t bx1 = std::min(static_cast<uint32_t>(tri.maxX) / kBinWidth, binsX - 1);
+            const uint32_t by1 = std::min(static_cast<uint32_t>(tri.maxY) / kBinHeight, binsY - 1);
+            for (uint32_t by = by0; by <= by1; ++by)
+                for (uint32_t bx = bx0; bx <= bx1; ++bx)
+                    binTriangles[by * binsX + bx].push_back(index);
+            ++stats.binnedTriangles;
+        }
+    }
+
+    void OcclusionRasterizer::Rasterize() {
+        RunBins();
+    }
+
+    void OcclusionRasterizer::RunBins() {
+        nextBin.store(0, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            busyWorkers = workers.size();
+            ++generation;
+        }
+        poolWake.notify_all();
+
+        const size_t binCount = binTriangles.size();
+        for (size_t bin; (bin = nextBin.fetch_add(1, std::memory_order_relaxed)) < binCount;)
+            RasterizeBin(bin);
+
+        std::unique_lock<std::mutex> lock(poolMutex);
+        poolDone.wait(lock, [this] { return busyWorkers == 0; });
+    }
+
+    void OcclusionRasterizer::WorkerLoop() {
+        uint64_t seen = 0;
+        const size_t binCount = binTriangles.size();
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(poolMutex);
+                poolWake.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+
+            for (size_t bin; (bin = nextBin.fetch_add(1, std::memory_order_relaxed)) < binCount;)
+                RasterizeBin(bin);
+
+            std::lock_guard<std::mutex> lock(poolMutex);
+            if (--busyWorkers == 0) poolDone.notify_one();
+        }
+    }
+
+    void OcclusionRasterizer::RasterizeBin(size_t bin) {
+        const int binX0 = static_cast<int>((bin % binsX) * kBinWidth);
+        const int binY0 = static_cast<int>((bin / binsX) * kBinHeight);
+        const int binX1 = binX0 + static_cast<int>(kBinWidth) - 1;
+        const int binY1 = binY0 + static_cast<int>(kBinHeight) - 1;
+
+        for (int y = binY0; y <= binY1; ++y)
+            std::fill_n(&depth[static_cast<size_t>(y) * width + binX0], kBinWidth, 1.0f);
+
+        for (const uint32_t index : binTriangles[bin]) {
+            const ScreenTriangle& tri = triangles[index];
+
+            // Pixel centers inside the triangle's bounds, clipped to the bin
+            const int x0 = std::max(binX0, static_cast<int>(std::ceil(tri.minX - 0.5f))) & ~3;
+            const int x1 = std::min(binX1, static_cast<int>(std::floor(tri.maxX - 0.5f)));
+            const int y0 = std::max(binY0, static_cast<int>(std::ceil(tri.minY - 0.5f)));
+            const int y1 = std::min(binY1, static_cast<int>(std::floor(tri.maxY - 0.5f)));
+            if (x0 > x1 || y0 > y1) continue;
+
+            for (int y = y0; y <= y1; ++y) {
+                const float py = static_cast<float>(y) + 0.5f;
+                float* row = &depth[static_cast<size_t>(y) * width];
+
+#if defined(QUADRAQ_OCCLUSION_SSE)
+                const __m128 laneOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+                const __m128 zero = _mm_setzero_ps();
+                __m128 rowEdge[3], stepA[3];
+                for (int k = 0; k < 3; ++k) {
+                    rowEdge[k] = _mm_set1_ps(tri.edgeB[k] * py + tri.edgeC[k]);
+                    stepA[k] = _mm_set1_ps(tri.edgeA[k]);
+                }
+                const __m128 rowZ = _mm_set1_ps(tri.zy * py + tri.z0);
+                const __m128 stepZ = _mm_set1_ps(tri.zx);
+
+                // x0 is 4-aligned and bins are 4-multiples, so groups never straddle the bin
+                for (int x = x0; x <= x1; x += 4) {
+                    const __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+                    __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepA[0], px), rowEdge[0]), zero);
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepA[1], px), rowEdge[1]), zero));
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(stepA[2], px), rowEdge[2]), zero));
+                    if (_mm_movemask_ps(inside) == 0) continue;
+
+                    const __m128 z = _mm_add_ps(_mm_mul_ps(stepZ, px), rowZ);
+                    const __m128 current = _mm_loadu_ps(row + x);
+                    const __m128 nearer = _mm_min_ps(current, z);
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, current)));
+                }
+#else
+                for (int x = x0; x <= x1; ++x) {
+                    const float px = static_cast<float>(x) + 0.5f;
+                    bool inside = true;
+                    for (int k = 0; k < 3; ++k)
+                        inside &= tri.edgeA[k] * px + tri.edgeB[k] * py + tri.edgeC[k] >= 0.0f;
+                    if (inside) row[x] = std::min(row[x], tri.zx * px + tri.zy * py + tri.z0);
+                }
+#endif
+            }
+        }
+
+        // Hierarchical depth for the blocks of this bin
+        for (int by = binY0; by <= binY1; by += kBlockSize) {
+            for (int bx = binX0; bx <= binX1; bx += kBlockSize) {
+                float farthest = 0.0f;
+                for (int y = by; y < by + static_cast<int>(kBlockSize); ++y) {
+                    const float* row = &depth[static_cast<size_t>(y) * width + bx];
+                    for (uint32_t x = 0; x < kBlockSize; ++x) farthest = std::max(farthest, row[x]);
+                }
+                blockMaxDepth[static_cast<size_t>(by / kBlockSize) * blocksX + bx / kBlockSize] = farthest;
+            }
+        }
+    }
+
+    bool OcclusionRasterizer::IsRectVisible(float minX, float minY, float maxX, float maxY, float nearestDepth) const {
+        minX = std::max(minX, 0.0f);
+        minY = std::max(minY, 0.0f);
+        maxX = std::min(maxX, static_cast<float>(width));
+        maxY = std::min(maxY, static_cast<float>(height));
+        if (minX >= maxX || minY >= maxY) return true;     // off screen is the frustum's call
+
+        const uint32_t bx0 = static_cast<uint32_t>(minX) / kBlockSize;
+        const uint32_t by0 = static_cast<uint32_t>(minY) / kBlockSize;
+        const uint32_t bx1 = (static_cast<uint32_t>(std::ceil(maxX)) - 1) / kBlockSize;
+        const uint32_t by1 = (static_cast<uint32_t>(std::ceil(maxY)) - 1) / kBlockSize;
+
+        for (uint32_t by = by0; by <= by1; ++by) {
+            const float* blocks = &blockMaxDepth[static_cast<size_t>(by) * blocksX];
+            for (uint32_t bx = bx0; bx <= bx1; ++bx) {
+                if (blocks[bx] >= nearestDepth) return true;
+            }
+        }
+        return false;
+    }
+
+    OcclusionStats OcclusionRasterizer::TestSpheres(const BoundsSoA& bounds, uint64_t* visibleMask) {
+        const float* m = viewProjection;
+        const float halfW = 0.5f * static_cast<float>(width);
+        const float halfH = 0.5f * static_cast<float>(height);
+        OcclusionStats result;
+
+        for (size_t i = 0; i < bounds.count; ++i) {
+            if (!((visibleMask[i >> 6] >> (i & 63)) & 1)) continue;
+            ++result.tested;
+
+            const float x = bounds.centerX[i], y = bounds.centerY[i], z = bounds.centerZ[i], r = bounds.radius[i];
+            float c[4];
+            for (int j = 0; j < 4; ++j) c[j] = x * m[j] + y * m[4 + j] + z * m[8 + j] + m[12 + j];
+
+            // Each clip component moves by at most r * |column| over the sphere
+            const float w0 = c[3] - r * columnLength[3];
+            const float w1 = c[3] + r * columnLength[3];
+            const float nearZ = c[2] - r * columnLength[2];
+            if (w0 <= kMinClipW || nearZ <= 0.0f) continue;   // touches the camera or near plane
+
+            const float ndcMinX = DivideMin(c[0] - r * columnLength[0], w0, w1);
+            const float ndcMaxX = DivideMax(c[0] + r * columnLength[0], w0, w1);
+            const float ndcMinY = DivideMin(c[1] - r * columnLength[1], w0, w1);
+            const float ndcMaxY = DivideMax(c[1] + r * columnLength[1], w0, w1);
+
+            // With a perspective projection clip z and w change along the
+            // same axis, so the nearest depth is exact at the nearest w
+            if (!IsRectVisible((ndcMinX + 1.0f) * halfW, (1.0f - ndcMaxY) * halfH,
+                    (ndcMaxX + 1.0f) * halfW, (1.0f - ndcMinY) * halfH, nearZ / w0)) {
+                visibleMask[i >> 6] &= ~(1ull << (i & 63));
+                ++result.occluded;
+            }
+        }
+
+        stats.tested += result.tested;
+        stats.occluded += result.occluded;
+        return result;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,88 @@
+// ====================================================================
+//                          PerfectHashIndex.cpp
+//     TGDK Quantum GPU Accelerator — Minimal Perfect Hashing
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "PerfectHashIndex.hpp"
+
+#include <algorithm>
+
+namespace QUADRAQ {
+
+    namespace {
+        constexpr uint32_t kSeedAttempts = 16;
+        constexpr uint32_t kMaxPilot = 1u << 22;
+    }
+
+    bool PerfectHashIndex::Build(const std::vector<uint64_t>& keys) {
+        std::vector<uint64_t> sorted(keys);
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) return false;
+
+        bucketCount = std::max<uint64_t>(1, (keys.size() + kKeysPerBucket - 1) / kKeysPerBucket);
+        tableSize = std::max<size_t>(1, keys.size());
+
+        for (uint32_t attempt = 0;; ++attempt) {
+            seed = Mix64(0x51A7E5EEDull + attempt);
+            if (TryBuild(keys)) return true;
+
+            // Grow by 1% per round of failures so the build always ends
+            if (attempt % kSeedAttempts == kSeedAttempts - 1)
+                tableSize += std::max<size_t>(1, tableSize / 100);
+        }
+    }
+
+    bool PerfectHashIndex::TryBuild(const std::vector<uint64_t>& keys) {
+        const size_t buckets = static_cast<size_t>(bucketCount);
+
+        // Counting sort of key hashes by bucket
+        std::vector<uint64_t> hashes(keys.size());
+        std::vector<uint32_t> start(buckets + 1, 0);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            hashes[i] = Mix64(keys[i] ^ seed);
+            ++start[Bucket(hashes[i]) + 1];
+        }
+        for (size_t b = 0; b < buckets; ++b) start[b + 1] += start[b];
+
+        std::vector<uint64_t> grouped(keys.size());
+        std::vector<uint32_t> fill(start.begin(), start.end() - 1);
+        for (uint64_t hash : hashes) grouped[fill[Bucket(hash)]++] = hash;
+
+        // Largest buckets first, while the table is still mostly empty
+        std::vector<uint32_t> order(buckets);
+        for (size_t b = 0; b < buckets; ++b) order[b] = static_cast<uint32_t>(b);
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return start[a + 1] - start[a] > start[b + 1] - start[b];
+        });
+
+        pilots.assign(buckets, 0);
+        std::vector<uint8_t> taken(tableSize, 0);
+        std::vector<size_t> positions;
+
+        for (uint32_t bucket : order) {
+            const uint32_t first = start[bucket];
+            const uint32_t size = start[bucket + 1] - first;
+            if (size == 0) break;
+
+            bool placed = false;
+            for (uint32_t pilot = 0; pilot < kMaxPilot && !placed; ++pilot) {
+                positions.clear();
+                placed = true;
+
+                for (uint32_t i = 0; i < size && placed; ++i) {
+                    const size_t position = Position(grouped[first + i], pilot);
+                    placed = !taken[position] &&
+                        std::find(positions.begin(), positions.end(), position) == positions.end();
+                    positions.push_back(position);
+                }
+                if (placed) pilots[bucket] = pilot;
+            }
+            if (!placed) return false;
+
+            for (size_t position : positions) taken[position] = 1;
+        }
+        return true;
+    }
+
+} // namespace QUADRAQ
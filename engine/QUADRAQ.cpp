@@ -104,21 +104,50 @@ namespace QUADRAQ {
         return false;
     }
 
+    // System-wide CPU busy fraction since the previous call
+    static float SampleCpuLoad() {
+        static ULONGLONG lastIdle = 0, lastTotal = 0;
+
+        FILETIME idleTime, kernelTime, userTime;
+        if (!GetSystemTimes(&idleTime, &kernelTime, &userTime))
+            return 0.0f;
+
+        auto toU64 = [](const FILETIME& ft) {
+            return (static_cast<ULONGLONG>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+        };
+
+        // Kernel time includes idle time
+        const ULONGLONG idle = toU64(idleTime);
+        const ULONGLONG total = toU64(kernelTime) + toU64(userTime);
+        const ULONGLONG idleDelta = idle - lastIdle;
+        const ULONGLONG totalDelta = total - lastTotal;
+        lastIdle = idle;
+        lastTotal = total;
+
+        if (totalDelta == 0) return 0.0f;
+        return 1.0f - static_cast<float>(idleDelta) / static_cast<float>(totalDelta);
+    }
+
     void StartCLIRuntime() {
         cliThread = std::thread(QUADRAQ_CLI_Main);
         cliThread.detach();
     }
 
+    // Used when QUADRAQ_overrides.txt is absent
+    static const char* const kDefaultOverrideRules =
+        "exact clouds_volumetric_layer.dds\n"
+        "exact atmosphere_blur_cube.dds\n"
+        "exact shader_fog_gradient.dds\n"
+        "exact motion_blur_occlusion.dds\n"
+        "exact volumetric_godrays.dds\n"
+        "exact low_quality_cloudlayer.dds\n";
+
     // This must be at namespace scope, not inside any function!
     void InitFlatTextureIntercepts() {
         FlatDDSInterceptor::LoadFlatTexture(g_device, L"texture_flat_grayscale_minimal.dds");
 
-        FlatDDSInterceptor::RegisterOverride("clouds_volumetric_layer.dds");
-        FlatDDSInterceptor::RegisterOverride("atmosphere_blur_cube.dds");
-        FlatDDSInterceptor::RegisterOverride("shader_fog_gradient.dds");
-        FlatDDSInterceptor::RegisterOverride("motion_blur_occlusion.dds");
-        FlatDDSInterceptor::RegisterOverride("volumetric_godrays.dds");
-        FlatDDSInterceptor::RegisterOverride("low_quality_cloudlayer.dds");
+        if (!FlatDDSInterceptor::LoadOverrideRules("QUADRAQ_overrides.txt"))
+            FlatDDSInterceptor::SetOverrideRules(kDefaultOverrideRules);
 
         if (gAIBackendPtr)
             gAIBackendPtr->Log("QUADRAQ :: FlatDDS overrides initialized.");
@@ -140,6 +169,9 @@ namespace QUADRAQ {
             return 2;
         }
 
+        // Optional: without it override shaders are compiled at runtime
+        ShaderOverrideUnit::LoadShaderCache("QUADRAQ_shaders.qsc");
+
         QUADRAQ::InitFlatTextureIntercepts();
         QuantumDrawRouter::EnableRouting(true);
 
@@ -150,8 +182,9 @@ namespace QUADRAQ {
 
         while (initialized) {
             ShaderOverrideUnit::FrameMonitor();
-            QuantumDrawRouter::ShouldSuppressDraw();
+            EntropyPredictor::PushChannelSample(EntropyPredictor::Channels::CpuLoad, SampleCpuLoad());
             EntropyPredictor::UpdateCycle();
+            QuantumDrawRouter::BeginFrame();
 
             std::this_thread::sleep_for(std::chrono::milliseconds(4));
         }
@@ -15,6 +15,7 @@
 #include "QUADRAQ_CLI.hpp"
 
 #include <iostream>
+#include <iomanip>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -98,6 +99,18 @@ namespace QUADRAQ {
 
     void QUADRAQ_CLI_AISwitchLoop();
 
+    static void PrintFrameTimePercentiles(const char* label, EntropyPredictor::Horizon horizon) {
+        auto p = EntropyPredictor::GetFrameTimePercentiles(horizon);
+        std::ostringstream line;
+        line << "  " << std::left << std::setw(8) << label << std::right << std::fixed << std::setprecision(2)
+            << " p50 " << std::setw(7) << p.p50 * 1000.0f << " ms"
+            << " | p95 " << std::setw(7) << p.p95 * 1000.0f << " ms"
+            << " | p99 " << std::setw(7) << p.p99 * 1000.0f << " ms"
+            << " | p99.9 " << std::setw(7) << p.p999 * 1000.0f << " ms"
+            << " | " << p.samples << " frames\n";
+        std::cout << line.str();
+    }
+
     void QUADRAQ_CLI_Main() {
         bool entropyOn = true;
         bool shaderOn = true;
@@ -112,6 +125,8 @@ namespace QUADRAQ {
             std::cout << "[4] Reload Flat Texture\n";
             std::cout << "[5] View Current AI Status\n";
             std::cout << "[6] Enter AI Command Console\n";
+            std::cout << "[7] View Frame-Time Percentiles\n";
+            std::cout << "[8] Toggle Frame-Time Capture\n";
             std::cout << "[0] Exit CLI\n";
             std::cout << "====================================\n";
             std::cout << "Enter selection: ";
@@ -135,13 +150,7 @@ namespace QUADRAQ {
             }
             else if (input == "4") {
                 FlatDDSInterceptor::Clear();
-                FlatDDSInterceptor::LoadFlatTexture(g_device, L"texture_flat_grayscale_minimal.dds");
-                FlatDDSInterceptor::RegisterOverride("clouds_volumetric_layer.dds");
-                FlatDDSInterceptor::RegisterOverride("atmosphere_blur_cube.dds");
-                FlatDDSInterceptor::RegisterOverride("shader_fog_gradient.dds");
-                FlatDDSInterceptor::RegisterOverride("motion_blur_occlusion.dds");
-                FlatDDSInterceptor::RegisterOverride("volumetric_godrays.dds");
-                FlatDDSInterceptor::RegisterOverride("low_quality_cloudlayer.dds");
+                QUADRAQ::InitFlatTextureIntercepts();
                 std::cout << "[CLI] Flat texture overrides reloaded.\n";
             }
             else if (input == "5") {
@@ -155,6 +164,24 @@ namespace QUADRAQ {
             else if (input == "6") {
                 QUADRAQ_CLI_AISwitchLoop();
             }
+            else if (input == "7") {
+                std::cout << "[CLI] Frame-time percentiles:\n";
+                PrintFrameTimePercentiles("1s", EntropyPredictor::Horizon::LastSecond);
+                PrintFrameTimePercentiles("1min", EntropyPredictor::Horizon::LastMinute);
+                PrintFrameTimePercentiles("session", EntropyPredictor::Horizon::Session);
+            }
+            else if (input == "8") {
+                if (EntropyPredictor::IsCapturing()) {
+                    EntropyPredictor::StopCapture();
+                    std::cout << "[CLI] Frame-time capture stopped.\n";
+                }
+                else if (EntropyPredictor::StartCapture("quadraq_capture.qdt")) {
+                    std::cout << "[CLI] Capturing frame times to quadraq_capture.qdt\n";
+                }
+                else {
+                    std::cout << "[CLI] Could not start frame-time capture.\n";
+                }
+            }
             else if (input == "0") {
                 std::cout << "[CLI] QUADRAQ CLI shutdown requested.\n";
                 break;
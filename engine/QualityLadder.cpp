@@ -0,0 +1,113 @@
+// ====================================================================
+//                          QualityLadder.cpp
+//     TGDK Quantum GPU Accelerator — Graduated Shader Quality
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "QualityLadder.hpp"
+
+#include <algorithm>
+
+namespace QUADRAQ {
+
+    const char* ShaderQualityName(ShaderQuality quality) {
+        switch (quality) {
+        case ShaderQuality::Full:    return "full";
+        case ShaderQuality::Reduced: return "reduced";
+        case ShaderQuality::Minimal: return "minimal";
+        case ShaderQuality::Flat:    return "flat";
+        default:                     return "unknown";
+        }
+    }
+
+    QualityLadder::QualityLadder(const QualityLadderPolicy& policy) {
+        SetPolicy(policy);
+    }
+
+    void QualityLadder::SetPolicy(const QualityLadderPolicy& newPolicy) {
+        policy = newPolicy;
+
+        // Thresholds must rise with the level, and exiting must need less
+        // load than entering or the ladder would oscillate
+        for (size_t i = 1; i < policy.enterLoad.size(); ++i)
+            policy.enterLoad[i] = std::max(policy.enterLoad[i], policy.enterLoad[i - 1]);
+        policy.exitRatio = std::min(std::max(policy.exitRatio, 0.0f), 1.0f);
+    }
+
+    bool QualityLadder::Update(float load) {
+        uint8_t current = level.load(std::memory_order_acquire);
+        bool changed = false;
+
+        if (current != observed) {
+            // SetCap() moved the level since the last frame
+            observed = current;
+            dwell = 0;
+            degradeRun = restoreRun = 0;
+            ++stats.transitions;
+            changed = true;
+        }
+
+        ++dwell;
+        ++stats.framesAt[current];
+
+        const uint8_t floor = cap.load(std::memory_order_acquire);
+        const uint8_t desired = std::max(Desired(load), floor);
+
+        if (desired > current) {
+            ++degradeRun;
+            restoreRun = 0;
+        }
+        else if (current > floor && load < policy.enterLoad[current - 1] * policy.exitRatio) {
+            ++restoreRun;
+            degradeRun = 0;
+        }
+        else {
+            degradeRun = restoreRun = 0;
+        }
+
+        if (dwell < policy.minDwellFrames) return changed;
+
+        uint8_t target = current;
+        if (degradeRun >= policy.degradeFrames)
+            target = desired;
+        else if (restoreRun >= policy.restoreFrames)
+            target = static_cast<uint8_t>(current - 1);
+
+        // A concurrent SetCap() wins; the next frame sees its level
+        if (target == current || !level.compare_exchange_strong(current, target, std::memory_order_acq_rel))
+            return changed;
+
+        observed = target;
+        dwell = 0;
+        degradeRun = restoreRun = 0;
+        ++stats.transitions;
+        return true;
+    }
+
+    void QualityLadder::SetCap(ShaderQuality quality) {
+        const uint8_t floor = std::min(static_cast<uint8_t>(quality), static_cast<uint8_t>(static_cast<uint8_t>(ShaderQuality::Count) - 1));
+        cap.store(floor, std::memory_order_release);
+        LowerTo(floor);
+    }
+
+    void QualityLadder::Reset() {
+        level.store(cap.load(std::memory_order_acquire), std::memory_order_release);
+        observed = level.load(std::memory_order_relaxed);
+        dwell = 0;
+        degradeRun = restoreRun = 0;
+        stats = QualityLadderStats{};
+    }
+
+    uint8_t QualityLadder::Desired(float load) const {
+        uint8_t desired = 0;
+        while (desired < policy.enterLoad.size() && load >= policy.enterLoad[desired])
+            ++desired;
+        return desired;
+    }
+
+    void QualityLadder::LowerTo(uint8_t floor) {
+        uint8_t current = level.load(std::memory_order_acquire);
+        while (current < floor && !level.compare_exchange_weak(current, floor, std::memory_order_acq_rel)) {}
+    }
+
+} // namespace QUADRAQ
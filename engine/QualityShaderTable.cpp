@@ -0,0 +1,127 @@
+// ====================================================================
+//                        QualityShaderTable.cpp
+//     TGDK Quantum GPU Accelerator — Per-Level Shader Replacements
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "QualityShaderTable.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace QUADRAQ {
+
+    QualityShaderTable::QualityShaderTable(IHandleOwner& owner, EpochDomain& domain) : owner(owner), domain(domain) {}
+
+    QualityShaderTable::~QualityShaderTable() {
+        // No reader may use a table that is being destroyed
+        if (const Snapshot* snapshot = current.load(std::memory_order_acquire))
+            DeleteSnapshot(const_cast<Snapshot*>(snapshot));
+        for (const Binding& binding : bindings) owner.Release(binding.replacement);
+        domain.Reclaim();
+    }
+
+    void QualityShaderTable::Register(ShaderQuality level, GpuHandle original, GpuHandle replacement) {
+        const uint32_t set = static_cast<uint32_t>(level);
+        if (set == 0 || set >= kLevels || !replacement) return;
+
+        std::lock_guard<std::mutex> lock(writeMutex);
+
+        auto it = std::find_if(bindings.begin(), bindings.end(),
+            [&](const Binding& binding) { return binding.set == set && binding.original == original; });
+        owner.Retain(replacement);
+        if (it == bindings.end()) {
+            bindings.push_back({ original, replacement, set });
+        } else {
+            owner.Release(it->replacement);
+            it->replacement = replacement;
+        }
+        PublishLocked();
+    }
+
+    void QualityShaderTable::Clear() {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        if (bindings.empty()) return;
+
+        // Unpublish first: readers only ever see the snapshot's references
+        const std::vector<Binding> dropped = std::move(bindings);
+        bindings.clear();
+        PublishLocked();
+        for (const Binding& binding : dropped) owner.Release(binding.replacement);
+    }
+
+    GpuHandle QualityShaderTable::Resolve(ShaderQuality quality, GpuHandle original) const {
+        EpochGuard guard(domain);
+        GpuHandle resolved = original;
+
+        const size_t level = static_cast<size_t>(quality);
+        const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+        if (snapshot && level > 0 && level < kLevels) {
+            const std::vector<Binding>& exact = snapshot->exact[level];
+            auto it = std::lower_bound(exact.begin(), exact.end(), original,
+                [](const Binding& binding, GpuHandle shader) { return std::less<GpuHandle>()(binding.original, shader); });
+
+            if (it != exact.end() && it->original == original) resolved = it->replacement;
+            else if (snapshot->fallback[level]) resolved = snapshot->fallback[level];
+        }
+
+        // Taken while the snapshot still holds its reference
+        if (resolved) owner.Retain(resolved);
+        return resolved;
+    }
+
+    size_t QualityShaderTable::Registrations() const {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        return bindings.size();
+    }
+
+    void QualityShaderTable::DeleteSnapshot(void* object) {
+        Snapshot* snapshot = static_cast<Snapshot*>(object);
+        for (size_t level = 1; level < kLevels; ++level) {
+            for (const Binding& binding : snapshot->exact[level]) snapshot->owner->Release(binding.replacement);
+            if (snapshot->fallback[level]) snapshot->owner->Release(snapshot->fallback[level]);
+        }
+        delete snapshot;
+    }
+
+    void QualityShaderTable::PublishLocked() {
+        Snapshot* next = nullptr;
+        if (!bindings.empty()) {
+            next = new Snapshot();
+            next->owner = &owner;
+            for (uint32_t level = 1; level < kLevels; ++level) {
+                // The nearest set, this level's or a richer one, that covers
+                // every shader hides exact replacements from sets past it
+                uint32_t floor = 0;
+                for (const Binding& binding : bindings) {
+                    if (!binding.original && binding.set <= level && binding.set > floor) {
+                        floor = binding.set;
+                        next->fallback[level] = binding.replacement;
+                    }
+                }
+                if (next->fallback[level]) owner.Retain(next->fallback[level]);
+
+                // A level's own replacement wins over a richer level's
+                std::vector<Binding>& exact = next->exact[level];
+                for (const Binding& binding : bindings) {
+                    if (!binding.original || binding.set > level || binding.set < floor) continue;
+
+                    auto it = std::find_if(exact.begin(), exact.end(),
+                        [&](const Binding& e) { return e.original == binding.original; });
+                    if (it == exact.end()) exact.push_back(binding);
+                    else if (binding.set > it->set) *it = binding;
+                }
+                std::sort(exact.begin(), exact.end(), [](const Binding& a, const Binding& b) {
+                    return std::less<GpuHandle>()(a.original, b.original);
+                });
+                for (const Binding& binding : exact) owner.Retain(binding.replacement);
+            }
+        }
+
+        const Snapshot* previous = current.exchange(next, std::memory_order_seq_cst);
+        if (previous) domain.Retire(const_cast<Snapshot*>(previous), &DeleteSnapshot);
+        domain.Reclaim();
+    }
+
+} // namespace QUADRAQ
@@ -8,21 +8,184 @@
 #include "QuantumDrawRouter.hpp"
 #include "TGDK_IAIBackend.hpp"
 #include "EntropyPredictor.hpp"
-#include "QUADRAQ.hpp"
+#include "SeqLock.hpp"
+#include "BitOps.hpp"
+#include "DrawBudget.hpp"
 
+#ifdef _WIN32
+#include "QUADRAQ.hpp"
+#include "D3D11RenderContext.hpp"
 #include <d3d11.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 namespace QuantumDrawRouter {
     static IAIBackend* gAIBackendPtr = nullptr;
 
+    // Configuration, only touched under routerMutex
     static bool routingEnabled = true;
     static float entropyThreshold = 0.010f; // Default drop level
+    static uint32_t suppressibleCategories = AllCategories;
+    static uint64_t policyFrame = 0;
+    static bool budgetedMode = false;
+    static float frameBudget = 1.0f / 60.0f;
     static std::mutex routerMutex;
 
+    static constexpr size_t kImportanceClasses = static_cast<size_t>(DrawImportance::Count);
+    static std::atomic<float> importanceWeights[kImportanceClasses] = { { -1.0f }, { 8.0f }, { 2.0f }, { 1.0f } };
+
+    // Frame-scoped verdict. The per-draw check is a single load of this mask.
+    static std::atomic<uint32_t> suppressMask{ 0 };
+    static std::atomic<uint64_t> publishedFrame{ 0 };
+    static QUADRAQ::SeqLock<FramePolicy> publishedPolicy;
+
+    // Cross-frame draw history, render thread only: only draws in a
+    // suppressed category reach it, so unsuppressed frames never touch it,
+    // and suppressed ones read and update it without a lock. Aged lazily
+    // when the first access of a new policy frame arrives.
+    static QUADRAQ::DrawSignatureTable signatureTable;
+    static QUADRAQ::SeqLock<QUADRAQ::DrawSignatureStats> signatureStats;
+
+    // Impact reports from the backends, any thread. The render thread
+    // folds them into the table at its next history access, so the lock
+    // is taken once per batch of reports rather than per draw.
+    struct ImpactReport {
+        uint64_t signature;
+        float contribution;
+        uint8_t impactFlags;
+    };
+    static std::mutex reportMutex;
+    static std::vector<ImpactReport> pendingReports;    // under reportMutex
+    static std::vector<ImpactReport> drainedReports;    // render thread only
+    static std::atomic<bool> reportsPending{ false };
+    static std::atomic<float> contributionFloor{ 0.01f };
+
+    // Deferred submission, render thread only apart from the flags
+    static std::atomic<bool> deferredMode{ false };
+    static std::atomic<uint32_t> reorderableCategories{
+        CategoryBit(DrawCategory::Opaque) | CategoryBit(DrawCategory::Shadow) };
+    static QUADRAQ::RenderQueue deferredQueue;
+    static QUADRAQ::SeqLock<QUADRAQ::RenderQueueStats> lastFlushStats;
+
+    // Budgeted selection, render thread only. Excess already shed counts
+    // against the frame it was shed in.
+    static QUADRAQ::DrawBudgetSelector budgetSelector;
+    static uint64_t budgetFrame = UINT64_MAX;
+    static float budgetShed = 0.0f;
+    static std::vector<float> budgetCosts;
+    static std::vector<uint8_t> budgetClasses;
+    static std::vector<uint64_t> budgetMask;
+
+    // Closed-loop shed amount, under routerMutex. The projected frame time
+    // already reflects what was shed, so it steers this amount instead of
+    // being it; the render thread reports what it could not shed.
+    static constexpr float kShedGain = 0.5f;
+    static constexpr float kShedDeadband = 0.05f;   // fraction of the budget held under it
+    static float shedTarget = 0.0f;
+    static uint64_t shedFrame = 0;                  // last frame integrated
+    static std::atomic<float> unmetExcess{ 0.0f };
+
+    // SubmitDrawBatch scratch, render thread only
+    static std::vector<uint64_t> batchMask;
+    static std::vector<float> batchCosts;
+    static std::vector<uint64_t> batchSignatures;
+
+    // Decides once for the whole frame: thresholds, backend verdict, masks
+    static void EvaluatePolicyLocked() {
+        FramePolicy policy;
+        policy.frameIndex = policyFrame;
+        policy.routingEnabled = routingEnabled;
+
+        policy.budgeted = budgetedMode;
+        policy.frameBudget = frameBudget;
+
+        if (routingEnabled) {
+            const EntropyPredictor::Snapshot snapshot = EntropyPredictor::GetSnapshot();
+            policy.entropy = snapshot.entropyRate;
+
+            if (budgetedMode) {
+                // Forecast when the predictor has one, window mean otherwise
+                policy.projectedFrameTime = snapshot.forecastLevel > 0.0f
+                    ? std::max(0.0f, snapshot.forecastLevel + snapshot.forecastTrend)
+                    : snapshot.meanFrameTime;
+
+                // Once per frame, integrate toward the budget and hold inside
+                // the band just under it. While the last frame ran out of
+                // droppable draws, asking for more would only wind up the target.
+                const float error = policy.projectedFrameTime - frameBudget;
+                const bool saturated = unmetExcess.load(std::memory_order_relaxed) > 0.0f;
+                const bool outsideBand = error < -kShedDeadband * frameBudget || (error > 0.0f && !saturated);
+                if (policyFrame != shedFrame && outsideBand)
+                    shedTarget = std::max(0.0f, shedTarget + kShedGain * error);
+                shedFrame = policyFrame;
+
+                policy.budgetExcess = shedTarget;
+                policy.suppress = policy.budgetExcess > 0.0f;
+            }
+            else {
+                // Let AI override suppression decision
+                policy.backendVerdict = gAIBackendPtr && gAIBackendPtr->ShouldSuppressDraw(policy.entropy);
+                policy.suppress = policy.backendVerdict || policy.entropy > entropyThreshold;
+            }
+        }
+
+        if (!routingEnabled || !budgetedMode) {
+            shedTarget = 0.0f;
+            unmetExcess.store(0.0f, std::memory_order_relaxed);
+        }
+
+        policy.suppressMask = policy.suppress && !budgetedMode ? suppressibleCategories : 0;
+        suppressMask.store(policy.suppressMask, std::memory_order_release);
+        publishedFrame.store(policy.frameIndex, std::memory_order_relaxed);
+        publishedPolicy.Store(policy);
+    }
+
+    // Render thread: brings the table to the published frame and applies
+    // whatever the backends reported since the last call
+    static void SyncSignatureTable() {
+        const uint32_t frame = static_cast<uint32_t>(publishedFrame.load(std::memory_order_relaxed));
+        bool changed = false;
+        if (frame != signatureTable.CurrentFrame()) {
+            signatureTable.AdvanceFrame(frame);
+            changed = true;
+        }
+
+        if (reportsPending.load(std::memory_order_acquire)) {
+            {
+                std::lock_guard<std::mutex> lock(reportMutex);
+                drainedReports.swap(pendingReports);
+                reportsPending.store(false, std::memory_order_relaxed);
+            }
+            for (const ImpactReport& report : drainedReports)
+                signatureTable.ReportImpact(report.signature, report.contribution, report.impactFlags);
+            drainedReports.clear();
+            changed = true;
+        }
+
+        if (changed) signatureStats.Store(signatureTable.Stats());
+    }
+
+    // The history's say on a draw in a suppressed category; table synced
+    static bool HistoryAllowsSuppression(uint64_t signature, float floor) {
+        QUADRAQ::DrawHistory* history = signatureTable.Touch(signature);
+
+        if (history->impactFlags & (QUADRAQ::DrawImpact::Critical | QUADRAQ::DrawImpact::SuppressionArtifact))
+            return false;
+        if (history->contribution > floor)
+            return false;
+
+        if (history->timesSuppressed != UINT16_MAX) ++history->timesSuppressed;
+        return true;
+    }
+
     void EnableRouting(bool enable) {
         std::lock_guard<std::mutex> lock(routerMutex);
         routingEnabled = enable;
+        EvaluatePolicyLocked();
 
         IAIBackend* backend = GetAIBackend();
         if (backend) {
@@ -35,40 +198,324 @@ namespace QuantumDrawRouter {
     void SetEntropyThreshold(float threshold) {
         std::lock_guard<std::mutex> lock(routerMutex);
         entropyThreshold = threshold;
+        EvaluatePolicyLocked();
 
         if (gAIBackendPtr) {
             gAIBackendPtr->Log("QuantumDrawRouter :: Set entropy threshold to " + std::to_string(threshold));
         }
     }
 
-    bool ShouldSuppressDraw() {
+    void SetSuppressibleCategories(uint32_t categoryMask) {
+        std::lock_guard<std::mutex> lock(routerMutex);
+        suppressibleCategories = categoryMask;
+        EvaluatePolicyLocked();
+    }
+
+    void BeginFrame() {
         std::lock_guard<std::mutex> lock(routerMutex);
+        ++policyFrame;
+        EvaluatePolicyLocked();
+    }
 
-        if (!routingEnabled)
-            return false;
+    FramePolicy GetFramePolicy() {
+        return publishedPolicy.Load();
+    }
+
+    bool ShouldSuppressDraw(DrawCategory category) {
+        return (suppressMask.load(std::memory_order_relaxed) >> static_cast<uint32_t>(category)) & 1u;
+    }
+
+    bool ShouldSuppressDraw(DrawCategory category, uint64_t signature) {
+        if (!ShouldSuppressDraw(category)) return false;
+
+        SyncSignatureTable();
+        return HistoryAllowsSuppression(signature, contributionFloor.load(std::memory_order_relaxed));
+    }
+
+    uint64_t DrawSignature(const QUADRAQ::QueuedDraw& draw) {
+        return QUADRAQ::DrawSignatureTable::Fingerprint(draw.vertexBuffer, draw.stride, draw.offset,
+            draw.vertexShader, draw.pixelShader, draw.texture);
+    }
+
+    void ReportDrawImpact(uint64_t signature, float contribution, uint8_t impactFlags) {
+        std::lock_guard<std::mutex> lock(reportMutex);
+        pendingReports.push_back({ signature, contribution, impactFlags });
+        reportsPending.store(true, std::memory_order_release);
+    }
+
+    void SetContributionFloor(float contribution) {
+        contributionFloor.store(contribution, std::memory_order_relaxed);
+    }
+
+    QUADRAQ::DrawSignatureStats GetSignatureStats() {
+        return signatureStats.Load();
+    }
+
+    size_t EvaluateDrawBatch(const DrawCategory* categories, size_t count, uint64_t* survivorMask) {
+        const uint32_t mask = suppressMask.load(std::memory_order_relaxed);
+        const size_t words = (count + 63) / 64;
+        if (words == 0) return 0;
+
+        // Uniform verdicts skip the per-draw pass entirely
+        bool uniform = true;
+        bool keepAll = false;
+        if (mask == 0) keepAll = true;
+        else if ((mask & AllCategories) == AllCategories) keepAll = false;
+        else if (!categories) keepAll = !(mask & CategoryBit(DrawCategory::Default));
+        else uniform = false;
+
+        if (uniform) {
+            std::fill(survivorMask, survivorMask + words, keepAll ? ~0ull : 0ull);
+            if (keepAll && (count & 63))
+                survivorMask[words - 1] = (1ull << (count & 63)) - 1;
+            return keepAll ? count : 0;
+        }
+
+        // Branch-free inner loop over the category array, 64 draws per word
+        const uint32_t keepMask = ~mask;
+        size_t survivors = 0;
+        for (size_t w = 0; w < words; ++w) {
+            const DrawCategory* block = categories + w * 64;
+            const size_t n = std::min<size_t>(64, count - w * 64);
+
+            uint64_t bits = 0;
+            for (size_t j = 0; j < n; ++j)
+                bits |= static_cast<uint64_t>((keepMask >> (static_cast<uint32_t>(block[j]) & 31u)) & 1u) << j;
+
+            survivorMask[w] = bits;
+            survivors += QUADRAQ::PopCount64(bits);
+        }
+        return survivors;
+    }
+
+    size_t EvaluateDrawBatch(const DrawCategory* categories, const uint64_t* signatures, size_t count, uint64_t* survivorMask) {
+        size_t survivors = EvaluateDrawBatch(categories, count, survivorMask);
+        if (!signatures || survivors == count) return survivors;
+
+        // Same refinement as the per-draw check, for the suppressed draws only
+        SyncSignatureTable();
+        const float floor = contributionFloor.load(std::memory_order_relaxed);
+        const size_t words = (count + 63) / 64;
+        for (size_t w = 0; w < words; ++w) {
+            const size_t n = std::min<size_t>(64, count - w * 64);
+            uint64_t suppressed = ~survivorMask[w] & (n == 64 ? ~0ull : (1ull << n) - 1);
+            while (suppressed) {
+                const size_t j = QUADRAQ::CountTrailingZeros64(suppressed);
+                suppressed &= suppressed - 1;
+                if (!HistoryAllowsSuppression(signatures[w * 64 + j], floor)) {
+                    survivorMask[w] |= 1ull << j;
+                    ++survivors;
+                }
+            }
+        }
+        return survivors;
+    }
+
+    void SetBudgetedMode(bool enable) {
+        std::lock_guard<std::mutex> lock(routerMutex);
+        budgetedMode = enable;
+        EvaluatePolicyLocked();
+
+        IAIBackend* backend = GetAIBackend();
+        if (backend) {
+            backend->Log(std::string("QuantumDrawRouter :: Budgeted suppression ") +
+                (enable ? "ENABLED" : "DISABLED"));
+        }
+    }
+
+    void SetFrameBudget(float seconds) {
+        std::lock_guard<std::mutex> lock(routerMutex);
+        frameBudget = std::max(seconds, 0.0f);
+        EvaluatePolicyLocked();
+    }
+
+    void SetImportanceWeight(DrawImportance importance, float weight) {
+        const size_t index = static_cast<size_t>(importance);
+        if (index < kImportanceClasses)
+            importanceWeights[index].store(weight, std::memory_order_relaxed);
+    }
+
+    size_t EvaluateBudgetedBatch(const float* costs, const DrawImportance* importance, size_t count, uint64_t* survivorMask) {
+        const FramePolicy policy = publishedPolicy.Load();
+        if (!policy.budgeted || !costs)
+            return EvaluateDrawBatch(nullptr, count, survivorMask);
+
+        if (policy.frameIndex != budgetFrame) {
+            budgetFrame = policy.frameIndex;
+            budgetShed = 0.0f;
+        }
+
+        float weights[kImportanceClasses];
+        for (size_t i = 0; i < kImportanceClasses; ++i)
+            weights[i] = importanceWeights[i].load(std::memory_order_relaxed);
+
+        const QUADRAQ::DrawBudgetResult result = budgetSelector.Select(costs,
+            reinterpret_cast<const uint8_t*>(importance), count, policy.budgetExcess - budgetShed,
+            weights, kImportanceClasses, survivorMask);
+        budgetShed += result.droppedCost;
+        unmetExcess.store(std::max(0.0f, policy.budgetExcess - budgetShed), std::memory_order_relaxed);
+        return count - result.dropped;
+    }
+
+    size_t ApplyVisibilityMask(uint64_t* survivorMask, const uint64_t* visibleMask, size_t count) {
+        const size_t words = (count + 63) / 64;
+        size_t survivors = 0;
+        for (size_t w = 0; w < words; ++w) {
+            survivorMask[w] &= visibleMask[w];
+            survivors += QUADRAQ::PopCount64(survivorMask[w]);
+        }
+        return survivors;
+    }
+
+    size_t CompactSurvivors(const uint64_t* survivorMask, size_t count, uint32_t* survivorIndices) {
+        const size_t words = (count + 63) / 64;
+        size_t written = 0;
+
+        for (size_t w = 0; w < words; ++w) {
+            uint64_t bits = survivorMask[w];
+            while (bits) {
+                survivorIndices[written++] = static_cast<uint32_t>(w * 64 + QUADRAQ::CountTrailingZeros64(bits));
+                bits &= bits - 1;
+            }
+        }
+        return written;
+    }
 
-        float entropy = EntropyPredictor::GetCurrentEntropyRate();
+    void SetDeferredMode(bool enable) {
+        deferredMode.store(enable, std::memory_order_relaxed);
 
-        // Let AI override suppression decision
-        if (gAIBackendPtr && gAIBackendPtr->ShouldSuppressDraw(entropy)) {
+        IAIBackend* backend = GetAIBackend();
+        if (backend) {
+            backend->Log(std::string("QuantumDrawRouter :: Deferred submission ") +
+                (enable ? "ENABLED" : "DISABLED"));
+        }
+    }
+
+    bool IsDeferredMode() {
+        return deferredMode.load(std::memory_order_relaxed);
+    }
+
+    void SetReorderableCategories(uint32_t categoryMask) {
+        reorderableCategories.store(categoryMask & AllCategories, std::memory_order_relaxed);
+    }
+
+    bool SubmitDraw(QUADRAQ::IRenderContext& context, const QUADRAQ::QueuedDraw& draw, DrawCategory category) {
+        if (ShouldSuppressDraw(category, DrawSignature(draw))) return false;
+
+        if (deferredMode.load(std::memory_order_relaxed)) {
+            const bool reorderable = (reorderableCategories.load(std::memory_order_relaxed) & CategoryBit(category)) != 0;
+            deferredQueue.Push(draw, reorderable ? static_cast<uint32_t>(category) : QUADRAQ::RenderQueue::kNoReorder);
             return true;
         }
 
-        return entropy > entropyThreshold;
+        context.SetVertexShader(draw.vertexShader);
+        context.SetPixelShader(draw.pixelShader);
+        context.SetShaderResource(QUADRAQ::ShaderStage::Pixel, 0, draw.texture);
+        context.SetVertexBuffer(0, draw.vertexBuffer, draw.stride, draw.offset);
+        context.Draw(draw.vertexCount, draw.startVertex);
+        return true;
+    }
+
+    QUADRAQ::RenderQueueStats FlushDeferred(QUADRAQ::IRenderContext& context) {
+        if (deferredQueue.Size() == 0) return QUADRAQ::RenderQueueStats{};
+
+        if (publishedPolicy.Load().budgeted) {
+            const std::vector<QUADRAQ::QueuedDraw>& draws = deferredQueue.Draws();
+            budgetCosts.resize(draws.size());
+            budgetClasses.resize(draws.size());
+            budgetMask.resize((draws.size() + 63) / 64);
+            for (size_t i = 0; i < draws.size(); ++i) {
+                budgetCosts[i] = draws[i].cost;
+                budgetClasses[i] = draws[i].importance;
+            }
+
+            const size_t survivors = EvaluateBudgetedBatch(budgetCosts.data(),
+                reinterpret_cast<const DrawImportance*>(budgetClasses.data()), draws.size(), budgetMask.data());
+            if (survivors != draws.size()) deferredQueue.Retain(budgetMask.data());
+        }
+
+        deferredQueue.Sort();
+        const QUADRAQ::RenderQueueStats stats = deferredQueue.Submit(context);
+        lastFlushStats.Store(stats);
+        return stats;
+    }
+
+    QUADRAQ::RenderQueueStats GetLastFlushStats() {
+        return lastFlushStats.Load();
     }
 
+    size_t SubmitDrawBatch(QUADRAQ::IRenderContext* context, const DrawBatch& batch, uint32_t* survivorIndices) {
+        if (batch.count == 0 || !survivorIndices) return 0;
+
+        // Scratch kept across batches, so a burst allocates only when it
+        // outgrows every earlier one
+        batchMask.resize((batch.count + 63) / 64);
+        uint64_t* mask = batchMask.data();
+
+        if (batch.costs && GetFramePolicy().budgeted) {
+            // Culled draws cost nothing, so the budget is spent on visible ones
+            const float* costs = batch.costs;
+            if (batch.visibleMask) {
+                batchCosts.assign(costs, costs + batch.count);
+                for (size_t i = 0; i < batch.count; ++i) {
+                    if (!((batch.visibleMask[i >> 6] >> (i & 63)) & 1)) batchCosts[i] = 0.0f;
+                }
+                costs = batchCosts.data();
+            }
+            EvaluateBudgetedBatch(costs, batch.importance, batch.count, mask);
+        }
+        else {
+            // Without caller signatures, the same fingerprint AttemptDraw
+            // uses, computed only when something may be suppressed
+            const uint64_t* signatures = batch.signatures;
+            if (!signatures && batch.vertexBuffers && batch.strides && batch.offsets &&
+                suppressMask.load(std::memory_order_relaxed) != 0) {
+                batchSignatures.resize(batch.count);
+                for (size_t i = 0; i < batch.count; ++i) {
+                    batchSignatures[i] = QUADRAQ::DrawSignatureTable::Fingerprint(batch.vertexBuffers[i],
+                        batch.strides[i], batch.offsets[i], nullptr, nullptr, nullptr);
+                }
+                signatures = batchSignatures.data();
+            }
+            EvaluateDrawBatch(batch.categories, signatures, batch.count, mask);
+        }
+        if (batch.visibleMask)
+            ApplyVisibilityMask(mask, batch.visibleMask, batch.count);
+        const size_t survivors = CompactSurvivors(mask, batch.count, survivorIndices);
+
+        if (context && batch.vertexBuffers && batch.strides && batch.offsets && batch.vertexCounts) {
+            for (size_t i = 0; i < survivors; ++i) {
+                const uint32_t draw = survivorIndices[i];
+                const QUADRAQ::GpuHandle vertexBuffer = batch.vertexBuffers[draw];
+                if (!vertexBuffer || batch.vertexCounts[draw] == 0) continue;
+                context->SetVertexBuffer(0, vertexBuffer, batch.strides[draw], batch.offsets[draw]);
+                context->Draw(batch.vertexCounts[draw], batch.startVertices ? batch.startVertices[draw] : 0);
+            }
+        }
+        return survivors;
+    }
+
+#ifdef _WIN32
     void AttemptDraw(ID3D11DeviceContext* context, ID3D11Buffer* vertexBuffer, UINT stride, UINT offset) {
-        if (ShouldSuppressDraw()) {
-            if (gAIBackendPtr)
-                gAIBackendPtr->LogError("QuantumDrawRouter :: Suppressed draw call due to high entropy.");
+        const uint64_t signature = QUADRAQ::DrawSignatureTable::Fingerprint(vertexBuffer, stride, offset, nullptr, nullptr, nullptr);
+        if (ShouldSuppressDraw(DrawCategory::Default, signature)) {
             return; // Skip rendering
         }
 
         // Basic forward example
         if (context && vertexBuffer) {
-            UINT zero = 0;
-            context->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
+            // One bind, nothing for the state cache to elide
+            QUADRAQ::D3D11RenderContext(context).SetVertexBuffer(0, vertexBuffer, stride, offset);
             // TODO: Add draw call or additional logic here as needed
         }
     }
-}
\ No newline at end of file
+
+    size_t AttemptDrawBatch(ID3D11DeviceContext* context, const DrawBatch& batch, uint32_t* survivorIndices) {
+        if (!context) return SubmitDrawBatch(nullptr, batch, survivorIndices);
+
+        // Repeated buffers within the batch are bound once
+        QUADRAQ::StateCacheScope scope(context);
+        return SubmitDrawBatch(&scope.Cache(), batch, survivorIndices);
+    }
+#endif
+}
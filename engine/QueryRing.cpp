@@ -0,0 +1,105 @@
+// ====================================================================
+//                            QueryRing.cpp
+//     TGDK Quantum GPU Accelerator — Non-Blocking GPU Query Ring
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "QueryRing.hpp"
+
+#include <algorithm>
+
+namespace QUADRAQ {
+
+    QueryRing::QueryRing(IQueryDevice& device, uint32_t framesInFlight)
+        : device(device),
+          depth(std::min(std::max(framesInFlight, 1u), kMaxFramesInFlight)) {}
+
+    QueryRing::~QueryRing() {
+        Release();
+    }
+
+    bool QueryRing::Initialize() {
+        if (initialized) return true;
+
+        for (uint32_t i = 0; i < depth; ++i) {
+            slots[i].query = device.CreatePipelineQuery();
+            if (!slots[i].query) {
+                Release();
+                return false;
+            }
+        }
+
+        initialized = true;
+        return true;
+    }
+
+    void QueryRing::Release() {
+        for (Slot& slot : slots) {
+            if (slot.query) device.ReleaseQuery(slot.query);
+            slot = Slot{};
+        }
+
+        next = 0;
+        oldest = 0;
+        recording = kMaxFramesInFlight;
+        initialized = false;
+    }
+
+    bool QueryRing::Begin() {
+        ++frame;
+        if (!initialized || recording != kMaxFramesInFlight) return false;
+
+        // Slots are issued and retired in order, so the next one being
+        // busy means every slot is still waiting on the GPU.
+        Slot& slot = slots[next];
+        if (slot.state != SlotState::Idle) {
+            ++stats.skipped;
+            return false;
+        }
+
+        device.Begin(slot.query);
+        slot.state = SlotState::Recording;
+        slot.frame = frame;
+        recording = next;
+        next = (next + 1) % depth;
+        ++stats.begun;
+        return true;
+    }
+
+    void QueryRing::End() {
+        if (recording == kMaxFramesInFlight) return;
+
+        Slot& slot = slots[recording];
+        device.End(slot.query);
+        slot.state = SlotState::InFlight;
+        recording = kMaxFramesInFlight;
+    }
+
+    bool QueryRing::Collect(PipelineStatistics& out) {
+        bool found = false;
+
+        while (slots[oldest].state == SlotState::InFlight) {
+            Slot& slot = slots[oldest];
+
+            PipelineStatistics result;
+            const QueryPoll poll = device.Poll(slot.query, result);
+            if (poll == QueryPoll::Pending) break;
+
+            if (poll == QueryPoll::Ready) {
+                out = result;
+                found = true;
+                stats.latency = static_cast<uint32_t>(frame - slot.frame);
+                ++stats.collected;
+            }
+            else {
+                ++stats.failed;
+            }
+
+            slot.state = SlotState::Idle;
+            oldest = (oldest + 1) % depth;
+        }
+
+        return found;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,53 @@
+// ====================================================================
+//                      RecordingRenderContext.cpp
+//     TGDK Quantum GPU Accelerator — Headless Device Context
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RecordingRenderContext.hpp"
+
+namespace QUADRAQ {
+
+    void RecordingRenderContext::SetVertexBuffer(uint32_t slot, GpuHandle buffer, uint32_t stride, uint32_t offset) {
+        Record({ Call::SetVertexBuffer, ShaderStage::Vertex, slot, buffer, stride, offset });
+    }
+
+    void RecordingRenderContext::SetVertexShader(GpuHandle shader) {
+        Record({ Call::SetVertexShader, ShaderStage::Vertex, 0, shader, 0, 0 });
+    }
+
+    void RecordingRenderContext::SetPixelShader(GpuHandle shader) {
+        Record({ Call::SetPixelShader, ShaderStage::Pixel, 0, shader, 0, 0 });
+    }
+
+    void RecordingRenderContext::SetShaderResource(ShaderStage stage, uint32_t slot, GpuHandle view) {
+        Record({ Call::SetShaderResource, stage, slot, view, 0, 0 });
+    }
+
+    void RecordingRenderContext::SetPrimitiveTopology(uint32_t topology) {
+        Record({ Call::SetPrimitiveTopology, ShaderStage::Vertex, 0, nullptr, topology, 0 });
+    }
+
+    void RecordingRenderContext::Draw(uint32_t vertexCount, uint32_t startVertex) {
+        Record({ Call::Draw, ShaderStage::Vertex, 0, nullptr, vertexCount, startVertex });
+    }
+
+    void RecordingRenderContext::Clear() {
+        commands.clear();
+        counts.fill(0);
+    }
+
+    size_t RecordingRenderContext::BindCount() const {
+        size_t binds = 0;
+        for (size_t i = 0; i < counts.size(); ++i) {
+            if (i != static_cast<size_t>(Call::Draw)) binds += counts[i];
+        }
+        return binds;
+    }
+
+    void RecordingRenderContext::Record(const Command& command) {
+        ++counts[static_cast<size_t>(command.call)];
+        if (keepLog) commands.push_back(command);
+    }
+
+} // namespace QUADRAQ
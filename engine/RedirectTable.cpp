@@ -0,0 +1,250 @@
+// ====================================================================
+//                           RedirectTable.cpp
+//     TGDK Quantum GPU Accelerator — Read-Mostly Name Redirects
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RedirectTable.hpp"
+#include "BloomFilter.hpp"
+#include "PerfectHashIndex.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace QUADRAQ {
+
+    namespace {
+        char FoldAscii(char c) {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+        }
+
+        // `stored` is already folded
+        bool EqualFolded(const char* stored, const char* name, size_t length) {
+            for (; length >= 8; stored += 8, name += 8, length -= 8) {
+                uint64_t a, b;
+                std::memcpy(&a, stored, 8);
+                std::memcpy(&b, name, 8);
+                if (a != FoldAscii64(b)) return false;
+            }
+            for (size_t i = 0; i < length; ++i) {
+                if (stored[i] != FoldAscii(name[i])) return false;
+            }
+            return true;
+        }
+    }
+
+    std::string FoldName(std::string_view name) {
+        std::string folded(name);
+        for (char& c : folded) c = FoldAscii(c);
+        return folded;
+    }
+
+    struct RedirectTable::Snapshot {
+        // One per distinct name hash, at its perfect-hash position
+        struct Slot {
+            uint64_t hash = 0;
+            uint32_t first = 0;         // into `records`
+            uint32_t count = 0;         // 0 = empty; >1 only on a 64-bit collision
+        };
+
+        struct Record {
+            uint32_t offset;            // into `names`
+            uint32_t length;
+            GpuHandle target;
+        };
+
+        BloomFilter filter;
+        PerfectHashIndex index;
+        std::vector<Slot> slots;
+        std::vector<Record> records;
+        std::string names;
+        uint64_t version = 0;
+
+        std::string_view Name(const Record& record) const {
+            return std::string_view(names.data() + record.offset, record.length);
+        }
+
+        size_t MemoryBytes() const {
+            return filter.MemoryBytes() + index.MemoryBytes() + slots.size() * sizeof(Slot) +
+                   records.size() * sizeof(Record) + names.capacity();
+        }
+    };
+
+    struct RedirectTable::Entry {
+        std::string_view name;
+        uint64_t hash;
+        GpuHandle target;
+    };
+
+    RedirectTable::RedirectTable(EpochDomain& domain) : RedirectTable(NameCase::Sensitive, domain) {}
+
+    RedirectTable::RedirectTable(NameCase nameCase, EpochDomain& domain) : domain(domain), nameCase(nameCase) {}
+
+    RedirectTable::~RedirectTable() {
+        // No reader may use a table that is being destroyed
+        delete current.load(std::memory_order_acquire);
+        domain.Reclaim();
+    }
+
+    void RedirectTable::Set(std::string_view name, GpuHandle target) {
+        SetMany({ name }, target);
+    }
+
+    void RedirectTable::SetMany(const std::vector<std::string_view>& names, GpuHandle target) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+
+        // Folded tables store and match the folded spelling
+        std::vector<std::string> folded;
+        if (nameCase == NameCase::Folded) {
+            folded.reserve(names.size());
+            for (std::string_view name : names) folded.push_back(FoldName(name));
+        }
+
+        std::unordered_map<std::string_view, bool> updates;     // name -> already set to target
+        if (folded.empty()) {
+            for (std::string_view name : names) updates.emplace(name, false);
+        } else {
+            for (const std::string& name : folded) updates.emplace(name, false);
+        }
+
+        const Snapshot* snapshot = current.load(std::memory_order_acquire);
+
+        std::vector<Entry> entries;
+        entries.reserve((snapshot ? snapshot->records.size() : 0) + updates.size());
+
+        bool changed = false;
+        if (snapshot) {
+            for (const Snapshot::Slot& slot : snapshot->slots) {
+                for (uint32_t i = 0; i < slot.count; ++i) {
+                    const Snapshot::Record& record = snapshot->records[slot.first + i];
+                    const std::string_view name = snapshot->Name(record);
+
+                    const auto update = updates.find(name);
+                    if (update != updates.end()) {
+                        update->second = record.target == target;
+                        changed |= !update->second;
+                        continue;
+                    }
+                    entries.push_back({ name, slot.hash, record.target });
+                }
+            }
+        }
+
+        if (target) {
+            for (const auto& update : updates) {
+                changed |= !update.second;
+                entries.push_back({ update.first, NameKey(update.first).hash, target });
+            }
+        }
+        if (!changed) return;
+
+        Publish(Build(entries, snapshot ? snapshot->version + 1 : 1));
+    }
+
+    bool RedirectTable::Remove(std::string_view name) {
+        if (!Find(name)) return false;
+
+        Set(name, nullptr);
+        return true;
+    }
+
+    void RedirectTable::Clear() {
+        std::lock_guard<std::mutex> lock(writeMutex);
+
+        const Snapshot* snapshot = current.load(std::memory_order_acquire);
+        if (!snapshot || snapshot->records.empty()) return;
+
+        Publish(Build({}, snapshot->version + 1));
+    }
+
+    GpuHandle RedirectTable::Find(const NameKey& key) const {
+        EpochGuard guard(domain);
+
+        const bool folding = nameCase == NameCase::Folded;
+        uint64_t hash = key.hash;
+        if (key.folded != folding)
+            hash = folding ? FoldedHash64(key.name.data(), key.name.size()) : FastHash64(key.name.data(), key.name.size());
+
+        const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+        if (!snapshot || !snapshot->filter.MayContain(hash)) return nullptr;
+
+        const Snapshot::Slot& slot = snapshot->slots[snapshot->index.Lookup(hash)];
+        if (slot.hash != hash) return nullptr;
+
+        for (uint32_t i = 0; i < slot.count; ++i) {
+            const Snapshot::Record& record = snapshot->records[slot.first + i];
+            if (record.length != key.name.size()) continue;
+
+            const char* stored = snapshot->names.data() + record.offset;
+            if (folding ? EqualFolded(stored, key.name.data(), record.length)
+                        : std::memcmp(stored, key.name.data(), record.length) == 0)
+                return record.target;
+        }
+        return nullptr;
+    }
+
+    size_t RedirectTable::Size() const {
+        EpochGuard guard(domain);
+        const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+        return snapshot ? snapshot->records.size() : 0;
+    }
+
+    size_t RedirectTable::MemoryBytes() const {
+        EpochGuard guard(domain);
+        const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+        return snapshot ? snapshot->MemoryBytes() : 0;
+    }
+
+    void RedirectTable::DeleteSnapshot(void* snapshot) {
+        delete static_cast<Snapshot*>(snapshot);
+    }
+
+    void RedirectTable::Publish(Snapshot* next) {
+        const Snapshot* previous = current.exchange(next, std::memory_order_seq_cst);
+        version.store(next->version, std::memory_order_release);
+        if (previous) domain.Retire(const_cast<Snapshot*>(previous), &DeleteSnapshot);
+        domain.Reclaim();
+    }
+
+    RedirectTable::Snapshot* RedirectTable::Build(const std::vector<Entry>& entries, uint64_t version) {
+        auto* snapshot = new Snapshot();
+        snapshot->version = version;
+
+        // Group by hash so names that collide in 64 bits share one slot
+        std::vector<const Entry*> sorted;
+        sorted.reserve(entries.size());
+        for (const Entry& entry : entries) sorted.push_back(&entry);
+        std::sort(sorted.begin(), sorted.end(), [](const Entry* a, const Entry* b) { return a->hash < b->hash; });
+
+        std::vector<uint64_t> hashes;
+        for (const Entry* entry : sorted) {
+            if (hashes.empty() || hashes.back() != entry->hash) hashes.push_back(entry->hash);
+        }
+
+        snapshot->filter.Build(hashes);
+        snapshot->index.Build(hashes);
+        snapshot->slots.resize(snapshot->index.TableSize());
+        snapshot->records.reserve(sorted.size());
+
+        size_t nameBytes = 0;
+        for (const Entry& entry : entries) nameBytes += entry.name.size();
+        snapshot->names.reserve(nameBytes);
+
+        for (const Entry* entry : sorted) {
+            Snapshot::Slot& slot = snapshot->slots[snapshot->index.Lookup(entry->hash)];
+            if (slot.count == 0) {
+                slot.hash = entry->hash;
+                slot.first = static_cast<uint32_t>(snapshot->records.size());
+            }
+            ++slot.count;
+
+            snapshot->records.push_back({ static_cast<uint32_t>(snapshot->names.size()),
+                                          static_cast<uint32_t>(entry->name.size()), entry->target });
+            snapshot->names.append(entry->name.data(), entry->name.size());
+        }
+        return snapshot;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,207 @@
+// ====================================================================
+//                           RenderQueue.cpp
+//     TGDK Quantum GPU Accelerator — Deferred Draw Queue
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RenderQueue.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace QUADRAQ {
+
+    namespace {
+        constexpr size_t kInsertionSortLimit = 64;
+        constexpr unsigned kDigitBits = 8;
+        constexpr size_t kDigitCount = 64 / kDigitBits;
+        constexpr size_t kBuckets = size_t(1) << kDigitBits;
+
+        uint64_t HashHandle(const void* handle) {
+            uint64_t x = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            return x;
+        }
+
+        uint64_t TopBits(uint64_t hash, unsigned bits) {
+            return hash >> (64 - bits);
+        }
+
+        // State that has to be rebound to go from `previous` (null = nothing
+        // bound yet) to `next`
+        struct BindSet {
+            bool vertexShader;
+            bool pixelShader;
+            bool texture;
+            bool vertexBuffer;
+
+            size_t Count() const {
+                return size_t(vertexShader) + size_t(pixelShader) + size_t(texture) + size_t(vertexBuffer);
+            }
+        };
+
+        BindSet Diff(const QueuedDraw* previous, const QueuedDraw& next) {
+            if (!previous) return { true, true, true, true };
+            return {
+                previous->vertexShader != next.vertexShader,
+                previous->pixelShader != next.pixelShader,
+                previous->texture != next.texture,
+                previous->vertexBuffer != next.vertexBuffer ||
+                    previous->stride != next.stride || previous->offset != next.offset
+            };
+        }
+    }
+
+    void RenderQueue::Reserve(size_t count) {
+        draws.reserve(count);
+        entries.reserve(count);
+        scratch.reserve(count);
+    }
+
+    void RenderQueue::Clear() {
+        draws.clear();
+        entries.clear();
+        segmentStarts.clear();
+        lastGroup = kNoReorder;
+        arrivalBinds = 0;
+    }
+
+    uint64_t RenderQueue::MakeSortKey(const QueuedDraw& draw) {
+        const uint64_t shaders = HashHandle(draw.vertexShader) ^ (HashHandle(draw.pixelShader) * 0x9E3779B97F4A7C15ull);
+        const float depth = std::min(std::max(draw.depth, 0.0f), 1.0f);
+
+        return (TopBits(shaders, 20) << 44) |
+            (TopBits(HashHandle(draw.texture), 14) << 30) |
+            (TopBits(HashHandle(draw.vertexBuffer), 14) << 16) |
+            static_cast<uint64_t>(depth * 65535.0f + 0.5f);
+    }
+
+    void RenderQueue::Push(const QueuedDraw& draw, uint32_t sortGroup) {
+        arrivalBinds += Diff(draws.empty() ? nullptr : &draws.back(), draw).Count();
+
+        // Every unsortable draw is a segment of its own
+        if (sortGroup == kNoReorder || sortGroup != lastGroup)
+            segmentStarts.push_back(static_cast<uint32_t>(entries.size()));
+        lastGroup = sortGroup;
+
+        entries.push_back({ sortGroup == kNoReorder ? 0 : MakeSortKey(draw), static_cast<uint32_t>(draws.size()) });
+        draws.push_back(draw);
+    }
+
+    void RenderQueue::Retain(const uint64_t* survivorMask) {
+        // Segment boundaries stay put; a segment emptied by the cull vanishes.
+        // Rewritten in place: slot `newSegments` is always already consumed.
+        size_t kept = 0;
+        size_t segment = 0;
+        size_t newSegments = 0;
+        size_t openSegment = SIZE_MAX;
+        const QueuedDraw* previous = nullptr;
+        arrivalBinds = 0;
+
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (segment < segmentStarts.size() && segmentStarts[segment] == i) ++segment;
+
+            const uint32_t draw = entries[i].draw;
+            if (!((survivorMask[draw >> 6] >> (draw & 63)) & 1)) continue;
+
+            if (openSegment != segment) {
+                segmentStarts[newSegments++] = static_cast<uint32_t>(kept);
+                openSegment = segment;
+            }
+
+            arrivalBinds += Diff(previous, draws[draw]).Count();
+            previous = &draws[draw];
+            entries[kept++] = entries[i];
+        }
+
+        entries.resize(kept);
+        segmentStarts.resize(newSegments);
+    }
+
+    void RenderQueue::Sort() {
+        for (size_t s = 0; s < segmentStarts.size(); ++s) {
+            const size_t begin = segmentStarts[s];
+            const size_t end = s + 1 < segmentStarts.size() ? segmentStarts[s + 1] : entries.size();
+            if (end - begin > 1) SortRange(begin, end);
+        }
+    }
+
+    void RenderQueue::SortRange(size_t begin, size_t end) {
+        SortEntry* range = entries.data() + begin;
+        const size_t n = end - begin;
+
+        if (n <= kInsertionSortLimit) {
+            for (size_t i = 1; i < n; ++i) {
+                const SortEntry entry = range[i];
+                size_t j = i;
+                for (; j > 0 && range[j - 1].key > entry.key; --j)
+                    range[j] = range[j - 1];
+                range[j] = entry;
+            }
+            return;
+        }
+
+        // LSD radix sort, one histogram pass for all digits
+        std::array<std::array<uint32_t, kBuckets>, kDigitCount> histograms{};
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t key = range[i].key;
+            for (size_t d = 0; d < kDigitCount; ++d)
+                ++histograms[d][(key >> (d * kDigitBits)) & (kBuckets - 1)];
+        }
+
+        if (scratch.size() < n) scratch.resize(n);
+        SortEntry* src = range;
+        SortEntry* dst = scratch.data();
+
+        for (size_t d = 0; d < kDigitCount; ++d) {
+            auto& histogram = histograms[d];
+            const unsigned shift = static_cast<unsigned>(d * kDigitBits);
+
+            // Every key shares this digit: the pass would be a copy
+            if (histogram[(src[0].key >> shift) & (kBuckets - 1)] == n) continue;
+
+            uint32_t offset = 0;
+            for (auto& bucket : histogram) {
+                const uint32_t count = bucket;
+                bucket = offset;
+                offset += count;
+            }
+            for (size_t i = 0; i < n; ++i)
+                dst[histogram[(src[i].key >> shift) & (kBuckets - 1)]++] = src[i];
+            std::swap(src, dst);
+        }
+
+        if (src != range) std::copy(src, src + n, range);
+    }
+
+    RenderQueueStats RenderQueue::Submit(IRenderContext& context) {
+        RenderQueueStats stats;
+        stats.draws = entries.size();
+        stats.segments = segmentStarts.size();
+        stats.arrivalBinds = arrivalBinds;
+
+        const QueuedDraw* bound = nullptr;
+        for (const SortEntry& entry : entries) {
+            const QueuedDraw& draw = draws[entry.draw];
+
+            const BindSet binds = Diff(bound, draw);
+            if (binds.vertexShader) context.SetVertexShader(draw.vertexShader);
+            if (binds.pixelShader) context.SetPixelShader(draw.pixelShader);
+            if (binds.texture) context.SetShaderResource(ShaderStage::Pixel, 0, draw.texture);
+            if (binds.vertexBuffer) context.SetVertexBuffer(0, draw.vertexBuffer, draw.stride, draw.offset);
+
+            stats.submittedBinds += binds.Count();
+            stats.shaderBinds += size_t(binds.vertexShader) + size_t(binds.pixelShader);
+            stats.textureBinds += size_t(binds.texture);
+            stats.vertexBufferBinds += size_t(binds.vertexBuffer);
+            context.Draw(draw.vertexCount, draw.startVertex);
+            bound = &draw;
+        }
+
+        Clear();
+        return stats;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,59 @@
+// ====================================================================
+//                           ResourcePool.cpp
+//     TGDK Quantum GPU Accelerator — Long-Lived Small Resources
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "ResourcePool.hpp"
+#include "Hash.hpp"
+
+#include <cstring>
+
+namespace QUADRAQ {
+
+    ResourcePool::~ResourcePool() {
+        Release();
+    }
+
+    GpuHandle ResourcePool::Acquire(const void* data, uint32_t size, BufferKind kind) {
+        if (!data || size == 0 || size > kMaxResourceBytes) {
+            ++stats.failed;
+            return nullptr;
+        }
+
+        const uint64_t hash = Fnv1a64(data, size, kFnv64Offset ^ static_cast<uint64_t>(kind));
+        auto range = entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            const Entry& entry = it->second;
+            if (entry.kind == kind && entry.bytes.size() == size &&
+                std::memcmp(entry.bytes.data(), data, size) == 0) {
+                ++stats.hits;
+                return entry.buffer;
+            }
+        }
+
+        GpuHandle buffer = device.CreateStaticBuffer(data, size, kind);
+        if (!buffer) {
+            ++stats.failed;
+            return nullptr;
+        }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        entries.emplace(hash, Entry{ buffer, kind, std::vector<uint8_t>(bytes, bytes + size) });
+
+        ++stats.creations;
+        stats.resources = entries.size();
+        stats.bytes += size;
+        return buffer;
+    }
+
+    void ResourcePool::Release() {
+        for (auto& pair : entries)
+            device.ReleaseBuffer(pair.second.buffer);
+
+        entries.clear();
+        stats.resources = 0;
+        stats.bytes = 0;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,67 @@
+// ====================================================================
+//                           RingStats.cpp
+//     TGDK Quantum GPU Accelerator — Sliding-Window Statistics
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "RingStats.hpp"
+
+#include <cmath>
+
+namespace QUADRAQ {
+
+    RingStats::RingStats(size_t capacity) {
+        Resize(capacity);
+    }
+
+    void RingStats::Resize(size_t capacity) {
+        if (capacity == 0) capacity = 1;
+        samples.assign(capacity, 0.0f);
+        Clear();
+    }
+
+    void RingStats::Clear() {
+        head = 0;
+        count = 0;
+        mean = 0.0;
+        m2 = 0.0;
+    }
+
+    void RingStats::Push(float sample) {
+        const double x = sample;
+
+        if (count < samples.size()) {
+            // Window still filling: plain Welford insert
+            ++count;
+            const double delta = x - mean;
+            mean += delta / static_cast<double>(count);
+            m2 += delta * (x - mean);
+        }
+        else {
+            // Window full: replace the oldest sample in one step
+            const double y = samples[head];
+            const double oldMean = mean;
+            mean += (x - y) / static_cast<double>(count);
+            m2 += (x - y) * ((x - mean) + (y - oldMean));
+            if (m2 < 0.0) m2 = 0.0; // rounding can dip just below zero
+        }
+
+        samples[head] = sample;
+        if (++head == samples.size()) head = 0;
+    }
+
+    float RingStats::Variance() const {
+        if (count == 0) return 0.0f;
+        return static_cast<float>(m2 / static_cast<double>(count));
+    }
+
+    float RingStats::StdDev() const {
+        return std::sqrt(Variance());
+    }
+
+    float RingStats::Newest() const {
+        if (count == 0) return 0.0f;
+        return samples[head == 0 ? samples.size() - 1 : head - 1];
+    }
+
+} // namespace QUADRAQ
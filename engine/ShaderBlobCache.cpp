@@ -0,0 +1,261 @@
+// ====================================================================
+//                          ShaderBlobCache.cpp
+//     TGDK Quantum GPU Accelerator — Precompiled Shader Cache
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "ShaderBlobCache.hpp"
+#include "Hash.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace QUADRAQ {
+
+    namespace {
+        void PutLE(uint8_t* bytes, uint64_t value, size_t width) {
+            for (size_t i = 0; i < width; ++i)
+                bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+
+        uint64_t GetLE(const uint8_t* bytes, size_t width) {
+            uint64_t value = 0;
+            for (size_t i = 0; i < width; ++i)
+                value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+            return value;
+        }
+
+        struct Entry {
+            uint64_t sourceHash;
+            uint32_t variant;
+            uint32_t size;
+            uint64_t offset;
+            uint64_t checksum;
+        };
+
+        Entry ReadEntry(const uint8_t* table, size_t index) {
+            const uint8_t* bytes = table + index * ShaderBlobFormat::kEntrySize;
+            Entry entry;
+            entry.sourceHash = GetLE(bytes, 8);
+            entry.variant = static_cast<uint32_t>(GetLE(bytes + 8, 4));
+            entry.size = static_cast<uint32_t>(GetLE(bytes + 12, 4));
+            entry.offset = GetLE(bytes + 16, 8);
+            entry.checksum = GetLE(bytes + 24, 8);
+            return entry;
+        }
+
+        bool KeyLess(uint64_t hashA, uint32_t variantA, uint64_t hashB, uint32_t variantB) {
+            return hashA != hashB ? hashA < hashB : variantA < variantB;
+        }
+    }
+
+    uint64_t ShaderBlobFormat::TargetTag(const std::string& target) {
+        return Fnv1a64(target.data(), target.size());
+    }
+
+    uint64_t HashShaderSource(const void* source, size_t size) {
+        return Fnv1a64(source, size);
+    }
+
+    // ================================================================
+    //                          Reader
+    // ================================================================
+
+    bool ShaderBlobCache::Open(const std::string& path, uint64_t expectedTarget) {
+        Close();
+        error.clear();
+
+        if (!file.Open(path)) return Fail(file.Error());
+
+        const uint8_t* bytes = file.Data();
+        const size_t fileSize = file.Size();
+
+        if (fileSize < ShaderBlobFormat::kHeaderSize) return Fail("truncated header");
+        if (std::memcmp(bytes, ShaderBlobFormat::kMagic, 4) != 0) return Fail("not a QUADRAQ shader cache");
+
+        const uint16_t version = static_cast<uint16_t>(GetLE(bytes + 4, 2));
+        if (version != ShaderBlobFormat::kVersion)
+            return Fail("stale cache: format version " + std::to_string(version));
+
+        const uint64_t entries = GetLE(bytes + 8, 4);
+        const uint64_t fileTarget = GetLE(bytes + 16, 8);
+        const uint64_t tableChecksum = GetLE(bytes + 24, 8);
+
+        if (expectedTarget != 0 && fileTarget != expectedTarget)
+            return Fail("stale cache: built for a different target");
+
+        if (entries > (fileSize - ShaderBlobFormat::kHeaderSize) / ShaderBlobFormat::kEntrySize)
+            return Fail("truncated entry table");
+
+        const uint8_t* entryTable = bytes + ShaderBlobFormat::kHeaderSize;
+        const size_t tableBytes = static_cast<size_t>(entries) * ShaderBlobFormat::kEntrySize;
+        if (Fnv1a64(entryTable, tableBytes) != tableChecksum)
+            return Fail("entry table checksum mismatch");
+
+        // Everything Find() and BlobAt() rely on is checked here once
+        const uint64_t blobsStart = ShaderBlobFormat::kHeaderSize + tableBytes;
+        for (size_t i = 0; i < entries; ++i) {
+            const Entry entry = ReadEntry(entryTable, i);
+
+            if (entry.offset % ShaderBlobFormat::kBlobAlignment != 0 || entry.offset < blobsStart ||
+                entry.offset > fileSize || entry.size > fileSize - entry.offset)
+                return Fail("entry " + std::to_string(i) + " out of bounds");
+
+            if (i != 0) {
+                const Entry previous = ReadEntry(entryTable, i - 1);
+                if (!KeyLess(previous.sourceHash, previous.variant, entry.sourceHash, entry.variant))
+                    return Fail("entry table not sorted");
+            }
+        }
+
+        table = entryTable;
+        count = static_cast<size_t>(entries);
+        target = fileTarget;
+        return true;
+    }
+
+    void ShaderBlobCache::Close() {
+        file.Close();
+        table = nullptr;
+        count = 0;
+        target = 0;
+    }
+
+    bool ShaderBlobCache::Find(const ShaderBlobKey& key, ShaderBlob& blob) const {
+        size_t low = 0;
+        size_t high = count;
+
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            const Entry entry = ReadEntry(table, middle);
+
+            if (KeyLess(entry.sourceHash, entry.variant, key.sourceHash, key.variant))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        if (low == count) return false;
+
+        const Entry entry = ReadEntry(table, low);
+        if (entry.sourceHash != key.sourceHash || entry.variant != key.variant) return false;
+
+        blob = BlobAt(low);
+        return true;
+    }
+
+    ShaderBlobKey ShaderBlobCache::KeyAt(size_t index) const {
+        ShaderBlobKey key;
+        if (index >= count) return key;
+
+        const Entry entry = ReadEntry(table, index);
+        key.sourceHash = entry.sourceHash;
+        key.variant = entry.variant;
+        return key;
+    }
+
+    ShaderBlob ShaderBlobCache::BlobAt(size_t index) const {
+        ShaderBlob blob;
+        if (index >= count) return blob;
+
+        const Entry entry = ReadEntry(table, index);
+        blob.data = file.Data() + entry.offset;
+        blob.size = entry.size;
+        return blob;
+    }
+
+    bool ShaderBlobCache::VerifyBlobs() {
+        for (size_t i = 0; i < count; ++i) {
+            const Entry entry = ReadEntry(table, i);
+            if (Fnv1a64(file.Data() + entry.offset, entry.size) != entry.checksum) {
+                error = "blob " + std::to_string(i) + " checksum mismatch";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ShaderBlobCache::Fail(const std::string& message) {
+        Close();
+        error = message;
+        return false;
+    }
+
+    // ================================================================
+    //                          Writer
+    // ================================================================
+
+    void ShaderBlobCacheWriter::Add(const ShaderBlobKey& key, const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        blobs[{ key.sourceHash, key.variant }].assign(bytes, bytes + size);
+    }
+
+    bool ShaderBlobCacheWriter::Write(const std::string& path, uint64_t targetTag) {
+        error.clear();
+
+        const size_t tableBytes = blobs.size() * ShaderBlobFormat::kEntrySize;
+        size_t fileSize = ShaderBlobFormat::kHeaderSize + tableBytes;
+
+        std::vector<uint64_t> offsets;
+        offsets.reserve(blobs.size());
+        for (const auto& blob : blobs) {
+            if (blob.second.size() > UINT32_MAX) {
+                error = "blob larger than 4 GiB";
+                return false;
+            }
+            fileSize = (fileSize + ShaderBlobFormat::kBlobAlignment - 1) & ~(ShaderBlobFormat::kBlobAlignment - 1);
+            offsets.push_back(fileSize);
+            fileSize += blob.second.size();
+        }
+
+        std::vector<uint8_t> bytes(fileSize, 0);
+        uint8_t* table = bytes.data() + ShaderBlobFormat::kHeaderSize;
+
+        size_t index = 0;
+        for (const auto& blob : blobs) {
+            uint8_t* entry = table + index * ShaderBlobFormat::kEntrySize;
+            PutLE(entry, blob.first.first, 8);
+            PutLE(entry + 8, blob.first.second, 4);
+            PutLE(entry + 12, blob.second.size(), 4);
+            PutLE(entry + 16, offsets[index], 8);
+            PutLE(entry + 24, Fnv1a64(blob.second.data(), blob.second.size()), 8);
+
+            if (!blob.second.empty())
+                std::memcpy(bytes.data() + offsets[index], blob.second.data(), blob.second.size());
+            ++index;
+        }
+
+        std::memcpy(bytes.data(), ShaderBlobFormat::kMagic, 4);
+        PutLE(bytes.data() + 4, ShaderBlobFormat::kVersion, 2);
+        PutLE(bytes.data() + 8, blobs.size(), 4);
+        PutLE(bytes.data() + 16, targetTag, 8);
+        PutLE(bytes.data() + 24, Fnv1a64(table, tableBytes), 8);
+
+        const std::string temporary = path + ".tmp";
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                error = "cannot create " + temporary;
+                return false;
+            }
+            out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!out.flush()) {
+                error = "cannot write " + temporary;
+                std::remove(temporary.c_str());
+                return false;
+            }
+        }
+
+#ifdef _WIN32
+        std::remove(path.c_str());      // rename() does not replace on Windows
+#endif
+        if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+            error = "cannot replace " + path;
+            std::remove(temporary.c_str());
+            return false;
+        }
+        return true;
+    }
+
+} // namespace QUADRAQ
@@ -6,12 +6,23 @@
 
 #include "ShaderOverrideUnit.hpp"
 #include "TGDK_IAIBackend.hpp"
+#include "EntropyPredictor.hpp"
 #include "QUADRAQ.hpp"
+#include "D3D11RenderContext.hpp"
+#include "D3D11QueryDevice.hpp"
+#include "D3D11UploadDevice.hpp"
+#include "ResourcePool.hpp"
+#include "QuantumDrawRouter.hpp"
+#include "ShaderBlobCache.hpp"
+#include "ShaderRegistry.hpp"
+#include "QualityShaderTable.hpp"
+#include "Hash.hpp"
 
 #include <d3d11.h>
 #include <dxgi.h>
 #include <wrl.h>
-#include <vector>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -21,6 +32,13 @@ namespace {
     struct Vertex {
         float position[3];
     };
+
+    // COM reference counting for the override registry
+    class ComHandleOwner : public QUADRAQ::IHandleOwner {
+    public:
+        void Retain(QUADRAQ::GpuHandle handle) override { static_cast<IUnknown*>(handle)->AddRef(); }
+        void Release(QUADRAQ::GpuHandle handle) override { static_cast<IUnknown*>(handle)->Release(); }
+    };
 }
 
 namespace ShaderOverrideUnit {
@@ -29,12 +47,42 @@ namespace ShaderOverrideUnit {
     static ID3D11Device* g_device = nullptr;
     static ID3D11DeviceContext* g_context = nullptr;
     static std::mutex shader_mutex;
-    static std::vector<ID3D11PixelShader*> overriddenShaders;
     static bool hookInitialized = false;
-    static bool overrideEnabled = false;
-    static bool minimalMode = false;
+    static std::atomic<bool> overrideEnabled{ false };
     static std::mutex stateMutex;
 
+    // FrameMonitor's previous reading of the shared bind counters; guarded
+    // by shader_mutex
+    static QUADRAQ::StateCacheCounters lastBindTotals;
+    static uint64_t bindTick = 0;
+
+    // Every override shader is owned here: set 0 holds OverridePixelShader's
+    // replacement, set N the replacements for quality level N (a null
+    // original covers every shader). Guarded by shader_mutex.
+    constexpr uint32_t kDirectOverrides = 0;
+    static ComHandleOwner comOwner;
+    static QUADRAQ::ShaderRegistry shaderRegistry(comOwner);
+
+    // Picks the quality level; read lock-free
+    static QUADRAQ::QualityLadder qualityLadder;
+
+    // What the quality sets bind, resolved per level and read lock-free on
+    // the PS-bind path; holds its own references, so a lookup racing
+    // ClearQualityShaders() stays valid
+    static QUADRAQ::QualityShaderTable qualityShaders(comOwner);
+
+    // Precompiled override shaders, mapped for the lifetime of the unit; guarded by shader_mutex
+    static QUADRAQ::ShaderBlobCache shaderCache;
+
+    // Pipeline-statistics queries recycled across frames; guarded by shader_mutex
+    static std::unique_ptr<QUADRAQ::D3D11QueryDevice> queryDevice;
+    static std::unique_ptr<QUADRAQ::QueryRing> queryRing;
+
+    // Frame-path geometry comes from these instead of CreateBuffer; guarded by shader_mutex
+    static std::unique_ptr<QUADRAQ::D3D11UploadDevice> uploadDevice;
+    static std::unique_ptr<QUADRAQ::UploadRing> uploadRing;
+    static std::unique_ptr<QUADRAQ::ResourcePool> resourcePool;
+
     bool HookPipeline(ID3D11Device* device, ID3D11DeviceContext* context) {
         std::lock_guard<std::mutex> lock(shader_mutex);
 
@@ -52,6 +100,21 @@ namespace ShaderOverrideUnit {
 
         hookInitialized = true;
 
+        uploadDevice = std::make_unique<QUADRAQ::D3D11UploadDevice>(g_device, g_context);
+        if (uploadDevice->IsValid()) {
+            uploadRing = std::make_unique<QUADRAQ::UploadRing>(*uploadDevice);
+            resourcePool = std::make_unique<QUADRAQ::ResourcePool>(*uploadDevice);
+            if (!uploadRing->Initialize() && gAIBackendPtr)
+                gAIBackendPtr->LogError("ShaderOverrideUnit :: Failed to create upload ring.");
+        }
+        else {
+            resourcePool.reset();
+            uploadRing.reset();
+            uploadDevice.reset();
+            if (gAIBackendPtr)
+                gAIBackendPtr->LogError("ShaderOverrideUnit :: Failed to create upload fences.");
+        }
+
         if (gAIBackendPtr)
             gAIBackendPtr->Log("ShaderOverrideUnit :: HookPipeline successful.");
 
@@ -83,8 +146,94 @@ namespace ShaderOverrideUnit {
         return overrideEnabled;
     }
 
-    void ShaderOverrideUnit::ForceMinimal(bool state) {
-        minimalMode = state;
+    void RegisterQualityShader(QUADRAQ::ShaderQuality level, ID3D11PixelShader* original, ID3D11PixelShader* replacement) {
+        std::lock_guard<std::mutex> lock(shader_mutex);
+
+        const uint32_t set = static_cast<uint32_t>(level);
+        if (set == 0 || set >= static_cast<uint32_t>(QUADRAQ::ShaderQuality::Count) || !replacement)
+            return;
+
+        // The registry's canonical shader, so both hold the same object
+        const QUADRAQ::GpuHandle canonical = shaderRegistry.SetOverride(set, original, replacement);
+        qualityShaders.Register(level, original, canonical);
+    }
+
+    void ClearQualityShaders() {
+        std::lock_guard<std::mutex> lock(shader_mutex);
+
+        // Unpublish first: the table's references outlive the registry's
+        qualityShaders.Clear();
+
+        for (uint32_t set = 1; set < static_cast<uint32_t>(QUADRAQ::ShaderQuality::Count); ++set)
+            shaderRegistry.ClearSet(set);
+    }
+
+    ID3D11PixelShader* ResolvePixelShader(ID3D11PixelShader* original) {
+        const QUADRAQ::ShaderQuality quality = qualityLadder.Level();
+        if (quality == QUADRAQ::ShaderQuality::Full || !overrideEnabled.load(std::memory_order_relaxed)) {
+            if (original) original->AddRef();
+            return original;
+        }
+
+        return static_cast<ID3D11PixelShader*>(qualityShaders.Resolve(quality, original));
+    }
+
+    bool LoadShaderCache(const std::string& path) {
+        std::lock_guard<std::mutex> lock(shader_mutex);
+
+        const uint64_t target = QUADRAQ::ShaderBlobFormat::TargetTag(QUADRAQ::ShaderBlobFormat::kDefaultTarget);
+        if (!shaderCache.Open(path, target)) {
+            if (gAIBackendPtr)
+                gAIBackendPtr->LogError("ShaderOverrideUnit :: Shader cache " + path + " unusable: " + shaderCache.Error());
+            return false;
+        }
+
+        if (gAIBackendPtr)
+            gAIBackendPtr->Log("ShaderOverrideUnit :: Mapped " + std::to_string(shaderCache.Count()) + " cached shaders.");
+        return true;
+    }
+
+    ID3D11PixelShader* CreateCachedPixelShader(uint64_t sourceHash, uint32_t variant) {
+        std::lock_guard<std::mutex> lock(shader_mutex);
+
+        // Hand out the shader already made from this blob, if any
+        const uint64_t contentHash = QUADRAQ::Fnv1a64(&variant, sizeof(variant), sourceHash);
+        if (QUADRAQ::GpuHandle existing = shaderRegistry.FindByContent(contentHash)) {
+            ID3D11PixelShader* shader = static_cast<ID3D11PixelShader*>(existing);
+            shader->AddRef();
+            return shader;
+        }
+
+        QUADRAQ::ShaderBlob blob;
+        if (!g_device || !shaderCache.Find({ sourceHash, variant }, blob))
+            return nullptr;
+
+        // Bytecode goes to the driver straight from the mapping; the
+        // runtime validates its DXBC checksum on creation
+        ID3D11PixelShader* shader = nullptr;
+        if (FAILED(g_device->CreatePixelShader(blob.data, blob.size, nullptr, &shader))) {
+            if (gAIBackendPtr)
+                gAIBackendPtr->LogError("ShaderOverrideUnit :: Cached shader rejected by the device.");
+            return nullptr;
+        }
+
+        // Interned so the next request for this blob is answered from the
+        // registry; released by ClearOverrides() if never used as an override
+        shaderRegistry.Intern(shader, contentHash, blob.size);
+        return shader;
+    }
+
+    QUADRAQ::ShaderQuality GetShaderQuality() {
+        return qualityLadder.Level();
+    }
+
+    void SetQualityCap(QUADRAQ::ShaderQuality cap) {
+        qualityLadder.SetCap(cap);
+    }
+
+    void SetQualityPolicy(const QUADRAQ::QualityLadderPolicy& policy) {
+        std::lock_guard<std::mutex> lock(shader_mutex);
+        qualityLadder.SetPolicy(policy);
     }
 
     void OverridePixelShader(ID3D11PixelShader* newShader) {
@@ -93,8 +242,14 @@ namespace ShaderOverrideUnit {
         if (!g_context || !newShader)
             return;
 
-        g_context->PSSetShader(newShader, nullptr, 0);
-        overriddenShaders.push_back(newShader);
+        // The registry keeps one reference per distinct shader, so repeated
+        // overrides no longer pile up; the caller's reference is adopted.
+        // Below Full the ladder's replacement is bound instead
+        QUADRAQ::GpuHandle shader = shaderRegistry.SetOverride(kDirectOverrides, nullptr, newShader);
+        ID3D11PixelShader* bound = ResolvePixelShader(static_cast<ID3D11PixelShader*>(shader));
+        g_context->PSSetShader(bound, nullptr, 0);
+        if (bound) bound->Release();
+        newShader->Release();
 
         if (gAIBackendPtr)
             gAIBackendPtr->Log("ShaderOverrideUnit :: Custom pixel shader applied.");
@@ -103,47 +258,63 @@ namespace ShaderOverrideUnit {
     void ClearOverrides() {
         std::lock_guard<std::mutex> lock(shader_mutex);
 
-        for (auto shader : overriddenShaders) {
-            if (shader) shader->Release();
-        }
+        shaderRegistry.ClearSet(kDirectOverrides);
+        shaderRegistry.Trim();
 
-        overriddenShaders.clear();
+        if (gAIBackendPtr) {
+            const QUADRAQ::ShaderRegistryStats stats = shaderRegistry.Stats();
+            gAIBackendPtr->Log("ShaderOverrideUnit :: Cleared all shader overrides (" +
+                std::to_string(stats.shaders) + " shaders, " +
+                std::to_string(stats.bytecodeBytes + stats.tableBytes) + " bytes still held).");
+        }
+    }
 
-        if (gAIBackendPtr)
-            gAIBackendPtr->Log("ShaderOverrideUnit :: Cleared all shader overrides.");
+    QUADRAQ::ShaderRegistryStats GetRegistryStats() {
+        std::lock_guard<std::mutex> lock(shader_mutex);
+        return shaderRegistry.Stats();
     }
 
     // --- Moved out: Dummy draw to stimulate pipeline ---
     void IssueDummyDraw() {
-        if (!g_device || !g_context) return;
+        if (!g_device || !g_context || !resourcePool) return;
 
-        Vertex vertices[] = {
+        static const Vertex vertices[] = {
             { { -0.5f, -0.5f, 0.0f } },
             { {  0.5f, -0.5f, 0.0f } },
             { {  0.0f,  0.5f, 0.0f } }
         };
 
-        D3D11_BUFFER_DESC bufferDesc = {};
-        bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-        bufferDesc.ByteWidth = sizeof(vertices);
-        bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-
-        D3D11_SUBRESOURCE_DATA initData = {};
-        initData.pSysMem = vertices;
-
-        ComPtr<ID3D11Buffer> vertexBuffer;
-        HRESULT hr = g_device->CreateBuffer(&bufferDesc, &initData, vertexBuffer.GetAddressOf());
-        if (FAILED(hr)) {
+        // Created on the first tick only, the pool hands back the same buffer after that
+        QUADRAQ::GpuHandle vertexBuffer = resourcePool->Acquire(vertices, sizeof(vertices), QUADRAQ::BufferKind::Geometry);
+        if (!vertexBuffer) {
             if (gAIBackendPtr)
                 gAIBackendPtr->LogError("ShaderOverrideUnit :: Failed to create dummy vertex buffer.");
             return;
         }
 
-        UINT stride = sizeof(Vertex);
-        UINT offset = 0;
-        g_context->IASetVertexBuffers(0, 1, vertexBuffer.GetAddressOf(), &stride, &offset);
-        g_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        g_context->Draw(3, 0);
+        QUADRAQ::StateCacheScope scope(g_context);
+        QUADRAQ::StateCache& cache = scope.Cache();
+        cache.SetVertexBuffer(0, vertexBuffer, sizeof(Vertex), 0);
+        cache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        cache.Draw(3, 0);
+    }
+
+    bool DrawTransient(const void* vertices, uint32_t stride, uint32_t vertexCount) {
+        std::lock_guard<std::mutex> lock(shader_mutex);
+
+        if (!g_context || !uploadRing || !vertices || stride == 0 || vertexCount == 0)
+            return false;
+
+        const QUADRAQ::UploadAllocation allocation = uploadRing->Upload(vertices, stride * vertexCount);
+        if (!allocation)
+            return false;
+
+        QUADRAQ::StateCacheScope scope(g_context);
+        QUADRAQ::StateCache& cache = scope.Cache();
+        cache.SetVertexBuffer(0, allocation.buffer, stride, allocation.offset);
+        cache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        cache.Draw(vertexCount, 0);
+        return true;
     }
 
     void FrameMonitor() {
@@ -152,41 +323,72 @@ namespace ShaderOverrideUnit {
         if (!g_context || !hookInitialized)
             return;
 
-        ComPtr<ID3D11Query> pipelineQuery;
-        D3D11_QUERY_DESC queryDesc = {};
-        queryDesc.Query = D3D11_QUERY_PIPELINE_STATISTICS;
+        // Bind counters since the last tick; the totals are only written by
+        // the submitting threads, so nothing is reset from here
+        const QUADRAQ::StateCacheCounters totals = QUADRAQ::StateCacheTotals();
+        QUADRAQ::StateCacheCounters binds;
+        binds.frameIndex = ++bindTick;
+        binds.issued = totals.issued - lastBindTotals.issued;
+        binds.elided = totals.elided - lastBindTotals.elided;
+        lastBindTotals = totals;
+
+        // Fence the previous tick's uploads and reclaim whatever the GPU has finished
+        if (uploadRing) uploadRing->EndFrame();
+
+        // Step the quality ladder on predicted load against the router's frame budget
+        const float frameBudget = QuantumDrawRouter::GetFramePolicy().frameBudget;
+        const uint32_t horizon = EntropyPredictor::GetOverloadPolicy().horizonFrames;
+        const float load = frameBudget > 0.0f ? EntropyPredictor::PredictNextFrameTime(horizon) / frameBudget : 0.0f;
+        if (qualityLadder.Update(load) && gAIBackendPtr) {
+            gAIBackendPtr->Log(std::string("ShaderOverrideUnit :: Shader quality -> ") +
+                QUADRAQ::ShaderQualityName(qualityLadder.Level()));
+        }
 
-        HRESULT hr = g_device->CreateQuery(&queryDesc, pipelineQuery.GetAddressOf());
-        if (FAILED(hr)) {
+        if (!queryRing) {
+            queryDevice = std::make_unique<QUADRAQ::D3D11QueryDevice>(g_device, g_context);
+            queryRing = std::make_unique<QUADRAQ::QueryRing>(*queryDevice);
+        }
+        if (!queryRing->IsInitialized() && !queryRing->Initialize()) {
             if (gAIBackendPtr)
-                gAIBackendPtr->LogError("ShaderOverrideUnit :: Failed to create pipeline query.");
+                gAIBackendPtr->LogError("ShaderOverrideUnit :: Failed to create pipeline queries.");
             return;
         }
 
-        g_context->Begin(pipelineQuery.Get());
+        // Each tick closes the query opened on the previous one and opens
+        // the next, so a result counts everything drawn on the context in
+        // between (the game's work, not just the dummy draw). Whichever
+        // earlier one the GPU has finished is read back; never wait on it.
+        // A full ring leaves the interval unmeasured.
+        queryRing->End();
+        queryRing->Begin();
         IssueDummyDraw();
-        g_context->End(pipelineQuery.Get());
 
-        while (g_context->GetData(pipelineQuery.Get(), nullptr, 0, 0) == S_FALSE) {
-            // Spin until query is ready
-        }
+        const uint64_t failedBefore = queryRing->Stats().failed;
+        QUADRAQ::PipelineStatistics stats;
+        if (queryRing->Collect(stats)) {
+            uint64_t vsInvocations = stats.vsInvocations;
+            uint64_t psInvocations = stats.psInvocations;
+            uint64_t rasterPrimitives = stats.rasterPrimitives;
 
-        D3D11_QUERY_DATA_PIPELINE_STATISTICS stats = {};
-        if (SUCCEEDED(g_context->GetData(pipelineQuery.Get(), &stats, sizeof(stats), 0))) {
-            uint64_t vsInvocations = stats.VSInvocations;
-            uint64_t psInvocations = stats.PSInvocations;
-            uint64_t rasterPrimitives = stats.CInvocations;
+            // Feed the game's GPU workload per tick into stall prediction
+            EntropyPredictor::PushChannelSample(EntropyPredictor::Channels::VSInvocations, static_cast<float>(vsInvocations));
+            EntropyPredictor::PushChannelSample(EntropyPredictor::Channels::PSInvocations, static_cast<float>(psInvocations));
+            EntropyPredictor::PushChannelSample(EntropyPredictor::Channels::RasterPrimitives, static_cast<float>(rasterPrimitives));
 
             std::string report =
                 "[ShaderOverrideUnit] FrameMonitor :: " +
                 std::to_string(vsInvocations) + " VS | " +
                 std::to_string(psInvocations) + " PS | " +
-                std::to_string(rasterPrimitives) + " Raster";
+                std::to_string(rasterPrimitives) + " Raster | " +
+                std::to_string(binds.issued) + " binds issued, " +
+                std::to_string(binds.elided) + " elided | " +
+                std::to_string(queryRing->Stats().latency) + " frames behind | " +
+                std::to_string(uploadRing ? uploadRing->Stats().bytesInFlight : 0) + " upload bytes in flight";
 
             if (gAIBackendPtr)
                 gAIBackendPtr->Log(report);
         }
-        else {
+        if (queryRing->Stats().failed != failedBefore) {
             if (gAIBackendPtr)
                 gAIBackendPtr->LogError("ShaderOverrideUnit :: Failed to retrieve pipeline statistics.");
         }
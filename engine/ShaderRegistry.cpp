@@ -0,0 +1,162 @@
+// ====================================================================
+//                          ShaderRegistry.cpp
+//     TGDK Quantum GPU Accelerator — Shader Override Registry
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "ShaderRegistry.hpp"
+
+#include <vector>
+
+namespace QUADRAQ {
+
+    namespace {
+        // Node-based maps: bucket array plus one allocation per element
+        // holding the value, the chain link and the cached hash
+        template <typename Map>
+        size_t MapFootprint(const Map& map) {
+            return map.bucket_count() * sizeof(void*) +
+                map.size() * (sizeof(typename Map::value_type) + sizeof(void*) + sizeof(size_t));
+        }
+    }
+
+    ShaderRegistry::~ShaderRegistry() {
+        Clear();
+    }
+
+    GpuHandle ShaderRegistry::Intern(GpuHandle shader, uint64_t contentHash, size_t bytecodeSize) {
+        if (!shader) return nullptr;
+
+        const auto known = shaders.find(shader);
+        if (known != shaders.end()) {
+            // Learn the content hash late so later interns can match it
+            if (contentHash != 0 && known->second.contentHash == 0 && byContent.emplace(contentHash, shader).second)
+                known->second.contentHash = contentHash;
+            return shader;
+        }
+
+        if (contentHash != 0) {
+            const auto same = byContent.find(contentHash);
+            if (same != byContent.end()) {
+                ++deduplicated;
+                return same->second;
+            }
+        }
+
+        owner.Retain(shader);
+        shaders.emplace(shader, Record{ contentHash, bytecodeSize, 0 });
+        if (contentHash != 0) byContent.emplace(contentHash, shader);
+
+        bytecodeBytes += bytecodeSize;
+        ++interned;
+        return shader;
+    }
+
+    GpuHandle ShaderRegistry::FindByContent(uint64_t contentHash) const {
+        const auto it = byContent.find(contentHash);
+        return it == byContent.end() ? nullptr : it->second;
+    }
+
+    GpuHandle ShaderRegistry::SetOverride(uint32_t set, GpuHandle original, GpuHandle replacement,
+                                          uint64_t contentHash, size_t bytecodeSize) {
+        const GpuHandle canonical = Intern(replacement, contentHash, bytecodeSize);
+        if (!canonical) {
+            RemoveOverride(set, original);
+            return nullptr;
+        }
+
+        GpuHandle& slot = overrides[OverrideKey{ set, original }];
+        if (slot == canonical) return canonical;
+
+        // Take the new use before dropping the old one so a shared shader
+        // never dips to zero in between
+        ++shaders[canonical].uses;
+        const GpuHandle previous = slot;
+        slot = canonical;
+        if (previous) Unuse(previous);
+        return canonical;
+    }
+
+    bool ShaderRegistry::RemoveOverride(uint32_t set, GpuHandle original) {
+        const auto it = overrides.find(OverrideKey{ set, original });
+        if (it == overrides.end()) return false;
+
+        const GpuHandle replacement = it->second;
+        overrides.erase(it);
+        Unuse(replacement);
+        return true;
+    }
+
+    void ShaderRegistry::ClearSet(uint32_t set) {
+        std::vector<GpuHandle> dropped;
+        for (auto it = overrides.begin(); it != overrides.end();) {
+            if (it->first.set == set) {
+                dropped.push_back(it->second);
+                it = overrides.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        for (GpuHandle shader : dropped)
+            Unuse(shader);
+    }
+
+    size_t ShaderRegistry::Trim() {
+        std::vector<GpuHandle> unused;
+        for (const auto& entry : shaders) {
+            if (entry.second.uses == 0) unused.push_back(entry.first);
+        }
+
+        for (GpuHandle shader : unused)
+            Forget(shader);
+        return unused.size();
+    }
+
+    void ShaderRegistry::Clear() {
+        overrides.clear();
+
+        std::vector<GpuHandle> all;
+        all.reserve(shaders.size());
+        for (const auto& entry : shaders)
+            all.push_back(entry.first);
+
+        for (GpuHandle shader : all)
+            Forget(shader);
+    }
+
+    ShaderRegistryStats ShaderRegistry::Stats() const {
+        ShaderRegistryStats stats;
+        stats.shaders = shaders.size();
+        stats.overrides = overrides.size();
+        stats.bytecodeBytes = bytecodeBytes;
+        stats.tableBytes = MapFootprint(shaders) + MapFootprint(byContent) + MapFootprint(overrides);
+        stats.interned = interned;
+        stats.deduplicated = deduplicated;
+        stats.released = released;
+        return stats;
+    }
+
+    void ShaderRegistry::Unuse(GpuHandle shader) {
+        const auto it = shaders.find(shader);
+        if (it != shaders.end() && --it->second.uses == 0)
+            Forget(shader);
+    }
+
+    void ShaderRegistry::Forget(GpuHandle shader) {
+        const auto it = shaders.find(shader);
+        if (it == shaders.end()) return;
+
+        if (it->second.contentHash != 0) {
+            const auto content = byContent.find(it->second.contentHash);
+            if (content != byContent.end() && content->second == shader) byContent.erase(content);
+        }
+
+        bytecodeBytes -= it->second.bytecodeSize;
+        shaders.erase(it);
+        owner.Release(shader);
+        ++released;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,92 @@
+// ====================================================================
+//                       SignalChannelBank.cpp
+//     TGDK Quantum GPU Accelerator — Multi-Channel Signal Fusion
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "SignalChannelBank.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace QUADRAQ {
+
+    SignalChannelBank::SignalChannelBank(size_t windowFrames, uint32_t staleFrames)
+        : staleFrames(staleFrames) {
+        for (auto& channel : stats) channel.Resize(windowFrames);
+    }
+
+    uint32_t SignalChannelBank::Register(const char* name, float weight) {
+        if (!name || !*name) return kInvalid;
+
+        const uint32_t existing = Find(name);
+        if (existing != kInvalid) return existing;
+        if (channelCount == kMaxChannels) return kInvalid;
+
+        const size_t id = channelCount++;
+        std::strncpy(names[id].data(), name, kMaxNameLength);
+        names[id][kMaxNameLength] = '\0';
+        weights[id] = std::max(weight, 0.0f);
+        return static_cast<uint32_t>(id);
+    }
+
+    uint32_t SignalChannelBank::Find(const char* name) const {
+        if (!name) return kInvalid;
+        for (size_t i = 0; i < channelCount; ++i) {
+            if (std::strncmp(names[i].data(), name, kMaxNameLength) == 0)
+                return static_cast<uint32_t>(i);
+        }
+        return kInvalid;
+    }
+
+    void SignalChannelBank::Push(uint32_t id, float value) {
+        if (id >= channelCount) return;
+
+        // Score against the window as it was before this sample arrived
+        RingStats& window = stats[id];
+        const bool scoredNow = window.Count() >= kMinSamplesForScore;
+        float z = 0.0f;
+        if (scoredNow) {
+            const float stdDev = window.StdDev();
+            const float floor = std::max(1e-6f, window.Mean() * 1e-3f);
+            z = (value - window.Mean()) / std::max(stdDev, floor);
+        }
+        window.Push(value);
+
+        contributions[id] = weights[id] * std::max(z, 0.0f);
+        pushedFrame[id] = frame;
+        scored[id] = scoredNow;
+        lastValues[id] = value;
+        zScores[id] = z;
+    }
+
+    void SignalChannelBank::Clear() {
+        for (size_t i = 0; i < channelCount; ++i) {
+            stats[i].Clear();
+            lastValues[i] = 0.0f;
+            zScores[i] = 0.0f;
+            contributions[i] = 0.0f;
+            pushedFrame[i] = 0;
+            scored[i] = false;
+        }
+        frame = 0;
+    }
+
+    bool SignalChannelBank::IsLive(uint32_t id) const {
+        return id < channelCount && scored[id] && frame - pushedFrame[id] <= staleFrames;
+    }
+
+    float SignalChannelBank::FusedScore() const {
+        double contributionSum = 0.0;
+        double weightSum = 0.0;
+        for (uint32_t i = 0; i < channelCount; ++i) {
+            if (!IsLive(i)) continue;
+            contributionSum += contributions[i];
+            weightSum += weights[i];
+        }
+
+        if (weightSum <= 0.0) return 0.0f;
+        return static_cast<float>(contributionSum / weightSum);
+    }
+
+} // namespace QUADRAQ
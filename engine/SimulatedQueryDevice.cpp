@@ -0,0 +1,65 @@
+// ====================================================================
+//                       SimulatedQueryDevice.cpp
+//     TGDK Quantum GPU Accelerator — Headless Query Device
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "SimulatedQueryDevice.hpp"
+
+namespace QUADRAQ {
+
+    // Handles are 1-based indices into `queries`, so nullptr stays invalid.
+    GpuHandle SimulatedQueryDevice::CreatePipelineQuery() {
+        if (failCreate) return nullptr;
+
+        queries.push_back(Query{});
+        queries.back().live = true;
+        ++created;
+        return reinterpret_cast<GpuHandle>(static_cast<uintptr_t>(queries.size()));
+    }
+
+    void SimulatedQueryDevice::ReleaseQuery(GpuHandle query) {
+        if (Query* entry = Lookup(query)) entry->live = false;
+    }
+
+    void SimulatedQueryDevice::Begin(GpuHandle query) {
+        if (Query* entry = Lookup(query)) entry->ended = false;
+    }
+
+    void SimulatedQueryDevice::End(GpuHandle query) {
+        Query* entry = Lookup(query);
+        if (!entry) return;
+
+        entry->ended = true;
+        entry->endFrame = frame;
+        entry->result = result;
+    }
+
+    QueryPoll SimulatedQueryDevice::Poll(GpuHandle query, PipelineStatistics& stats) {
+        ++polls;
+
+        const Query* entry = Lookup(query);
+        if (!entry || !entry->ended) return QueryPoll::Failed;
+        if (frame - entry->endFrame < latency) return QueryPoll::Pending;
+
+        stats = entry->result;
+        return QueryPoll::Ready;
+    }
+
+    size_t SimulatedQueryDevice::LiveQueries() const {
+        size_t live = 0;
+        for (const Query& query : queries) {
+            if (query.live) ++live;
+        }
+        return live;
+    }
+
+    SimulatedQueryDevice::Query* SimulatedQueryDevice::Lookup(GpuHandle query) {
+        const uintptr_t index = reinterpret_cast<uintptr_t>(query);
+        if (index == 0 || index > queries.size()) return nullptr;
+
+        Query& entry = queries[index - 1];
+        return entry.live ? &entry : nullptr;
+    }
+
+} // namespace QUADRAQ
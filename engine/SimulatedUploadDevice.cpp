@@ -0,0 +1,93 @@
+// ====================================================================
+//                       SimulatedUploadDevice.cpp
+//     TGDK Quantum GPU Accelerator — Headless Upload Device
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "SimulatedUploadDevice.hpp"
+
+#include <cstring>
+
+namespace QUADRAQ {
+
+    GpuHandle SimulatedUploadDevice::CreateDynamicBuffer(uint32_t byteSize, BufferKind) {
+        return Create(byteSize, true);
+    }
+
+    GpuHandle SimulatedUploadDevice::CreateStaticBuffer(const void* data, uint32_t byteSize, BufferKind) {
+        GpuHandle handle = Create(byteSize, false);
+        if (handle && data) std::memcpy(Lookup(handle)->bytes.data(), data, byteSize);
+        return handle;
+    }
+
+    void SimulatedUploadDevice::ReleaseBuffer(GpuHandle buffer) {
+        if (Buffer* entry = Lookup(buffer)) {
+            entry->live = false;
+            entry->bytes.clear();
+        }
+    }
+
+    void* SimulatedUploadDevice::Map(GpuHandle buffer, MapMode mode) {
+        Buffer* entry = Lookup(buffer);
+        if (!entry || !entry->dynamic || entry->mapped) return nullptr;
+
+        ++maps[static_cast<size_t>(mode)];
+        entry->mapped = true;
+        return entry->bytes.data();
+    }
+
+    void SimulatedUploadDevice::Unmap(GpuHandle buffer) {
+        if (Buffer* entry = Lookup(buffer)) entry->mapped = false;
+    }
+
+    uint64_t SimulatedUploadDevice::SignalFence() {
+        fenceFrames.push_back(frame);
+        return fenceFrames.size();
+    }
+
+    uint64_t SimulatedUploadDevice::CompletedFence() {
+        while (completed < fenceFrames.size() && frame - fenceFrames[completed] >= latency)
+            ++completed;
+        return completed;
+    }
+
+    const uint8_t* SimulatedUploadDevice::Contents(GpuHandle buffer) const {
+        const Buffer* entry = Lookup(buffer);
+        return entry ? entry->bytes.data() : nullptr;
+    }
+
+    size_t SimulatedUploadDevice::LiveBuffers() const {
+        size_t live = 0;
+        for (const Buffer& buffer : buffers) {
+            if (buffer.live) ++live;
+        }
+        return live;
+    }
+
+    // Handles are 1-based indices into `buffers`, so nullptr stays invalid.
+    GpuHandle SimulatedUploadDevice::Create(uint32_t byteSize, bool dynamic) {
+        if (failCreate || byteSize == 0) return nullptr;
+
+        Buffer buffer;
+        buffer.live = true;
+        buffer.dynamic = dynamic;
+        buffer.bytes.resize(byteSize);
+        buffers.push_back(std::move(buffer));
+
+        ++created;
+        return reinterpret_cast<GpuHandle>(static_cast<uintptr_t>(buffers.size()));
+    }
+
+    SimulatedUploadDevice::Buffer* SimulatedUploadDevice::Lookup(GpuHandle buffer) {
+        return const_cast<Buffer*>(static_cast<const SimulatedUploadDevice*>(this)->Lookup(buffer));
+    }
+
+    const SimulatedUploadDevice::Buffer* SimulatedUploadDevice::Lookup(GpuHandle buffer) const {
+        const uintptr_t index = reinterpret_cast<uintptr_t>(buffer);
+        if (index == 0 || index > buffers.size()) return nullptr;
+
+        const Buffer& entry = buffers[index - 1];
+        return entry.live ? &entry : nullptr;
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,86 @@
+// ====================================================================
+//                            StateCache.cpp
+//     TGDK Quantum GPU Accelerator — Redundant Bind Elimination
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "StateCache.hpp"
+
+namespace QUADRAQ {
+
+    StateCache::StateCache(IRenderContext* target) : target(target) {}
+
+    void StateCache::SetTarget(IRenderContext* newTarget) {
+        target = newTarget;
+        Invalidate();
+    }
+
+    void StateCache::Invalidate() {
+        for (auto& binding : vertexBuffers) binding.valid = false;
+        for (auto& stage : shaderResources)
+            for (auto& binding : stage) binding.valid = false;
+        vertexShader.valid = false;
+        pixelShader.valid = false;
+        topology.valid = false;
+    }
+
+    void StateCache::BeginFrame() {
+        lastFrame.Store(current);
+
+        const uint64_t next = current.frameIndex + 1;
+        current = StateCacheCounters{};
+        current.frameIndex = next;
+        Invalidate();
+    }
+
+    bool StateCache::Update(Binding& binding, GpuHandle handle, uint32_t a, uint32_t b) {
+        if (binding.valid && binding.handle == handle && binding.a == a && binding.b == b) {
+            ++current.elided;
+            return false;
+        }
+
+        binding.handle = handle;
+        binding.a = a;
+        binding.b = b;
+        binding.valid = true;
+        ++current.issued;
+        return true;
+    }
+
+    void StateCache::SetVertexBuffer(uint32_t slot, GpuHandle buffer, uint32_t stride, uint32_t offset) {
+        if (slot < kVertexBufferSlots) {
+            if (!Update(vertexBuffers[slot], buffer, stride, offset)) return;
+        }
+        else {
+            ++current.issued;
+        }
+        if (target) target->SetVertexBuffer(slot, buffer, stride, offset);
+    }
+
+    void StateCache::SetVertexShader(GpuHandle shader) {
+        if (Update(vertexShader, shader) && target) target->SetVertexShader(shader);
+    }
+
+    void StateCache::SetPixelShader(GpuHandle shader) {
+        if (Update(pixelShader, shader) && target) target->SetPixelShader(shader);
+    }
+
+    void StateCache::SetShaderResource(ShaderStage stage, uint32_t slot, GpuHandle view) {
+        if (slot < kShaderResourceSlots) {
+            if (!Update(shaderResources[static_cast<size_t>(stage)][slot], view)) return;
+        }
+        else {
+            ++current.issued;
+        }
+        if (target) target->SetShaderResource(stage, slot, view);
+    }
+
+    void StateCache::SetPrimitiveTopology(uint32_t value) {
+        if (Update(topology, nullptr, value) && target) target->SetPrimitiveTopology(value);
+    }
+
+    void StateCache::Draw(uint32_t vertexCount, uint32_t startVertex) {
+        if (target) target->Draw(vertexCount, startVertex);
+    }
+
+} // namespace QUADRAQ
@@ -7,8 +7,11 @@
 #include "TGDK_IAIBackend.hpp"
 #include <iostream>
 #include <memory>
+
+#ifdef _WIN32
 #include <windows.h>
 #include "QUADRAQ.hpp"
+#endif
 
 #ifdef TGDK_USE_OLIVIA
 #include "OliviaAI.hpp"
@@ -90,6 +93,8 @@ public:
 // ====================================================================
 
 static bool usingOlivia = false;
+
+#ifdef _WIN32
 static HMODULE g_aiDllHandle = nullptr;
 
 typedef IAIBackend* (*CreateAIBackendFunc)();
@@ -112,6 +117,7 @@ bool LoadAIBackendDLL(const std::string& dllPath) {
     SetAIBackend(std::unique_ptr<IAIBackend>(createFunc()));
     return gAIBackendPtr != nullptr;
 }
+#endif
 
 // ====================================================================
 //                     Core Routing / Identity
@@ -0,0 +1,133 @@
+// ====================================================================
+//                            UploadRing.cpp
+//     TGDK Quantum GPU Accelerator — Frame-Scoped Upload Allocator
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "UploadRing.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace QUADRAQ {
+
+    namespace {
+        // Capacity is kept a multiple of this so wrapping preserves alignment
+        constexpr uint32_t kMaxAlignment = 256;
+    }
+
+    UploadRing::UploadRing(IUploadDevice& device, uint32_t capacity)
+        : device(device),
+          capacity(std::max((capacity + kMaxAlignment - 1) / kMaxAlignment, 1u) * kMaxAlignment) {
+        stats.capacity = this->capacity;
+    }
+
+    UploadRing::~UploadRing() {
+        Release();
+    }
+
+    bool UploadRing::Initialize() {
+        if (buffer) return true;
+
+        buffer = device.CreateDynamicBuffer(capacity, BufferKind::Geometry);
+        return buffer != nullptr;
+    }
+
+    void UploadRing::Release() {
+        if (buffer) device.ReleaseBuffer(buffer);
+
+        buffer = nullptr;
+        mappedOnce = false;
+        head = tail = frameStart = 0;
+        frameFirst = frameCount = 0;
+        stats.bytesInFlight = 0;
+        stats.framesInFlight = 0;
+    }
+
+    UploadAllocation UploadRing::Upload(const void* data, uint32_t size, uint32_t alignment) {
+        if (!buffer || size == 0) return {};
+
+        if (size > capacity || alignment == 0 || alignment > kMaxAlignment || (alignment & (alignment - 1)) != 0) {
+            ++stats.failed;
+            return {};
+        }
+
+        Reclaim();
+
+        uint64_t position = (head + alignment - 1) & ~static_cast<uint64_t>(alignment - 1);
+        uint32_t offset = static_cast<uint32_t>(position % capacity);
+        bool wrapped = false;
+        if (offset + size > capacity) {
+            // Allocations never straddle the end; skip to the start of the next lap
+            position += capacity - offset;
+            offset = 0;
+            wrapped = true;
+        }
+
+        if (position + size - tail > capacity) {
+            ++stats.failed;
+            return {};
+        }
+
+        // The first map hands the driver a fresh buffer; after that the
+        // fences guarantee nothing the GPU still reads gets overwritten.
+        void* mapped = device.Map(buffer, mappedOnce ? MapMode::NoOverwrite : MapMode::Discard);
+        if (!mapped) {
+            ++stats.failed;
+            return {};
+        }
+        std::memcpy(static_cast<uint8_t*>(mapped) + offset, data, size);
+        device.Unmap(buffer);
+        mappedOnce = true;
+
+        head = position + size;
+        if (wrapped) ++stats.wraps;
+        ++stats.allocations;
+        stats.bytesAllocated += size;
+        stats.bytesInFlight = static_cast<uint32_t>(head - tail);
+        stats.peakBytesInFlight = std::max(stats.peakBytesInFlight, stats.bytesInFlight);
+
+        UploadAllocation allocation;
+        allocation.buffer = buffer;
+        allocation.offset = offset;
+        allocation.size = size;
+        return allocation;
+    }
+
+    void UploadRing::EndFrame() {
+        if (!buffer) return;
+
+        if (head != frameStart) {
+            const FrameMark mark = { device.SignalFence(), head };
+
+            if (frameCount == kMaxFramesInFlight) {
+                // Out of marks: fold this frame into the newest one. Its
+                // space is then held until the later fence, which is safe.
+                frames[(frameFirst + frameCount - 1) % kMaxFramesInFlight] = mark;
+            }
+            else {
+                frames[(frameFirst + frameCount) % kMaxFramesInFlight] = mark;
+                ++frameCount;
+            }
+            frameStart = head;
+        }
+
+        Reclaim();
+    }
+
+    void UploadRing::Reclaim() {
+        if (frameCount != 0) {
+            const uint64_t completed = device.CompletedFence();
+
+            while (frameCount != 0 && frames[frameFirst].fence <= completed) {
+                tail = frames[frameFirst].end;
+                frameFirst = (frameFirst + 1) % kMaxFramesInFlight;
+                --frameCount;
+            }
+        }
+
+        stats.framesInFlight = frameCount;
+        stats.bytesInFlight = static_cast<uint32_t>(head - tail);
+    }
+
+} // namespace QUADRAQ
@@ -0,0 +1,161 @@
+// ====================================================================
+//                           VerdictCache.cpp
+//     TGDK Quantum GPU Accelerator — Per-Resource Override Verdicts
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "VerdictCache.hpp"
+#include "Hash.hpp"
+
+namespace QUADRAQ {
+
+    VerdictCache::Table::Table(size_t capacity, uint64_t version)
+        : version(version), mask(capacity - 1), slots(new Slot[capacity]) {}
+
+    VerdictCache::VerdictCache(size_t requested, EpochDomain& domain)
+        : capacity([requested] {
+              size_t size = 16;
+              while (size < requested) size <<= 1;
+              return size;
+          }()),
+          domain(domain),
+          anchor(std::make_shared<Anchor>()) {
+        anchor->cache = this;
+    }
+
+    VerdictCache::~VerdictCache() {
+        {
+            // Hooks fired from here on find no cache
+            std::lock_guard<std::mutex> lock(anchor->mutex);
+            anchor->cache = nullptr;
+        }
+
+        // No reader may use a cache that is being destroyed
+        delete current.load(std::memory_order_acquire);
+        domain.Reclaim();
+    }
+
+    bool VerdictCache::Lookup(GpuHandle resource, uint64_t version, GpuHandle& replacement) const {
+        EpochGuard guard(domain);
+
+        Table* table = current.load(std::memory_order_seq_cst);
+        if (!table || table->version != version || !resource) return false;
+
+        const uintptr_t key = reinterpret_cast<uintptr_t>(resource);
+        for (size_t i = Home(resource, table->mask), probes = 0; probes <= table->mask; i = (i + 1) & table->mask, ++probes) {
+            const Slot& slot = table->slots[i];
+            const uintptr_t found = slot.key.load(std::memory_order_acquire);
+            if (found == 0) return false;
+            if (found != key) continue;
+
+            const uintptr_t verdict = slot.verdict.load(std::memory_order_acquire);
+            if (verdict == kUnknown) return false;
+
+            replacement = verdict == kNoOverride ? nullptr : reinterpret_cast<GpuHandle>(verdict);
+            return true;
+        }
+        return false;
+    }
+
+    void VerdictCache::Store(GpuHandle resource, uint64_t version, GpuHandle replacement) {
+        if (!resource) return;
+
+        EpochGuard guard(domain);
+
+        Table* table = current.load(std::memory_order_seq_cst);
+        if (table && table->version > version) return;     // computed under superseded rules
+
+        if (!table || table->version < version || table->keys.load(std::memory_order_relaxed) >= capacity / 2) {
+            Reset(table, version);
+            table = current.load(std::memory_order_seq_cst);
+            if (!table || table->version != version) return;
+        }
+
+        const uintptr_t key = reinterpret_cast<uintptr_t>(resource);
+        const uintptr_t verdict = replacement ? reinterpret_cast<uintptr_t>(replacement) : kNoOverride;
+
+        // Racing inserts can overshoot the half-full limit slightly; they
+        // only make the next Store() reset sooner
+        for (size_t i = Home(resource, table->mask), probes = 0; probes <= table->mask; i = (i + 1) & table->mask, ++probes) {
+            Slot& slot = table->slots[i];
+
+            uintptr_t found = slot.key.load(std::memory_order_acquire);
+            if (found == 0 && slot.key.compare_exchange_strong(found, key, std::memory_order_acq_rel)) {
+                table->keys.fetch_add(1, std::memory_order_relaxed);
+                found = key;
+            }
+            if (found == key) {
+                slot.verdict.store(verdict, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    void VerdictCache::Invalidate(GpuHandle resource) {
+        if (!resource) return;
+
+        EpochGuard guard(domain);
+
+        Table* table = current.load(std::memory_order_seq_cst);
+        if (!table) return;
+
+        const uintptr_t key = reinterpret_cast<uintptr_t>(resource);
+        for (size_t i = Home(resource, table->mask), probes = 0; probes <= table->mask; i = (i + 1) & table->mask, ++probes) {
+            Slot& slot = table->slots[i];
+            const uintptr_t found = slot.key.load(std::memory_order_acquire);
+            if (found == 0) return;
+            if (found == key) {
+                slot.verdict.store(kUnknown, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    bool VerdictCache::ReleaseHook::Fire() const {
+        std::lock_guard<std::mutex> lock(anchor->mutex);
+        if (!anchor->cache) return false;
+
+        anchor->cache->Invalidate(resource);
+        return true;
+    }
+
+    void VerdictCache::Clear() {
+        std::lock_guard<std::mutex> lock(resetMutex);
+
+        Table* previous = current.exchange(nullptr, std::memory_order_seq_cst);
+        if (previous) domain.Retire(previous, &DeleteTable);
+        domain.Reclaim();
+    }
+
+    VerdictCacheStats VerdictCache::Stats() const {
+        EpochGuard guard(domain);
+
+        VerdictCacheStats stats;
+        stats.capacity = capacity;
+        stats.resets = resets.load(std::memory_order_relaxed);
+        if (Table* table = current.load(std::memory_order_seq_cst))
+            stats.keys = table->keys.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    size_t VerdictCache::Home(GpuHandle resource, size_t mask) {
+        return static_cast<size_t>(Mix64(reinterpret_cast<uintptr_t>(resource))) & mask;
+    }
+
+    void VerdictCache::DeleteTable(void* table) {
+        delete static_cast<Table*>(table);
+    }
+
+    void VerdictCache::Reset(Table* seen, uint64_t version) {
+        std::lock_guard<std::mutex> lock(resetMutex);
+        if (current.load(std::memory_order_acquire) != seen) return;
+
+        Table* previous = current.exchange(new Table(capacity, version), std::memory_order_seq_cst);
+        if (previous) {
+            domain.Retire(previous, &DeleteTable);
+            resets.fetch_add(1, std::memory_order_relaxed);
+        }
+        domain.Reclaim();
+    }
+
+} // namespace QUADRAQ
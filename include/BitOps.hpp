@@ -0,0 +1,47 @@
+// ====================================================================
+//                            BitOps.hpp
+//     TGDK Quantum GPU Accelerator — Portable Bit Helpers
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_BIT_OPS_HPP
+#define TGDK_BIT_OPS_HPP
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace QUADRAQ {
+
+    inline uint32_t PopCount64(uint64_t value) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<uint32_t>(__popcnt64(value));
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint32_t>(__builtin_popcountll(value));
+#else
+        uint32_t count = 0;
+        for (; value; value &= value - 1) ++count;
+        return count;
+#endif
+    }
+
+    // Index of the lowest set bit. `value` must be non-zero.
+    inline uint32_t CountTrailingZeros64(uint64_t value) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<uint32_t>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint32_t>(__builtin_ctzll(value));
+#else
+        uint32_t index = 0;
+        while ((value & 1u) == 0) { value >>= 1; ++index; }
+        return index;
+#endif
+    }
+
+} // namespace QUADRAQ
+
+#endif // TGDK_BIT_OPS_HPP
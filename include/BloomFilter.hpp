@@ -0,0 +1,50 @@
+// ====================================================================
+//                            BloomFilter.hpp
+//     TGDK Quantum GPU Accelerator — Negative Lookup Filter
+//     Rejects most absent keys with one memory access
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_BLOOM_FILTER_HPP
+#define TGDK_BLOOM_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // Register-blocked Bloom filter over 64-bit hashes: each key sets
+    // kProbes bits inside a single word, so a query is one load and a
+    // mask test. Keys must already be well-mixed hashes. Built once from
+    // the full key set; an empty filter rejects everything.
+    class BloomFilter {
+    public:
+        static constexpr size_t kBitsPerKey = 16;
+        static constexpr uint32_t kProbes = 5;
+
+        void Build(const std::vector<uint64_t>& keys);
+
+        bool MayContain(uint64_t key) const {
+            const uint64_t mask = ProbeMask(key);
+            return (words[static_cast<size_t>(key) & wordMask] & mask) == mask;
+        }
+
+        size_t MemoryBytes() const { return words.size() * sizeof(uint64_t); }
+
+    private:
+        // Bit positions come from the high bits, the word from the low ones
+        static uint64_t ProbeMask(uint64_t key) {
+            uint64_t mask = 0;
+            for (uint32_t i = 0; i < kProbes; ++i)
+                mask |= 1ull << ((key >> (34 + 6 * i)) & 63);
+            return mask;
+        }
+
+        std::vector<uint64_t> words = std::vector<uint64_t>(1, 0);
+        size_t wordMask = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_BLOOM_FILTER_HPP
@@ -0,0 +1,55 @@
+// ====================================================================
+//                       ChangePointDetector.hpp
+//     TGDK Quantum GPU Accelerator — Online Level-Shift Detection
+//     Two-sided Page-Hinkley test over the frame-time stream
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_CHANGE_POINT_DETECTOR_HPP
+#define TGDK_CHANGE_POINT_DETECTOR_HPP
+
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    // Detects sustained shifts in the mean of a signal (a new scene) while
+    // ignoring zero-mean jitter. Deviations smaller than `driftTolerance`
+    // are absorbed. A shift is reported once the cumulative deviation
+    // exceeds `threshold`. Each sample contributes at most
+    // threshold / minRunFrames, to the test and to the segment mean, so a
+    // single spike cannot trigger a detection on its own.
+    class ChangePointDetector {
+    public:
+        struct Parameters {
+            float driftTolerance = 0.002f;  // seconds
+            float threshold = 0.050f;       // seconds of cumulative deviation
+            uint32_t minRunFrames = 3;
+            uint32_t warmupFrames = 30;     // samples before detection is armed
+        };
+
+        ChangePointDetector() = default;
+        explicit ChangePointDetector(const Parameters& params) : params(params) {}
+
+        void Configure(const Parameters& newParams);
+        const Parameters& GetParameters() const { return params; }
+        void Reset();
+
+        // Returns +1 for an upward shift, -1 for a downward shift, 0 otherwise.
+        // The detector restarts from the current sample after a detection.
+        int Push(float sample);
+
+        float SegmentMean() const { return static_cast<float>(mean); }
+
+    private:
+        Parameters params;
+        double mean = 0.0;
+        double upSum = 0.0;
+        double upMin = 0.0;
+        double downSum = 0.0;
+        double downMax = 0.0;
+        uint32_t count = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_CHANGE_POINT_DETECTOR_HPP
@@ -0,0 +1,77 @@
+// ====================================================================
+//                           CullingStage.hpp
+//     TGDK Quantum GPU Accelerator — CPU Frustum & Small-Feature Culling
+//     SIMD sphere tests over structure-of-arrays bounds, run ahead of
+//     QuantumDrawRouter so invisible draws never reach the GPU
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_CULLING_STAGE_HPP
+#define TGDK_CULLING_STAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    // World-space bounding spheres, all arrays `count` long.
+    struct BoundsSoA {
+        size_t count = 0;
+        const float* centerX = nullptr;
+        const float* centerY = nullptr;
+        const float* centerZ = nullptr;
+        const float* radius = nullptr;
+    };
+
+    struct CullStats {
+        size_t tested = 0;
+        size_t frustumCulled = 0;
+        size_t smallCulled = 0;         // inside the frustum but under the pixel threshold
+
+        size_t Visible() const { return tested - frustumCulled - smallCulled; }
+    };
+
+    enum class CullKernel : uint8_t {
+        Scalar,
+        SSE,
+        AVX2
+    };
+
+    class CullingStage {
+    public:
+        CullingStage();
+
+        // Row-major matrix in D3D's row-vector convention (clip = [x y z 1] * M)
+        // with clip z in [0, w], as produced by DirectXMath.
+        void SetViewProjection(const float viewProjection[16], float viewportWidth, float viewportHeight);
+
+        // Spheres whose projected diameter is below this many pixels are dropped.
+        void SetMinPixelSize(float pixels) { minPixelSize = pixels; }
+
+        // Best kernel the CPU supports; ForceKernel() exists for comparisons
+        // and is clamped to what the CPU supports.
+        static CullKernel BestKernel();
+        void ForceKernel(CullKernel kernel);
+        CullKernel Kernel() const { return kernel; }
+
+        // Writes one bit per draw into `visibleMask` ((count + 63) / 64 words,
+        // bit set = visible) and returns the stats for this call.
+        CullStats Cull(const BoundsSoA& bounds, uint64_t* visibleMask) const;
+
+        // Normalized frustum planes, SoA: a sphere is inside plane k when
+        // a[k] * x + b[k] * y + c[k] * z + d[k] >= -r.
+        struct Planes {
+            float a[6], b[6], c[6], d[6];
+        };
+
+    private:
+        Planes planes{};
+        float wRow[4] = { 0.0f, 0.0f, 0.0f, 1.0f };   // clip w as a function of (x, y, z, 1)
+        float pixelScale = 1.0f;                        // pixels per unit of r / w
+        float minPixelSize = 1.0f;
+        CullKernel kernel;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_CULLING_STAGE_HPP
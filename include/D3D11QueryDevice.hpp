@@ -0,0 +1,37 @@
+// ====================================================================
+//                         D3D11QueryDevice.hpp
+//     TGDK Quantum GPU Accelerator — D3D11 Query Adapter
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_D3D11_QUERY_DEVICE_HPP
+#define TGDK_D3D11_QUERY_DEVICE_HPP
+
+#include "QueryRing.hpp"
+
+#include <d3d11.h>
+
+namespace QUADRAQ {
+
+    // Pipeline-statistics queries on a (non-owned) device and immediate
+    // context. Handles are ID3D11Query pointers owned by the caller until
+    // ReleaseQuery().
+    class D3D11QueryDevice : public IQueryDevice {
+    public:
+        D3D11QueryDevice(ID3D11Device* device, ID3D11DeviceContext* context)
+            : device(device), context(context) {}
+
+        GpuHandle CreatePipelineQuery() override;
+        void ReleaseQuery(GpuHandle query) override;
+        void Begin(GpuHandle query) override;
+        void End(GpuHandle query) override;
+        QueryPoll Poll(GpuHandle query, PipelineStatistics& stats) override;
+
+    private:
+        ID3D11Device* device;
+        ID3D11DeviceContext* context;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_D3D11_QUERY_DEVICE_HPP
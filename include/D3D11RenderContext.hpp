@@ -0,0 +1,64 @@
+// ====================================================================
+//                        D3D11RenderContext.hpp
+//     TGDK Quantum GPU Accelerator — D3D11 Device-Context Adapter
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_D3D11_RENDER_CONTEXT_HPP
+#define TGDK_D3D11_RENDER_CONTEXT_HPP
+
+#include "RenderContext.hpp"
+#include "StateCache.hpp"
+
+#include <d3d11.h>
+#include <mutex>
+
+namespace QUADRAQ {
+
+    // Forwards IRenderContext calls to a (non-owned) ID3D11DeviceContext.
+    class D3D11RenderContext : public IRenderContext {
+    public:
+        explicit D3D11RenderContext(ID3D11DeviceContext* context) : context(context) {}
+
+        ID3D11DeviceContext* Native() const { return context; }
+
+        void SetVertexBuffer(uint32_t slot, GpuHandle buffer, uint32_t stride, uint32_t offset) override;
+        void SetVertexShader(GpuHandle shader) override;
+        void SetPixelShader(GpuHandle shader) override;
+        void SetShaderResource(ShaderStage stage, uint32_t slot, GpuHandle view) override;
+        void SetPrimitiveTopology(uint32_t topology) override;
+        void Draw(uint32_t vertexCount, uint32_t startVertex) override;
+
+    private:
+        ID3D11DeviceContext* context;
+    };
+
+    // One QUADRAQ submission of several draws on `context`. The game binds
+    // its own state on the same context between QUADRAQ calls, so the
+    // shared state cache starts every scope invalidated and only elides
+    // binds repeated within the scope (e.g. draws of a batch sharing a
+    // buffer); a single bind gains nothing from it and should go to the
+    // context directly. Scopes on any thread serialize on one lock, which
+    // also keeps QUADRAQ's own batched calls from overlapping.
+    class StateCacheScope {
+    public:
+        explicit StateCacheScope(ID3D11DeviceContext* context);
+
+        StateCacheScope(const StateCacheScope&) = delete;
+        StateCacheScope& operator=(const StateCacheScope&) = delete;
+
+        StateCache& Cache() { return cache; }
+
+    private:
+        std::lock_guard<std::mutex> lock;
+        StateCache& cache;
+    };
+
+    // Binds issued and elided by every scope so far. The shared cache never
+    // starts a frame, so only the thread holding a scope writes these;
+    // callers wanting per-frame figures diff successive readings.
+    StateCacheCounters StateCacheTotals();
+
+} // namespace QUADRAQ
+
+#endif // TGDK_D3D11_RENDER_CONTEXT_HPP
@@ -0,0 +1,61 @@
+// ====================================================================
+//                         D3D11UploadDevice.hpp
+//     TGDK Quantum GPU Accelerator — D3D11 Upload Adapter
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_D3D11_UPLOAD_DEVICE_HPP
+#define TGDK_D3D11_UPLOAD_DEVICE_HPP
+
+#include "UploadRing.hpp"
+
+#include <array>
+#include <d3d11.h>
+
+namespace QUADRAQ {
+
+    // Buffers and fences on a (non-owned) device and immediate context.
+    // D3D11.0 has no fence object, so fences are event queries: a query
+    // reports done once the GPU has passed its End(), which also implies
+    // every earlier fence. Handles are ID3D11Buffer pointers.
+    // All fence queries are created up front, so signalling never
+    // allocates; if any cannot be created none are kept and the device
+    // is not usable (IsValid() is false).
+    class D3D11UploadDevice : public IUploadDevice {
+    public:
+        D3D11UploadDevice(ID3D11Device* device, ID3D11DeviceContext* context);
+        ~D3D11UploadDevice();
+
+        bool IsValid() const { return fenceQueries[0] != nullptr; }
+
+        D3D11UploadDevice(const D3D11UploadDevice&) = delete;
+        D3D11UploadDevice& operator=(const D3D11UploadDevice&) = delete;
+
+        GpuHandle CreateDynamicBuffer(uint32_t byteSize, BufferKind kind) override;
+        GpuHandle CreateStaticBuffer(const void* data, uint32_t byteSize, BufferKind kind) override;
+        void ReleaseBuffer(GpuHandle buffer) override;
+        void* Map(GpuHandle buffer, MapMode mode) override;
+        void Unmap(GpuHandle buffer) override;
+        uint64_t SignalFence() override;
+        uint64_t CompletedFence() override;
+
+    private:
+        static constexpr uint32_t kFenceQueries = 16;
+
+        void ReleaseFenceQueries();
+
+        ID3D11Device* device;
+        ID3D11DeviceContext* context;
+
+        // Fence v lives in slot v % kFenceQueries. Reissuing a slot whose
+        // query is still pending moves it to the newer fence, which only
+        // delays when the older one is reported.
+        std::array<ID3D11Query*, kFenceQueries> fenceQueries{};
+        std::array<uint64_t, kFenceQueries> fenceValues{};
+        uint64_t signalled = 0;
+        uint64_t completed = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_D3D11_UPLOAD_DEVICE_HPP
@@ -0,0 +1,112 @@
+// ====================================================================
+//                             DdsFile.hpp
+//     TGDK Quantum GPU Accelerator — Zero-Copy DDS Reader
+//     Memory-mapped DDS container with per-mip / per-slice views for
+//     texture upload straight out of the mapping
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_DDS_FILE_HPP
+#define TGDK_DDS_FILE_HPP
+
+#include "MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // File layout, all integers little-endian:
+    //   "DDS " | 124-byte header (with a 32-byte pixel format at 72)
+    //   | 20-byte DX10 header when the pixel format's FourCC is "DX10"
+    //   | pixel data, array slice by array slice, each slice's mips
+    //     largest first; a cube's faces are six consecutive slices
+    namespace DdsFormat {
+        constexpr char kMagic[4] = { 'D', 'D', 'S', ' ' };
+        constexpr size_t kHeaderSize = 124;
+        constexpr size_t kPixelFormatSize = 32;
+        constexpr size_t kDx10HeaderSize = 20;
+
+        // Direct3D 11 feature level 11 limits
+        constexpr uint32_t kMaxMipLevels = 15;
+        constexpr uint32_t kMaxTextureDimension = 16384;    // 1D and 2D
+        constexpr uint32_t kMaxVolumeDimension = 2048;
+        constexpr uint32_t kMaxArraySize = 2048;            // counting cube faces
+    }
+
+    enum class DdsDimension : uint8_t {
+        Texture1D,
+        Texture2D,          // cube maps included
+        Texture3D
+    };
+
+    struct DdsInfo {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t depth = 0;             // 1 unless Texture3D
+        uint32_t mipLevels = 0;
+        uint32_t arraySize = 0;         // texture count; a cube counts once
+        uint32_t format = 0;            // DXGI_FORMAT value
+        DdsDimension dimension = DdsDimension::Texture2D;
+        bool cube = false;
+        bool legacyHeader = false;      // format was derived from the pixel format
+    };
+
+    // One mip of one array slice (or cube face); the same pitches as
+    // D3D11_SUBRESOURCE_DATA. Block-compressed rows are rows of blocks.
+    struct DdsSubresource {
+        const uint8_t* data = nullptr;
+        size_t size = 0;                // slicePitch x depth
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t depth = 0;
+        uint32_t rowPitch = 0;
+        uint32_t slicePitch = 0;
+
+        explicit operator bool() const { return data != nullptr; }
+    };
+
+    // Opening validates the headers and that every subresource lies in
+    // the file; no pixel data is read or copied, so the views point into
+    // the mapping and stay valid until Close(). Formats are the DXGI ones
+    // D3D11 can sample from a DDS, plus the common legacy D3D9 pixel
+    // formats; planar video formats are rejected.
+    class DdsFile {
+    public:
+        bool Open(const std::string& path);
+        bool Open(const std::wstring& path);
+        // Parses bytes the caller keeps alive for as long as the views.
+        bool OpenMemory(const void* data, size_t size);
+        void Close();
+        bool IsOpen() const { return !subresources.empty(); }
+
+        const DdsInfo& Info() const { return info; }
+
+        // mipLevels x array slices (x 6 for a cube), in D3D11 subresource
+        // order: slice * mipLevels + mip.
+        size_t SubresourceCount() const { return subresources.size(); }
+        const DdsSubresource* Subresources() const { return subresources.data(); }
+        // An empty view when out of range. Cube faces are array slices.
+        DdsSubresource Subresource(uint32_t mip, uint32_t arraySlice) const;
+
+        // Bytes of pixel data the subresources cover.
+        size_t DataSize() const { return dataSize; }
+
+        const std::string& Error() const { return error; }
+
+    private:
+        bool Parse(const uint8_t* bytes, size_t size);
+        bool Fail(const std::string& message);
+
+        MappedFile file;
+        DdsInfo info;
+        std::vector<DdsSubresource> subresources;
+        size_t dataSize = 0;
+        std::string error;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_DDS_FILE_HPP
@@ -0,0 +1,50 @@
+// ====================================================================
+//                           DrawBudget.hpp
+//     TGDK Quantum GPU Accelerator — Cost-Aware Draw Suppression
+//     Greedy per-frame knapsack: shed the draws that are cheapest to
+//     lose until the projected frame fits its budget
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_DRAW_BUDGET_HPP
+#define TGDK_DRAW_BUDGET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QUADRAQ {
+
+    struct DrawBudgetResult {
+        size_t dropped = 0;
+        float droppedCost = 0.0f;
+        float unmetExcess = 0.0f;   // > 0 when every droppable draw went and it still did not fit
+    };
+
+    // Every draw has an estimated cost (seconds) and an importance class.
+    // Losing a draw costs classWeights[class]; saving its cost is worth
+    // its cost. Draws are shed in ascending weight/cost order until their
+    // summed cost covers `excess`. A class weight < 0 marks the class as
+    // never droppable; a draw with no cost is never worth dropping.
+    //
+    // Selection is a weighted quickselect on that ratio, expected O(n),
+    // so only the boundary of the dropped set is ever ordered.
+    class DrawBudgetSelector {
+    public:
+        // `survivorMask` gets (count + 63) / 64 words, bit set = keep.
+        DrawBudgetResult Select(const float* costs, const uint8_t* classes, size_t count, float excess,
+            const float* classWeights, size_t classCount, uint64_t* survivorMask);
+
+    private:
+        struct Candidate {
+            float ratio;
+            float cost;
+            uint32_t draw;
+        };
+
+        std::vector<Candidate> candidates;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_DRAW_BUDGET_HPP
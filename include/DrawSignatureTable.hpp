@@ -0,0 +1,91 @@
+// ====================================================================
+//                        DrawSignatureTable.hpp
+//     TGDK Quantum GPU Accelerator — Cross-Frame Draw History
+//     Fixed-size open-addressing table keyed by draw fingerprints
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_DRAW_SIGNATURE_TABLE_HPP
+#define TGDK_DRAW_SIGNATURE_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // Visual-impact flags reported by the AI backends for a signature.
+    namespace DrawImpact {
+        constexpr uint8_t Visible = 1u << 0;           // contributes visibly to the frame
+        constexpr uint8_t Critical = 1u << 1;          // must never be suppressed
+        constexpr uint8_t SuppressionArtifact = 1u << 2;   // suppressing it was noticed
+    }
+
+    struct DrawHistory {
+        uint64_t signature = 0;         // 0 = empty slot
+        uint32_t lastSeenFrame = 0;
+        float contribution = 0.0f;      // EWMA of reported contribution
+        uint16_t framesSeen = 0;        // saturating
+        uint16_t timesSuppressed = 0;   // saturating
+        uint8_t impactFlags = 0;
+    };
+
+    struct DrawSignatureStats {
+        size_t capacity = 0;
+        size_t occupied = 0;
+        uint64_t lookups = 0;
+        uint64_t inserts = 0;
+        uint64_t evictions = 0;         // live entries displaced by a full probe window
+        uint64_t expired = 0;           // entries aged out by the sweep
+    };
+
+    // Each signature may live in two short windows (two-choice hashing
+    // keeps them usable at high load); when all kProbeLimit candidate
+    // slots are taken the least recently seen one is replaced, so memory stays at `capacity`
+    // entries forever. AdvanceFrame() ages the table incrementally, a
+    // fixed slice of slots per frame, so aging is O(1) per frame too.
+    // Not thread-safe.
+    class DrawSignatureTable {
+    public:
+        static constexpr size_t kProbeLimit = 8;
+
+        // Capacity is rounded up to a power of two.
+        explicit DrawSignatureTable(size_t capacity = 4096, uint32_t maxAgeFrames = 600);
+
+        static uint64_t Fingerprint(const void* vertexBuffer, uint32_t stride, uint32_t offset,
+            const void* vertexShader, const void* pixelShader, const void* texture);
+
+        // History for `signature`, inserted (and marked seen this frame) if
+        // missing. Never returns null.
+        DrawHistory* Touch(uint64_t signature);
+        // Read-only lookup, null when the signature is not tracked.
+        const DrawHistory* Find(uint64_t signature) const;
+
+        void ReportImpact(uint64_t signature, float contribution, uint8_t impactFlags);
+
+        void AdvanceFrame(uint32_t frameIndex);
+        uint32_t CurrentFrame() const { return frame; }
+
+        void Clear();
+        const DrawSignatureStats& Stats() const { return stats; }
+
+    private:
+        // i-th probe: the first half walks from the low-bits home, the second
+        // from the high-bits home
+        size_t Slot(uint64_t signature, size_t i) const {
+            const size_t half = kProbeLimit / 2;
+            const size_t home = i < half ? static_cast<size_t>(signature) : static_cast<size_t>(signature >> 32);
+            return (home + (i % half)) & mask;
+        }
+
+        std::vector<DrawHistory> slots;
+        size_t mask;
+        size_t sweepCursor = 0;
+        uint32_t maxAge;
+        uint32_t frame = 0;
+        DrawSignatureStats stats;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_DRAW_SIGNATURE_TABLE_HPP
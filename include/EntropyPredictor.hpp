@@ -1,10 +1,137 @@
 #pragma once
 
+#include "ChangePointDetector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 namespace EntropyPredictor {
+
+    // Input channels are registered once and then addressed by id.
+    using ChannelId = uint32_t;
+    constexpr ChannelId InvalidChannel = 0xFFFFFFFFu;
+
+    // Built-in channels, always registered with these ids.
+    namespace Channels {
+        constexpr ChannelId FrameTime = 0;          // fed by UpdateCycle()
+        constexpr ChannelId VSInvocations = 1;      // pipeline statistics
+        constexpr ChannelId PSInvocations = 2;
+        constexpr ChannelId RasterPrimitives = 3;
+        constexpr ChannelId CpuLoad = 4;            // 0..1 system CPU busy fraction
+    }
+
+    struct ChannelStats {
+        const char* name = nullptr;
+        float last = 0.0f;
+        float mean = 0.0f;
+        float stdDev = 0.0f;
+        float zScore = 0.0f;            // last sample against the window before it
+        float weight = 0.0f;
+        bool live = false;              // counted in the fused score
+    };
+
+    // Consistent view of the predictor, published once per UpdateCycle().
+    struct Snapshot {
+        float entropyRate = 0.0f;       // frame-time stddev over the window (s)
+        float meanFrameTime = 0.0f;     // mean frame time over the window (s)
+        bool overloaded = false;
+        uint64_t frameIndex = 0;
+        float forecastLevel = 0.0f;     // smoothed frame time (s)
+        float forecastTrend = 0.0f;     // change per frame (s)
+        float forecastConfidence = 0.0f;
+        uint32_t sceneIndex = 0;        // bumped on every detected scene transition
+        float fusedScore = 0.0f;        // weighted mean positive z-score over live channels
+    };
+
+    // Overload hysteresis. Thresholds are frame times in seconds; the
+    // exit threshold is clamped to be no higher than the enter threshold.
+    struct OverloadPolicy {
+        float enterFrameTime = 1.0f / 30.0f;
+        float exitFrameTime = 1.0f / 45.0f;
+        uint32_t enterFrames = 3;       // consecutive frames above enter to raise
+        uint32_t exitFrames = 30;       // consecutive frames below exit to clear
+        uint32_t horizonFrames = 3;     // how far ahead the forecast looks
+        float fusedEnterScore = 3.0f;   // fused channel score that raises overload (0 = off)
+        float fusedExitScore = 1.0f;
+    };
+
+    enum class Horizon {
+        LastSecond,
+        LastMinute,
+        Session
+    };
+
+    // Frame-time percentiles in seconds, ~3% relative precision.
+    struct Percentiles {
+        float p50 = 0.0f;
+        float p95 = 0.0f;
+        float p99 = 0.0f;
+        float p999 = 0.0f;
+        uint64_t samples = 0;
+    };
+
+    // Emitted when the frame-time level shifts (a new scene), as opposed
+    // to jitter around the same level.
+    struct SceneTransitionEvent {
+        uint64_t frameIndex = 0;
+        uint32_t sceneIndex = 0;
+        float previousMeanFrameTime = 0.0f;
+        float frameTime = 0.0f;
+        int direction = 0;              // +1 heavier scene, -1 lighter scene
+    };
+
+    // Page-Hinkley parameters, in seconds of frame time.
+    using SceneDetectionParameters = QUADRAQ::ChangePointDetector::Parameters;
+
+    // Called on the UpdateCycle() thread, outside the predictor lock.
+    using SceneTransitionCallback = void (*)(const SceneTransitionEvent& event, void* userData);
+
     bool Initialize();
     void SetEnabled(bool enable);
     bool IsEnabled();
     float GetCurrentEntropyRate();
     void UpdateCycle();
     bool IsOverloaded();
+
+    // Lock-free; safe to call from any thread, including draw hooks.
+    Snapshot GetSnapshot();
+
+    // Sliding window length in frames (default 120). Resizing drops history.
+    void SetSampleWindow(size_t frames);
+    size_t GetSampleWindow();
+
+    Percentiles GetFrameTimePercentiles(Horizon horizon);
+
+    // Forecasting mode (on by default): overload is raised from the
+    // predicted frame time instead of the last measured one.
+    void SetForecastingEnabled(bool enable);
+    bool IsForecastingEnabled();
+    void SetOverloadPolicy(const OverloadPolicy& policy);
+    OverloadPolicy GetOverloadPolicy();
+
+    // Lock-free reads of the most recent forecast.
+    float PredictNextFrameTime(uint32_t framesAhead = 1);
+    float GetForecastConfidence();
+
+    // Scene-transition subscriptions (fixed table of 16). Returns an id for
+    // UnsubscribeSceneTransition(), or -1 if the table is full.
+    int SubscribeSceneTransition(SceneTransitionCallback callback, void* userData = nullptr);
+    void UnsubscribeSceneTransition(int id);
+    void SetSceneDetection(const SceneDetectionParameters& params);
+
+    // Multi-channel input (up to 16 channels, 120-sample window each).
+    // RegisterChannel returns the existing id for a known name, or
+    // InvalidChannel when the table is full. Samples are O(1) per push.
+    ChannelId RegisterChannel(const char* name, float weight = 1.0f);
+    ChannelId FindChannel(const char* name);
+    void PushChannelSample(ChannelId channel, float value);
+    bool GetChannelStats(ChannelId channel, ChannelStats& out);
+    float GetFusedOverloadScore();
+
+    // Streams every UpdateCycle() frame time to a QUADRAQ frame trace
+    // (see FrameTrace.hpp) for offline replay with quadraq_replay.
+    bool StartCapture(const std::string& path);
+    void StopCapture();
+    bool IsCapturing();
 }
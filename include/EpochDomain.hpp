@@ -0,0 +1,98 @@
+// ====================================================================
+//                           EpochDomain.hpp
+//     TGDK Quantum GPU Accelerator — Epoch-Based Reclamation
+//     Lets writers free data that lock-free readers may still see
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_EPOCH_DOMAIN_HPP
+#define TGDK_EPOCH_DOMAIN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace QUADRAQ {
+
+    struct EpochThreadState;
+
+    // Readers pin the current epoch for the duration of a read (see
+    // EpochGuard); a writer that unpublishes an object retires it, and it
+    // is destroyed once every reader pinned at or before the retirement
+    // has left. Reader slots are a fixed table claimed once per thread,
+    // so pinning never locks or allocates; threads beyond the table share
+    // an overflow counter that simply holds reclamation back while busy.
+    // A domain other than Global() must outlive every thread that read
+    // through it.
+    class EpochDomain {
+    public:
+        static constexpr size_t kReaderSlots = 64;
+
+        using Deleter = void (*)(void* object);
+
+        // Process-wide domain shared by every lock-free table.
+        static EpochDomain& Global();
+
+        EpochDomain() = default;
+        ~EpochDomain();
+
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator=(const EpochDomain&) = delete;
+
+        // Call after `object` can no longer be reached by new readers.
+        void Retire(void* object, Deleter deleter);
+
+        // Destroys whatever no reader can still hold; returns how many.
+        size_t Reclaim();
+        size_t PendingRetired() const;
+
+    private:
+        friend class EpochGuard;
+        friend struct EpochThreadState;
+
+        struct alignas(64) ReaderSlot {
+            std::atomic<uint64_t> epoch{ 0 };     // 0 = not reading
+            std::atomic<bool> claimed{ false };
+        };
+
+        struct Retired {
+            void* object;
+            Deleter deleter;
+            uint64_t epoch;
+        };
+
+        // Slot index for this thread, or kReaderSlots for the overflow path
+        size_t ThreadSlot();
+        void ReleaseSlot(size_t slot);
+        uint64_t OldestPinned() const;
+
+        std::atomic<uint64_t> epoch{ 1 };
+        ReaderSlot slots[kReaderSlots];
+        std::atomic<uint32_t> overflowReaders{ 0 };
+
+        mutable std::mutex retiredMutex;
+        std::vector<Retired> retired;
+    };
+
+    // Pins the domain's epoch on this thread for the guard's lifetime.
+    // Guards nest; only the outermost one pins.
+    class EpochGuard {
+    public:
+        explicit EpochGuard(EpochDomain& domain = EpochDomain::Global());
+        ~EpochGuard();
+
+        EpochGuard(const EpochGuard&) = delete;
+        EpochGuard& operator=(const EpochGuard&) = delete;
+
+    private:
+        EpochDomain& domain;
+        uint32_t* depth;                // this thread's nesting count, if registered
+        size_t slot;
+        bool outermost;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_EPOCH_DOMAIN_HPP
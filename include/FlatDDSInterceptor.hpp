@@ -1,13 +1,42 @@
 #ifndef TGDK_FLAT_DDS_INTERCEPTOR_HPP
 #define TGDK_FLAT_DDS_INTERCEPTOR_HPP
 
+#include "RedirectTable.hpp"
+
 #include <d3d11.h>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace FlatDDSInterceptor {
     bool LoadFlatTexture(ID3D11Device* device, const std::wstring& ddsPath);
-    void RegisterOverride(const std::string& originalName);
-    ID3D11ShaderResourceView* InterceptTexture(const std::string& textureName);
+    void RegisterOverride(std::string_view originalName);
+    // One table rebuild for the whole batch.
+    void RegisterOverrides(const std::vector<std::string_view>& originalNames);
+
+    // Override rules in QUADRAQ::NamePatternSet format. Exact rules join
+    // the RegisterOverride names; the others are compiled into one
+    // matcher consulted when no exact name matches. Every name, rule or
+    // registered, matches ignoring ASCII case. Each call replaces
+    // the previous rule set, exact rules included, so reloading a file
+    // drops deleted rules. Bad input is logged and leaves the current
+    // rules unchanged.
+    bool LoadOverrideRules(const std::string& path);
+    bool SetOverrideRules(std::string_view rules);
+
+    // Lock-free and, once a thread has matched against the current rules,
+    // allocation-free; safe from any bind thread. Callers that see the
+    // same names every frame can keep NameKey::Folded keys to skip hashing.
+    ID3D11ShaderResourceView* InterceptTexture(std::string_view textureName);
+    ID3D11ShaderResourceView* InterceptTexture(const QUADRAQ::NameKey& textureKey);
+
+    // Bind-path entry keyed by resource. The verdict is worked out once
+    // from the resource's debug object name and cached until the resource
+    // is destroyed or the overrides change, so a steady-state bind is one
+    // pointer-keyed probe.
+    ID3D11ShaderResourceView* InterceptResource(ID3D11Resource* resource);
+    // For creation hooks that know the file a resource was loaded from.
+    void NoteResource(ID3D11Resource* resource, std::string_view name);
     void Clear();
 }
 
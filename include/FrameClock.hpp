@@ -0,0 +1,25 @@
+// ====================================================================
+//                           FrameClock.hpp
+//     TGDK Quantum GPU Accelerator — Frame Timing Source
+//     Real steady clock, or a virtual clock for deterministic replay
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_FRAME_CLOCK_HPP
+#define TGDK_FRAME_CLOCK_HPP
+
+#include <cstdint>
+
+namespace FrameClock {
+
+    // Nanoseconds since an arbitrary epoch. Monotonic in both modes.
+    uint64_t NowNanoseconds();
+
+    // While virtual, time only moves when Advance() is called. Switching
+    // modes does not reset the virtual time.
+    void SetVirtual(bool enable);
+    bool IsVirtual();
+    void Advance(uint64_t nanoseconds);
+}
+
+#endif // TGDK_FRAME_CLOCK_HPP
@@ -0,0 +1,50 @@
+// ====================================================================
+//                      FrameTimeForecaster.hpp
+//     TGDK Quantum GPU Accelerator — Frame-Time Forecasting
+//     Holt linear-trend smoothing with a running error estimate
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_FRAME_TIME_FORECASTER_HPP
+#define TGDK_FRAME_TIME_FORECASTER_HPP
+
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    // Double exponential smoothing over frame times. alpha weights the
+    // level, beta the trend. One-step-ahead errors are tracked as an EWMA
+    // of squared residuals, which drives the confidence estimate.
+    class FrameTimeForecaster {
+    public:
+        explicit FrameTimeForecaster(float alpha = 0.3f, float beta = 0.1f);
+
+        void SetSmoothing(float alpha, float beta);
+        void Reset();
+        void Push(float sample);
+
+        float Level() const { return level; }
+        float Trend() const { return trend; }
+
+        // Forecast for `stepsAhead` frames from now (>= 1), never negative.
+        float Predict(uint32_t stepsAhead = 1) const;
+
+        // RMS of recent one-step-ahead forecast errors, in seconds.
+        float ResidualStdDev() const;
+
+        // 0 while warming up or when errors are large relative to the
+        // level, approaching 1 as forecasts track the signal.
+        float Confidence() const;
+
+    private:
+        float alpha;
+        float beta;
+        float level = 0.0f;
+        float trend = 0.0f;
+        float residualVariance = 0.0f;
+        uint32_t count = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_FRAME_TIME_FORECASTER_HPP
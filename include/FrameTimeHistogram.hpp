@@ -0,0 +1,94 @@
+// ====================================================================
+//                       FrameTimeHistogram.hpp
+//     TGDK Quantum GPU Accelerator — Streaming Frame-Time Percentiles
+//     HDR-style log-bucketed histograms over fixed time horizons
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_FRAME_TIME_HISTOGRAM_HPP
+#define TGDK_FRAME_TIME_HISTOGRAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    // Fixed-size histogram of durations in microseconds. Values below 32us
+    // are exact; above that each power-of-two octave is split into 32
+    // linear sub-buckets, bounding the relative error to ~3%. Values are
+    // clamped at ~16.7s.
+    class FrameTimeHistogram {
+    public:
+        static constexpr uint32_t kSubBucketBits = 5;
+        static constexpr uint32_t kSubBuckets = 1u << kSubBucketBits;
+        static constexpr uint32_t kMaxMicros = (1u << 24) - 1;
+        static constexpr size_t kBucketCount = (24 - kSubBucketBits + 1) * kSubBuckets;
+
+        static size_t BucketIndex(uint32_t micros);
+        static uint32_t BucketLowerBound(size_t index);
+        static uint32_t BucketMidpoint(size_t index);
+
+        void Clear();
+        void Record(uint32_t micros);
+        void RecordBucket(size_t index) { ++counts[index]; ++total; }
+        void Subtract(const FrameTimeHistogram& other);
+
+        uint64_t Count() const { return total; }
+
+        // Value in microseconds at quantile q in [0, 1]; 0 when empty.
+        uint32_t Quantile(double q) const;
+
+    private:
+        std::array<uint32_t, kBucketCount> counts{};
+        uint64_t total = 0;
+    };
+
+    // Histogram over the trailing `Slices * sliceMicros` of sample time.
+    // Time advances by the recorded frame durations themselves, so the
+    // horizon is measured in rendered time, not wall-clock time. Expiry
+    // happens one slice at a time, so Record() never allocates and its
+    // worst case is bounded by the slice count.
+    template <size_t Slices>
+    class WindowedFrameTimeHistogram {
+    public:
+        explicit WindowedFrameTimeHistogram(uint64_t sliceMicros)
+            : sliceLength(sliceMicros ? sliceMicros : 1) {}
+
+        void Clear() {
+            for (auto& slice : slices) slice.Clear();
+            aggregate.Clear();
+            current = 0;
+            elapsedInSlice = 0;
+        }
+
+        void Record(uint32_t micros) {
+            elapsedInSlice += micros;
+            size_t expired = 0;
+            while (elapsedInSlice >= sliceLength && expired < Slices) {
+                elapsedInSlice -= sliceLength;
+                current = (current + 1) % Slices;
+                aggregate.Subtract(slices[current]);
+                slices[current].Clear();
+                ++expired;
+            }
+            if (expired == Slices) elapsedInSlice %= sliceLength;
+
+            const size_t bucket = FrameTimeHistogram::BucketIndex(micros);
+            slices[current].RecordBucket(bucket);
+            aggregate.RecordBucket(bucket);
+        }
+
+        const FrameTimeHistogram& Aggregate() const { return aggregate; }
+
+    private:
+        std::array<FrameTimeHistogram, Slices> slices{};
+        FrameTimeHistogram aggregate;
+        uint64_t sliceLength;
+        uint64_t elapsedInSlice = 0;
+        size_t current = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_FRAME_TIME_HISTOGRAM_HPP
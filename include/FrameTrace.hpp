@@ -0,0 +1,94 @@
+// ====================================================================
+//                           FrameTrace.hpp
+//     TGDK Quantum GPU Accelerator — Frame-Time Capture Format
+//     Delta-encoded per-frame timing, streamed by a background writer
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_FRAME_TRACE_HPP
+#define TGDK_FRAME_TRACE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace QUADRAQ {
+
+    // Capture file layout, all integers little-endian:
+    //   header : "QDQT" | u16 version | u16 reserved | u32 tick length (ns)
+    //   body   : one record per frame, the zigzag LEB128 varint of
+    //            (frameTicks - previousFrameTicks); previous starts at 0.
+    // Steady frame rates encode in one or two bytes per frame.
+    namespace FrameTraceFormat {
+        constexpr char kMagic[4] = { 'Q', 'D', 'Q', 'T' };
+        constexpr uint16_t kVersion = 1;
+        constexpr size_t kHeaderSize = 12;
+        constexpr uint32_t kDefaultTickNanoseconds = 1000;
+    }
+
+    class FrameTraceWriter {
+    public:
+        explicit FrameTraceWriter(uint32_t tickNanoseconds = FrameTraceFormat::kDefaultTickNanoseconds);
+        ~FrameTraceWriter();
+
+        FrameTraceWriter(const FrameTraceWriter&) = delete;
+        FrameTraceWriter& operator=(const FrameTraceWriter&) = delete;
+
+        bool Open(const std::string& path);
+        // Drains pending frames, stops the writer thread and closes the file.
+        void Close();
+        bool IsOpen() const { return running.load(std::memory_order_acquire); }
+
+        // Called from the frame thread only. Lock-free and allocation-free;
+        // returns false and counts a drop when the queue is full.
+        bool Record(uint64_t frameNanoseconds);
+
+        uint64_t FramesWritten() const { return written.load(std::memory_order_relaxed); }
+        uint64_t FramesDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr size_t kQueueSize = 8192;     // power of two
+
+        void WriterLoop();
+        void Drain();
+
+        const uint32_t tickNanoseconds;
+        std::array<uint32_t, kQueueSize> queue{};
+        std::atomic<size_t> head{ 0 };                  // producer position
+        std::atomic<size_t> tail{ 0 };                  // consumer position
+        std::atomic<bool> running{ false };
+        std::atomic<uint64_t> written{ 0 };
+        std::atomic<uint64_t> dropped{ 0 };
+        std::thread worker;
+        std::ofstream out;
+        int64_t previousTicks = 0;                      // writer thread only
+    };
+
+    class FrameTraceReader {
+    public:
+        // Opens the capture and validates its header.
+        bool Open(const std::string& path);
+        void Close();
+
+        // Next frame duration; false at end of file or on a truncated record.
+        bool Next(uint64_t& frameNanoseconds);
+
+        uint32_t TickNanoseconds() const { return tickNanoseconds; }
+        uint16_t Version() const { return version; }
+        const std::string& Error() const { return error; }
+
+    private:
+        std::ifstream in;
+        uint32_t tickNanoseconds = 0;
+        uint16_t version = 0;
+        int64_t previousTicks = 0;
+        std::string error;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_FRAME_TRACE_HPP
@@ -0,0 +1,103 @@
+// ====================================================================
+//                              Hash.hpp
+//     TGDK Quantum GPU Accelerator — Content Hashing
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_HASH_HPP
+#define TGDK_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace QUADRAQ {
+
+    constexpr uint64_t kFnv64Offset = 14695981039346656037ull;
+    constexpr uint64_t kFnv64Prime = 1099511628211ull;
+
+    // FNV-1a, 64-bit. Stable across builds and hosts, so it is safe to
+    // persist (cache keys, file checksums). Chain calls by passing the
+    // previous result as `seed`.
+    inline uint64_t Fnv1a64(const void* data, size_t size, uint64_t seed = kFnv64Offset) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t hash = seed;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= kFnv64Prime;
+        }
+        return hash;
+    }
+
+    // splitmix64 finalizer: every input bit affects every output bit.
+    inline uint64_t Mix64(uint64_t value) {
+        value ^= value >> 30;
+        value *= 0xBF58476D1CE4E5B9ull;
+        value ^= value >> 27;
+        value *= 0x94D049BB133111EBull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    // ASCII 'A'-'Z' to 'a'-'z' in each of the eight bytes; other bytes,
+    // UTF-8 included, pass through.
+    inline uint64_t FoldAscii64(uint64_t word) {
+        constexpr uint64_t kOnes = 0x0101010101010101ull;
+        constexpr uint64_t kHigh = 0x8080808080808080ull;
+        const uint64_t low = word & ~kHigh;
+        const uint64_t atLeastA = low + (0x80 - 'A') * kOnes;
+        const uint64_t pastZ = low + (0x80 - 'Z' - 1) * kOnes;
+        const uint64_t upper = atLeastA & ~pastZ & ~word & kHigh;
+        return word | (upper >> 2);
+    }
+
+    namespace detail {
+        template <bool Fold>
+        inline uint64_t HashWords(const void* data, size_t size, uint64_t seed) {
+            constexpr uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            uint64_t hash = seed ^ (static_cast<uint64_t>(size) * kMultiplier);
+
+            for (; size >= 8; bytes += 8, size -= 8) {
+                uint64_t word;
+                std::memcpy(&word, bytes, 8);
+                if (Fold) word = FoldAscii64(word);
+                hash = (hash ^ word) * kMultiplier;
+                hash ^= hash >> 29;
+            }
+            if (size != 0) {
+                // Overlapping fixed-size reads; the length is already mixed in
+                uint64_t word;
+                if (size >= 4) {
+                    uint32_t low, high;
+                    std::memcpy(&low, bytes, 4);
+                    std::memcpy(&high, bytes + size - 4, 4);
+                    word = (static_cast<uint64_t>(high) << 32) | low;
+                } else {
+                    word = (static_cast<uint64_t>(bytes[0]) << 16) |
+                           (static_cast<uint64_t>(bytes[size / 2]) << 8) | bytes[size - 1];
+                }
+                if (Fold) word = FoldAscii64(word);
+                hash = (hash ^ word) * kMultiplier;
+                hash ^= hash >> 29;
+            }
+            return Mix64(hash);
+        }
+    }
+
+    // Eight bytes per step instead of one, for in-memory lookups keyed by
+    // names. The result depends on host byte order, so never persist it.
+    inline uint64_t FastHash64(const void* data, size_t size, uint64_t seed = 0) {
+        return detail::HashWords<false>(data, size, seed);
+    }
+
+    // FastHash64 of the bytes with ASCII case folded, without copying
+    // them: names differing only in case hash alike.
+    inline uint64_t FoldedHash64(const void* data, size_t size, uint64_t seed = 0) {
+        return detail::HashWords<true>(data, size, seed);
+    }
+
+} // namespace QUADRAQ
+
+#endif // TGDK_HASH_HPP
@@ -0,0 +1,65 @@
+// ====================================================================
+//                            MappedFile.hpp
+//     TGDK Quantum GPU Accelerator — Read-Only Memory-Mapped Files
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_MAPPED_FILE_HPP
+#define TGDK_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace QUADRAQ {
+
+    // Maps a whole file read-only; pages are faulted in on first touch,
+    // so opening is cheap regardless of size. Pointers into Data() stay
+    // valid until Close(). Move-only.
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool Open(const std::string& path);
+        // Wide path, opened as such on Windows (CreateFileW) and as UTF-8
+        // elsewhere, so non-ASCII names survive.
+        bool Open(const std::wstring& path);
+        void Close();
+
+        bool IsOpen() const { return open; }
+        // nullptr for an empty file.
+        const uint8_t* Data() const { return data; }
+        size_t Size() const { return size; }
+        const std::string& Error() const { return error; }
+
+    private:
+        void Swap(MappedFile& other) noexcept;
+#ifdef _WIN32
+        bool Map(void* handle, const std::string& name);
+#endif
+
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        bool open = false;
+#ifdef _WIN32
+        void* file = nullptr;       // HANDLE
+        void* mapping = nullptr;    // HANDLE
+#else
+        int descriptor = -1;
+#endif
+        std::string error;
+    };
+
+    // UTF-8 form of a wide path (UTF-16 where wchar_t is 16 bits, UTF-32
+    // otherwise); unpaired surrogates become U+FFFD.
+    std::string WidePathToUtf8(const std::wstring& path);
+
+} // namespace QUADRAQ
+
+#endif // TGDK_MAPPED_FILE_HPP
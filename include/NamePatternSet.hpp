@@ -0,0 +1,153 @@
+// ====================================================================
+//                          NamePatternSet.hpp
+//     TGDK Quantum GPU Accelerator — Compiled Name Pattern Rules
+//     Exact / prefix / suffix / contains / glob rules matched in one
+//     Aho-Corasick pass, with per-name memoization; lock-free reads
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_NAME_PATTERN_SET_HPP
+#define TGDK_NAME_PATTERN_SET_HPP
+
+#include "EpochDomain.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QUADRAQ {
+
+    enum class PatternKind : uint8_t {
+        Exact,
+        Prefix,
+        Suffix,
+        Contains,
+        Glob            // '*' matches any run, '?' any one character
+    };
+
+    struct NamePattern {
+        PatternKind kind;
+        std::string text;
+    };
+
+    struct NamePatternStats {
+        size_t patterns = 0;
+        size_t automatonStates = 0;
+        size_t memoized = 0;
+        uint64_t memoHits = 0;
+        uint64_t scans = 0;             // names run through the automaton
+        uint64_t verified = 0;          // candidate rules checked in full
+    };
+
+    // Every rule contributes its required literals (the whole text, or
+    // each run of a glob between wildcards) to a single Aho-Corasick
+    // automaton. A name is classified in one pass over its bytes; only
+    // rules whose literals all occurred are then checked in full, lowest
+    // index first. Matching ignores ASCII case.
+    //
+    // Every write compiles the rules into a new immutable snapshot, the
+    // automaton plus an empty memo, and publishes it with one atomic swap;
+    // the old one is retired to an EpochDomain. Match() and Scan() take no
+    // lock and do not allocate: a memoized name costs a hash and a probe,
+    // a new one a pass through the automaton with per-thread scratch that
+    // is only grown when a thread first meets a larger rule set. Memo
+    // entries are keyed by the case-folded name's 64-bit hash and keep the
+    // folded name, which a hit compares, so a colliding name is scanned
+    // rather than handed another name's verdict. A full memo or name store
+    // stops taking new names. Writes are serialized and cost O(rules);
+    // batch them with Parse() or Assign().
+    //
+    // Rule files hold one "<kind> <pattern>" per line, kind being exact,
+    // prefix, suffix, contains or glob; blank lines and lines starting
+    // with '#' are skipped. Patterns run to the end of the line.
+    class NamePatternSet {
+    public:
+        static constexpr size_t kMemoSlots = 8192;
+        static constexpr size_t kMemoNameBytes = kMemoSlots * 32;
+
+        explicit NamePatternSet(EpochDomain& domain = EpochDomain::Global());
+        ~NamePatternSet();
+
+        NamePatternSet(const NamePatternSet&) = delete;
+        NamePatternSet& operator=(const NamePatternSet&) = delete;
+
+        void Add(PatternKind kind, std::string_view text);
+        // Adds every rule, or none and sets Error() on the first bad line.
+        bool Parse(std::string_view rules);
+        bool Load(const std::string& path);
+        // Replaces every rule in one rebuild.
+        void Assign(std::vector<NamePattern> rules);
+        void Clear();
+
+        // Index of the first pattern that matches, or -1.
+        int Match(std::string_view name) const;
+        // Same, bypassing the memo.
+        int Scan(std::string_view name) const;
+
+        std::vector<NamePattern> Patterns() const;
+        NamePatternStats Stats() const;
+        const std::string& Error() const { return error; }
+
+    private:
+        static constexpr size_t kMaxLiterals = 64;     // per rule; later glob runs are only verified
+
+        struct Rule {
+            PatternKind kind;
+            std::string folded;         // lower-cased text
+            uint64_t literals;          // one bit per required literal; 0 = candidate for every name
+        };
+
+        struct Output {
+            int32_t rule;
+            uint64_t literal;           // this literal's bit in Rule::literals
+        };
+
+        struct MemoSlot {
+            std::atomic<uint64_t> key{ 0 };     // folded name hash, never 0; 0 = empty
+            std::atomic<uint64_t> name{ 0 };    // offset << 32 | length in memoNames; read after `rule`
+            std::atomic<int32_t> rule{ 0 };     // match + 2; 0 = not yet written
+        };
+
+        struct Snapshot {
+            std::vector<Rule> rules;
+            std::vector<int32_t> unanchored;    // rules without literals
+            uint8_t classOf[256] = {};          // 0 = a byte no literal uses
+            size_t classCount = 1;
+            std::vector<int32_t> transitions;   // states x classes, complete
+            std::vector<int32_t> outputLink;    // next state on the suffix chain with outputs, or -1
+            std::vector<uint32_t> outputStart;  // states + 1 offsets into `outputs`
+            std::vector<Output> outputs;        // literals ending at the state
+
+            std::unique_ptr<MemoSlot[]> memo{ new MemoSlot[kMemoSlots] };
+            std::unique_ptr<char[]> memoNames{ new char[kMemoNameBytes] };  // folded, bump-allocated
+            mutable std::atomic<size_t> memoNameBytes{ 0 };
+            mutable std::atomic<size_t> memoized{ 0 };
+        };
+
+        // Folds the rules and builds the automaton
+        static Snapshot* Compile(const std::vector<NamePattern>& patterns);
+        static void DeleteSnapshot(void* snapshot);
+        int ScanSnapshot(const Snapshot& snapshot, std::string_view name) const;
+        static bool Verify(const Rule& rule, std::string_view name);
+        // Writer only: compiles `patterns` and retires the previous snapshot
+        void PublishLocked();
+
+        EpochDomain& domain;
+        mutable std::mutex mutex;               // writers
+        std::vector<NamePattern> patterns;
+        std::string error;
+        std::atomic<const Snapshot*> current{ nullptr };
+
+        mutable std::atomic<uint64_t> memoHits{ 0 };
+        mutable std::atomic<uint64_t> scans{ 0 };
+        mutable std::atomic<uint64_t> verified{ 0 };
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_NAME_PATTERN_SET_HPP
@@ -0,0 +1,114 @@
+// ====================================================================
+//                       OcclusionRasterizer.hpp
+//     TGDK Quantum GPU Accelerator — Software Occlusion Culling
+//     Low-resolution CPU depth rasterizer for occluder meshes with a
+//     hierarchical-depth test for occludee bounds
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_OCCLUSION_RASTERIZER_HPP
+#define TGDK_OCCLUSION_RASTERIZER_HPP
+
+#include "CullingStage.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace QUADRAQ {
+
+    struct OcclusionStats {
+        size_t occluderTriangles = 0;   // submitted this frame
+        size_t binnedTriangles = 0;     // survived near-plane rejection and binning
+        size_t tested = 0;
+        size_t occluded = 0;
+    };
+
+    // Per frame: BeginFrame(), AddOccluder() for every designated occluder,
+    // Rasterize(), then any number of occludee tests. Rasterization is split
+    // into screen bins shared by a persistent worker pool; each bin also
+    // builds its part of the hierarchical depth (max depth per 8x8 block).
+    //
+    // Depth is D3D-style, 0 near / 1 far, at pixel centers. Occluder
+    // triangles crossing the near plane are dropped, which only ever makes
+    // the result more conservative. Calls are not thread-safe.
+    class OcclusionRasterizer {
+    public:
+        static constexpr uint32_t kBinWidth = 64;
+        static constexpr uint32_t kBinHeight = 32;
+        static constexpr uint32_t kBlockSize = 8;       // hierarchical depth granularity
+
+        // Dimensions are rounded up to whole bins. `workerThreads` 0 picks
+        // one less than the hardware concurrency, capped at 7; the calling
+        // thread always takes part in Rasterize().
+        explicit OcclusionRasterizer(uint32_t width = 320, uint32_t height = 192, uint32_t workerThreads = 0);
+        ~OcclusionRasterizer();
+
+        OcclusionRasterizer(const OcclusionRasterizer&) = delete;
+        OcclusionRasterizer& operator=(const OcclusionRasterizer&) = delete;
+
+        // Same matrix convention as CullingStage::SetViewProjection.
+        void BeginFrame(const float viewProjection[16]);
+
+        // World-space triangles, `positions` as packed xyz.
+        void AddOccluder(const float* positions, size_t vertexCount, const uint32_t* indices, size_t triangleCount);
+
+        void Rasterize();
+
+        // Pixel rectangle [minX, maxX) x [minY, maxY) whose nearest point is
+        // at `nearestDepth`. Hidden only if every covered block is nearer.
+        bool IsRectVisible(float minX, float minY, float maxX, float maxY, float nearestDepth) const;
+
+        // Refines `visibleMask` in place: only draws still set are tested and
+        // occluded ones are cleared, so it chains after CullingStage::Cull.
+        OcclusionStats TestSpheres(const BoundsSoA& bounds, uint64_t* visibleMask);
+
+        uint32_t Width() const { return width; }
+        uint32_t Height() const { return height; }
+        const float* Depth() const { return depth.data(); }
+        const OcclusionStats& Stats() const { return stats; }
+
+    private:
+        struct ScreenTriangle {
+            float edgeA[3], edgeB[3], edgeC[3];     // E(x, y) = A x + B y + C, inside when all >= 0
+            float z0, zx, zy;                       // depth plane
+            float minX, minY, maxX, maxY;           // screen bounds
+        };
+
+        void RasterizeBin(size_t bin);
+        void WorkerLoop();
+        void RunBins();
+
+        uint32_t width;
+        uint32_t height;
+        uint32_t binsX;
+        uint32_t binsY;
+        uint32_t blocksX;
+        float viewProjection[16] = {};
+        float columnLength[4] = {};                 // |xyz| of each clip column, for sphere bounds
+
+        std::vector<float> depth;
+        std::vector<float> blockMaxDepth;
+        std::vector<ScreenTriangle> triangles;
+        std::vector<std::vector<uint32_t>> binTriangles;
+        std::vector<float> clip;                    // scratch, 4 floats per vertex
+        OcclusionStats stats;
+
+        // Worker pool
+        std::vector<std::thread> workers;
+        std::mutex poolMutex;
+        std::condition_variable poolWake;
+        std::condition_variable poolDone;
+        uint64_t generation = 0;
+        size_t busyWorkers = 0;
+        bool stopping = false;
+        std::atomic<size_t> nextBin{ 0 };
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_OCCLUSION_RASTERIZER_HPP
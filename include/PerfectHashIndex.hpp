@@ -0,0 +1,62 @@
+// ====================================================================
+//                          PerfectHashIndex.hpp
+//     TGDK Quantum GPU Accelerator — Minimal Perfect Hashing
+//     Compiles a fixed key set into a collision-free slot index
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_PERFECT_HASH_INDEX_HPP
+#define TGDK_PERFECT_HASH_INDEX_HPP
+
+#include "Hash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // Hash-and-displace: keys are grouped into buckets of about
+    // kKeysPerBucket, and each bucket stores the pilot that sends all of
+    // its keys to free slots. Lookup is two multiplications and one
+    // pilot load; the table stores no keys, so callers must verify the
+    // slot they land on. Costs about one byte per key.
+    class PerfectHashIndex {
+    public:
+        static constexpr size_t kKeysPerBucket = 4;
+
+        // Keys must be distinct, well-mixed hashes; false on duplicates.
+        // TableSize() equals the key count unless every seed failed and
+        // the table had to grow, which has not been seen in practice.
+        bool Build(const std::vector<uint64_t>& keys);
+
+        // Slot in [0, TableSize()) for any key; unique per built key.
+        size_t Lookup(uint64_t key) const {
+            const uint64_t hash = Mix64(key ^ seed);
+            return Position(hash, pilots[Bucket(hash)]);
+        }
+
+        size_t TableSize() const { return tableSize; }
+        size_t MemoryBytes() const { return pilots.size() * sizeof(uint32_t); }
+
+    private:
+        size_t Bucket(uint64_t hash) const {
+            return static_cast<size_t>(((hash >> 32) * bucketCount) >> 32);
+        }
+
+        size_t Position(uint64_t hash, uint32_t pilot) const {
+            const uint64_t mixed = Mix64(hash ^ (pilot * 0x9E3779B97F4A7C15ull));
+            return static_cast<size_t>(((mixed & 0xFFFFFFFFull) * tableSize) >> 32);
+        }
+
+        bool TryBuild(const std::vector<uint64_t>& keys);
+
+        uint64_t seed = 0;
+        uint64_t bucketCount = 1;
+        size_t tableSize = 1;
+        std::vector<uint32_t> pilots = std::vector<uint32_t>(1, 0);
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_PERFECT_HASH_INDEX_HPP
@@ -0,0 +1,98 @@
+// ====================================================================
+//                          QualityLadder.hpp
+//     TGDK Quantum GPU Accelerator — Graduated Shader Quality
+//     Load-driven level selection with hysteresis and dwell times
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_QUALITY_LADDER_HPP
+#define TGDK_QUALITY_LADDER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    // Ordered from most to least expensive.
+    enum class ShaderQuality : uint8_t {
+        Full,
+        Reduced,
+        Minimal,
+        Flat,
+        Count
+    };
+
+    const char* ShaderQualityName(ShaderQuality quality);
+
+    // Load is predicted frame time over the frame budget, so 1.0 means
+    // exactly on budget.
+    struct QualityLadderPolicy {
+        // Load at or above which Reduced, Minimal and Flat are wanted.
+        // Heavier load degrades several levels at once.
+        std::array<float, 3> enterLoad = { 1.0f, 1.25f, 1.6f };
+        // A level is left upwards only once load drops below this
+        // fraction of the threshold that entered it.
+        float exitRatio = 0.85f;
+        uint32_t degradeFrames = 3;     // consecutive frames wanting a cheaper level
+        uint32_t restoreFrames = 60;    // consecutive frames below the exit threshold
+        uint32_t minDwellFrames = 30;   // frames at a level before it may change again
+    };
+
+    struct QualityLadderStats {
+        uint64_t transitions = 0;
+        std::array<uint64_t, static_cast<size_t>(ShaderQuality::Count)> framesAt{};
+    };
+
+    // One writer calls Update() once per frame; Level() is a single
+    // atomic load and safe from any thread, including bind hooks.
+    // Degrading may skip levels, restoring climbs one level at a time.
+    class QualityLadder {
+    public:
+        explicit QualityLadder(const QualityLadderPolicy& policy = QualityLadderPolicy{});
+
+        void SetPolicy(const QualityLadderPolicy& policy);
+        const QualityLadderPolicy& Policy() const { return policy; }
+
+        // Advances one frame; returns true when the level changed.
+        bool Update(float load);
+
+        ShaderQuality Level() const {
+            return static_cast<ShaderQuality>(level.load(std::memory_order_acquire));
+        }
+
+        // Highest quality allowed regardless of load, e.g. during a frame
+        // fold. Lowering it takes effect immediately; raising it back lets
+        // the ladder climb through the usual hysteresis. Any thread.
+        void SetCap(ShaderQuality cap);
+        ShaderQuality Cap() const {
+            return static_cast<ShaderQuality>(cap.load(std::memory_order_acquire));
+        }
+
+        void Reset();
+
+        // Update() thread only.
+        const QualityLadderStats& Stats() const { return stats; }
+
+    private:
+        // Degraded index wanted at this load, ignoring hysteresis
+        uint8_t Desired(float load) const;
+        // Moves the level to at least `floor`, racing SetCap() safely
+        void LowerTo(uint8_t floor);
+
+        QualityLadderPolicy policy;
+        std::atomic<uint8_t> level{ 0 };
+        std::atomic<uint8_t> cap{ 0 };
+
+        // Update() thread only
+        uint8_t observed = 0;
+        uint32_t dwell = 0;
+        uint32_t degradeRun = 0;
+        uint32_t restoreRun = 0;
+        QualityLadderStats stats;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_QUALITY_LADDER_HPP
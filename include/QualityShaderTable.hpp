@@ -0,0 +1,86 @@
+// ====================================================================
+//                        QualityShaderTable.hpp
+//     TGDK Quantum GPU Accelerator — Per-Level Shader Replacements
+//     Registrations resolved per quality level into an immutable
+//     snapshot that the shader-bind path reads without locks
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_QUALITY_SHADER_TABLE_HPP
+#define TGDK_QUALITY_SHADER_TABLE_HPP
+
+#include "EpochDomain.hpp"
+#include "QualityLadder.hpp"
+#include "ShaderRegistry.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // What each quality level binds in place of an original shader. A
+    // replacement registered for a level also applies to cheaper levels
+    // without one of their own, and a null original stands for every
+    // shader; such a catch-all hides exact replacements from richer sets.
+    //
+    // Every write rebuilds a snapshot with each level already resolved,
+    // publishes it with one atomic swap and retires the old one to an
+    // EpochDomain. A snapshot holds its own reference (through the
+    // IHandleOwner) on each shader in it, so a Resolve() racing Clear()
+    // still returns a live shader. Writes are serialized and cost
+    // O(registrations^2); they happen at load time.
+    class QualityShaderTable {
+    public:
+        explicit QualityShaderTable(IHandleOwner& owner, EpochDomain& domain = EpochDomain::Global());
+        ~QualityShaderTable();
+
+        QualityShaderTable(const QualityShaderTable&) = delete;
+        QualityShaderTable& operator=(const QualityShaderTable&) = delete;
+
+        // Retains `replacement` until it is replaced or cleared. Full has no
+        // replacements; registering for it is ignored, as is a null
+        // replacement.
+        void Register(ShaderQuality level, GpuHandle original, GpuHandle replacement);
+        void Clear();
+
+        // The shader to bind for `original` at `level` (`original` itself
+        // when the level leaves it alone), retained for the caller, who
+        // releases it once bound. Lock-free and allocation-free.
+        GpuHandle Resolve(ShaderQuality level, GpuHandle original) const;
+
+        size_t Registrations() const;
+
+    private:
+        static constexpr size_t kLevels = static_cast<size_t>(ShaderQuality::Count);
+
+        struct Binding {
+            GpuHandle original;
+            GpuHandle replacement;
+            uint32_t set;
+        };
+
+        struct Snapshot {
+            IHandleOwner* owner;
+            // Per level, sorted by original; shaders not listed get
+            // `fallback` (itself null when the level leaves them alone)
+            std::vector<Binding> exact[kLevels];
+            GpuHandle fallback[kLevels] = {};
+        };
+
+        static void DeleteSnapshot(void* snapshot);
+        // Writer only: resolves `bindings` and retires the previous snapshot
+        void PublishLocked();
+
+        IHandleOwner& owner;
+        EpochDomain& domain;
+        mutable std::mutex writeMutex;
+        std::vector<Binding> bindings;          // one reference each; guarded by writeMutex
+        std::atomic<const Snapshot*> current{ nullptr };
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_QUALITY_SHADER_TABLE_HPP
@@ -1,13 +1,173 @@
 #ifndef TGDK_QUANTUM_DRAW_ROUTER_HPP
 #define TGDK_QUANTUM_DRAW_ROUTER_HPP
 
+#include "RenderQueue.hpp"
+#include "DrawSignatureTable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _WIN32
 #include <d3d11.h>
+#endif
 
 namespace QuantumDrawRouter {
+
+    // Draw categories the suppression policy can mask independently.
+    enum class DrawCategory : uint8_t {
+        Default = 0,
+        Opaque,
+        Transparent,
+        Shadow,
+        PostProcess,
+        UI,
+        Count
+    };
+
+    constexpr uint32_t CategoryBit(DrawCategory category) {
+        return 1u << static_cast<uint32_t>(category);
+    }
+
+    constexpr uint32_t AllCategories = (1u << static_cast<uint32_t>(DrawCategory::Count)) - 1u;
+
+    // Importance classes for budgeted suppression. Critical draws are
+    // never dropped; the rest are shed in order of weight per second saved.
+    enum class DrawImportance : uint8_t {
+        Critical = 0,
+        High,
+        Medium,
+        Low,
+        Count
+    };
+
+    // Verdict computed once per frame by BeginFrame().
+    struct FramePolicy {
+        uint64_t frameIndex = 0;
+        float entropy = 0.0f;
+        bool routingEnabled = false;
+        bool backendVerdict = false;
+        bool suppress = false;
+        uint32_t suppressMask = 0;      // categories suppressed this frame
+        bool budgeted = false;
+        float projectedFrameTime = 0.0f;
+        float frameBudget = 0.0f;
+        float budgetExcess = 0.0f;      // estimated draw cost to shed this frame (s), closed loop
+    };
+
     void EnableRouting(bool enable);
     void SetEntropyThreshold(float threshold);
-    bool ShouldSuppressDraw();
+
+    // Categories that get suppressed when the frame policy says so (default: all).
+    void SetSuppressibleCategories(uint32_t categoryMask);
+
+    // Re-evaluates the policy (one predictor read, one backend call) and
+    // publishes it. Call once per frame, after EntropyPredictor::UpdateCycle().
+    void BeginFrame();
+    FramePolicy GetFramePolicy();
+
+    // Per-draw check: one relaxed atomic load, no locks, no virtual calls.
+    bool ShouldSuppressDraw(DrawCategory category = DrawCategory::Default);
+
+    // History-aware check. The draw's signature record refines the frame
+    // verdict: even in a suppressed category, draws the backends flagged
+    // Critical, draws whose suppression was noticed, and draws whose
+    // reported contribution is above the floor are kept. Outside a
+    // suppressed category this is the one-load check above; otherwise
+    // O(1) and lock-free on the history, which only the render thread
+    // touches. Render thread only.
+    bool ShouldSuppressDraw(DrawCategory category, uint64_t signature);
+    uint64_t DrawSignature(const QUADRAQ::QueuedDraw& draw);
+
+    // Backends report what a signature contributed (in their own units,
+    // e.g. fraction of covered pixels) and QUADRAQ::DrawImpact flags. Any
+    // thread; applied by the render thread at its next history check.
+    void ReportDrawImpact(uint64_t signature, float contribution, uint8_t impactFlags);
+    void SetContributionFloor(float contribution);
+    QUADRAQ::DrawSignatureStats GetSignatureStats();
+
+    // Batch evaluation against one read of the frame policy. Writes one bit
+    // per draw into `survivorMask` ((count + 63) / 64 words, bit set = draw
+    // survives) and returns the number of survivors. `categories` may be
+    // null, in which case every draw is treated as DrawCategory::Default.
+    size_t EvaluateDrawBatch(const DrawCategory* categories, size_t count, uint64_t* survivorMask);
+
+    // As above, then each suppressed draw is refined by its history the
+    // way the per-draw check does, so both give the same verdicts.
+    // `signatures` may be null (no history). Render thread only.
+    size_t EvaluateDrawBatch(const DrawCategory* categories, const uint64_t* signatures, size_t count, uint64_t* survivorMask);
+
+    // Budgeted mode replaces the all-or-nothing entropy threshold: estimated
+    // draw cost is shed per frame, cheapest-to-lose first. The amount is
+    // integrated from how far the projected frame time (which already
+    // reflects shedding) is over the budget, and held while it sits just
+    // under it, so it settles instead of flipping between shedding and
+    // not. Category suppression is off while it is active.
+    void SetBudgetedMode(bool enable);
+    void SetFrameBudget(float seconds);
+    // Weight lost by dropping a draw of this class; < 0 = never drop.
+    void SetImportanceWeight(DrawImportance importance, float weight);
+
+    // Budgeted counterpart of EvaluateDrawBatch, `costs` in seconds. Batches
+    // of the same frame share its excess. Same as EvaluateDrawBatch with
+    // default categories when budgeted mode is off. Render thread only.
+    size_t EvaluateBudgetedBatch(const float* costs, const DrawImportance* importance, size_t count, uint64_t* survivorMask);
+
+    // Clears every draw whose bit is clear in `visibleMask` (e.g. from
+    // QUADRAQ::CullingStage) and returns how many survivors remain.
+    size_t ApplyVisibilityMask(uint64_t* survivorMask, const uint64_t* visibleMask, size_t count);
+
+    // Expands a survivor mask into ascending draw indices; returns how many.
+    size_t CompactSurvivors(const uint64_t* survivorMask, size_t count, uint32_t* survivorIndices);
+
+    // Deferred submission. While enabled, SubmitDraw() queues surviving
+    // draws and FlushDeferred() sorts the frame by state and submits it,
+    // after shedding draws by QueuedDraw::cost in budgeted mode.
+    // Opaque and Shadow draws are reordered within their own runs by
+    // default; other categories keep their arrival position.
+    // SubmitDraw() and FlushDeferred() are render-thread only.
+    void SetDeferredMode(bool enable);
+    bool IsDeferredMode();
+    void SetReorderableCategories(uint32_t categoryMask);
+
+    // Returns false when the draw was suppressed. In immediate mode the
+    // draw is forwarded to `context` straight away.
+    bool SubmitDraw(QUADRAQ::IRenderContext& context, const QUADRAQ::QueuedDraw& draw,
+        DrawCategory category = DrawCategory::Default);
+
+    // Sorts and submits everything queued since the last flush. Call once
+    // per frame before Present; a no-op when nothing is queued.
+    QUADRAQ::RenderQueueStats FlushDeferred(QUADRAQ::IRenderContext& context);
+    QUADRAQ::RenderQueueStats GetLastFlushStats();
+
+    // Structure-of-arrays view over a burst of draws, all arrays `count` long.
+    struct DrawBatch {
+        size_t count = 0;
+        const DrawCategory* categories = nullptr;
+        const QUADRAQ::GpuHandle* vertexBuffers = nullptr;
+        const uint32_t* strides = nullptr;
+        const uint32_t* offsets = nullptr;
+        const uint32_t* vertexCounts = nullptr;     // optional, see SubmitDrawBatch
+        const uint32_t* startVertices = nullptr;    // optional, default 0
+        const float* costs = nullptr;               // optional, used in budgeted mode
+        const DrawImportance* importance = nullptr; // optional, default Critical
+        const uint64_t* visibleMask = nullptr;      // optional, from QUADRAQ::CullingStage
+        const uint64_t* signatures = nullptr;       // optional, default AttemptDraw's fingerprint
+    };
+
+    // Evaluates the whole batch in one pass and writes the survivors'
+    // indices to `survivorIndices` (capacity batch.count). With a context
+    // and vertex buffers, strides, offsets and vertexCounts set, each
+    // survivor is bound and drawn on `context`; otherwise nothing is
+    // submitted and the caller draws the survivors itself. Render thread only.
+    size_t SubmitDrawBatch(QUADRAQ::IRenderContext* context, const DrawBatch& batch, uint32_t* survivorIndices);
+
+#ifdef _WIN32
     void AttemptDraw(ID3D11DeviceContext* context, ID3D11Buffer* vertexBuffer, UINT stride, UINT offset);
+
+    // SubmitDrawBatch on `context` through the shared state cache, so
+    // buffers repeated within the batch are bound once.
+    size_t AttemptDrawBatch(ID3D11DeviceContext* context, const DrawBatch& batch, uint32_t* survivorIndices);
+#endif
 }
 
-#endif
\ No newline at end of file
+#endif
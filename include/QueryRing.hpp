@@ -0,0 +1,113 @@
+// ====================================================================
+//                            QueryRing.hpp
+//     TGDK Quantum GPU Accelerator — Non-Blocking GPU Query Ring
+//     Pre-created pipeline-statistics queries cycled over the frames
+//     in flight, read back without ever waiting on the GPU
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_QUERY_RING_HPP
+#define TGDK_QUERY_RING_HPP
+
+#include "RenderContext.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    struct PipelineStatistics {
+        uint64_t iaVertices = 0;
+        uint64_t iaPrimitives = 0;
+        uint64_t vsInvocations = 0;
+        uint64_t rasterPrimitives = 0;     // clipper invocations
+        uint64_t psInvocations = 0;
+    };
+
+    enum class QueryPoll : uint8_t {
+        Ready,
+        Pending,
+        Failed
+    };
+
+    // The slice of a device the ring needs. Poll() must never block.
+    class IQueryDevice {
+    public:
+        virtual ~IQueryDevice() = default;
+
+        // nullptr on failure.
+        virtual GpuHandle CreatePipelineQuery() = 0;
+        virtual void ReleaseQuery(GpuHandle query) = 0;
+
+        virtual void Begin(GpuHandle query) = 0;
+        virtual void End(GpuHandle query) = 0;
+        virtual QueryPoll Poll(GpuHandle query, PipelineStatistics& stats) = 0;
+    };
+
+    struct QueryRingStats {
+        uint64_t begun = 0;        // queries issued
+        uint64_t collected = 0;    // results read back
+        uint64_t skipped = 0;      // frames left unmeasured, ring full
+        uint64_t failed = 0;       // results the device could not return
+        uint32_t latency = 0;      // frames between issue and read-back of the last result
+    };
+
+    // Owns `framesInFlight` queries created up front; nothing is allocated
+    // afterwards. Each frame brackets its work with Begin()/End() and then
+    // calls Collect(), which hands back the newest finished result (frame
+    // N-2 with the default depth on a GPU running two frames behind).
+    // When every slot is still in flight the frame is skipped rather than
+    // waited on. Not thread-safe.
+    class QueryRing {
+    public:
+        static constexpr uint32_t kMaxFramesInFlight = 8;
+
+        explicit QueryRing(IQueryDevice& device, uint32_t framesInFlight = 3);
+        ~QueryRing();
+
+        QueryRing(const QueryRing&) = delete;
+        QueryRing& operator=(const QueryRing&) = delete;
+
+        // Creates the queries. False (and nothing held) if any creation fails.
+        bool Initialize();
+        bool IsInitialized() const { return initialized; }
+        void Release();
+
+        // Starts this frame's query; false when the frame goes unmeasured.
+        bool Begin();
+        void End();
+
+        // Polls in-flight queries oldest first without waiting. True when a
+        // newer result than the last one returned became available.
+        bool Collect(PipelineStatistics& stats);
+
+        uint32_t FramesInFlight() const { return depth; }
+        const QueryRingStats& Stats() const { return stats; }
+
+    private:
+        enum class SlotState : uint8_t {
+            Idle,
+            Recording,
+            InFlight
+        };
+
+        struct Slot {
+            GpuHandle query = nullptr;
+            uint64_t frame = 0;
+            SlotState state = SlotState::Idle;
+        };
+
+        IQueryDevice& device;
+        const uint32_t depth;
+        std::array<Slot, kMaxFramesInFlight> slots{};
+        uint32_t next = 0;          // slot the next Begin() uses
+        uint32_t oldest = 0;        // oldest slot that may be in flight
+        uint32_t recording = kMaxFramesInFlight;
+        uint64_t frame = 0;
+        bool initialized = false;
+        QueryRingStats stats;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_QUERY_RING_HPP
@@ -0,0 +1,66 @@
+// ====================================================================
+//                      RecordingRenderContext.hpp
+//     TGDK Quantum GPU Accelerator — Headless Device Context
+//     Records every call for inspection on hosts without D3D11
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_RECORDING_RENDER_CONTEXT_HPP
+#define TGDK_RECORDING_RENDER_CONTEXT_HPP
+
+#include "RenderContext.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace QUADRAQ {
+
+    class RecordingRenderContext : public IRenderContext {
+    public:
+        enum class Call : uint8_t {
+            SetVertexBuffer,
+            SetVertexShader,
+            SetPixelShader,
+            SetShaderResource,
+            SetPrimitiveTopology,
+            Draw,
+            Count
+        };
+
+        struct Command {
+            Call call;
+            ShaderStage stage;
+            uint32_t slot;
+            GpuHandle handle;
+            uint32_t a;     // stride / topology / vertex count
+            uint32_t b;     // offset / start vertex
+        };
+
+        // When `keepLog` is false only the per-call counters are kept.
+        explicit RecordingRenderContext(bool keepLog = true) : keepLog(keepLog) {}
+
+        void SetVertexBuffer(uint32_t slot, GpuHandle buffer, uint32_t stride, uint32_t offset) override;
+        void SetVertexShader(GpuHandle shader) override;
+        void SetPixelShader(GpuHandle shader) override;
+        void SetShaderResource(ShaderStage stage, uint32_t slot, GpuHandle view) override;
+        void SetPrimitiveTopology(uint32_t topology) override;
+        void Draw(uint32_t vertexCount, uint32_t startVertex) override;
+
+        void Clear();
+
+        const std::vector<Command>& Commands() const { return commands; }
+        size_t CallCount(Call call) const { return counts[static_cast<size_t>(call)]; }
+        size_t BindCount() const;   // every call except Draw
+
+    private:
+        void Record(const Command& command);
+
+        bool keepLog;
+        std::vector<Command> commands;
+        std::array<size_t, static_cast<size_t>(Call::Count)> counts{};
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_RECORDING_RENDER_CONTEXT_HPP
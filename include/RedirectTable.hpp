@@ -0,0 +1,108 @@
+// ====================================================================
+//                           RedirectTable.hpp
+//     TGDK Quantum GPU Accelerator — Read-Mostly Name Redirects
+//     Immutable snapshots swapped atomically on update, read without
+//     locks or allocation from any number of threads
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_REDIRECT_TABLE_HPP
+#define TGDK_REDIRECT_TABLE_HPP
+
+#include "EpochDomain.hpp"
+#include "Hash.hpp"
+#include "RenderContext.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // How a RedirectTable compares names.
+    enum class NameCase : uint8_t {
+        Sensitive,
+        Folded          // ASCII case ignored: names stored folded, lookups folded
+    };
+
+    // A name with its hash computed once, so hot paths can skip hashing.
+    // Folded() keys carry the case-folded hash a NameCase::Folded table
+    // wants; a table handed the other kind rehashes the name.
+    struct NameKey {
+        std::string_view name;
+        uint64_t hash;
+        bool folded = false;
+
+        explicit NameKey(std::string_view name) : name(name), hash(FastHash64(name.data(), name.size())) {}
+        NameKey(std::string_view name, uint64_t hash, bool folded = false) : name(name), hash(hash), folded(folded) {}
+
+        static NameKey Folded(std::string_view name) { return NameKey(name, FoldedHash64(name.data(), name.size()), true); }
+    };
+
+    // The name with ASCII case folded, as a NameCase::Folded table stores it.
+    std::string FoldName(std::string_view name);
+
+    // Maps names to handles. Every write compiles the table into a new
+    // immutable snapshot and publishes it with one atomic swap; the old
+    // snapshot is retired to an EpochDomain and freed once no reader can
+    // still be in it. A snapshot is a Bloom filter over the name hashes in
+    // front of a minimal perfect-hash index, so most misses cost one word
+    // load and a hit costs one slot probe plus the name compare. Writes
+    // are serialized and cost O(size); batch them with SetMany. A
+    // NameCase::Folded table treats names differing only in ASCII case as
+    // one name, hashing and comparing them folded without copying.
+    class RedirectTable {
+    public:
+        explicit RedirectTable(EpochDomain& domain = EpochDomain::Global());
+        explicit RedirectTable(NameCase nameCase, EpochDomain& domain = EpochDomain::Global());
+        ~RedirectTable();
+
+        RedirectTable(const RedirectTable&) = delete;
+        RedirectTable& operator=(const RedirectTable&) = delete;
+
+        // A null target removes the name.
+        void Set(std::string_view name, GpuHandle target);
+        // Points every name at `target` in a single rebuild.
+        void SetMany(const std::vector<std::string_view>& names, GpuHandle target);
+        bool Remove(std::string_view name);
+        void Clear();
+
+        // Lock-free and allocation-free; nullptr when the name is absent.
+        // An EpochGuard held around a batch of lookups pays the pin once.
+        GpuHandle Find(const NameKey& key) const;
+        GpuHandle Find(std::string_view name) const {
+            return Find(nameCase == NameCase::Folded ? NameKey::Folded(name) : NameKey(name));
+        }
+
+        size_t Size() const;
+        // Snapshot footprint: filter, index, slots and name storage.
+        size_t MemoryBytes() const;
+        // Bumped by every write that changed the table, after the new
+        // contents are visible; one atomic load, so callers can key
+        // caches of lookup results on it.
+        uint64_t Version() const { return version.load(std::memory_order_acquire); }
+
+    private:
+        struct Snapshot;
+        struct Entry;
+
+        // Entry names must stay valid until Build() returns
+        static Snapshot* Build(const std::vector<Entry>& entries, uint64_t version);
+        static void DeleteSnapshot(void* snapshot);
+        // Writer only: swaps in `next` and retires the previous snapshot
+        void Publish(Snapshot* next);
+
+        EpochDomain& domain;
+        const NameCase nameCase;
+        std::mutex writeMutex;
+        std::atomic<const Snapshot*> current{ nullptr };
+        std::atomic<uint64_t> version{ 0 };
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_REDIRECT_TABLE_HPP
@@ -0,0 +1,39 @@
+// ====================================================================
+//                          RenderContext.hpp
+//     TGDK Quantum GPU Accelerator — Device-Context Abstraction
+//     The binding surface QUADRAQ submits through, so render-path
+//     logic can run against D3D11 or a headless recorder
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_RENDER_CONTEXT_HPP
+#define TGDK_RENDER_CONTEXT_HPP
+
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    // Opaque GPU object: ID3D11Buffer*, ID3D11PixelShader*,
+    // ID3D11ShaderResourceView*, ... depending on the call.
+    using GpuHandle = void*;
+
+    enum class ShaderStage : uint8_t {
+        Vertex,
+        Pixel
+    };
+
+    class IRenderContext {
+    public:
+        virtual ~IRenderContext() = default;
+
+        virtual void SetVertexBuffer(uint32_t slot, GpuHandle buffer, uint32_t stride, uint32_t offset) = 0;
+        virtual void SetVertexShader(GpuHandle shader) = 0;
+        virtual void SetPixelShader(GpuHandle shader) = 0;
+        virtual void SetShaderResource(ShaderStage stage, uint32_t slot, GpuHandle view) = 0;
+        virtual void SetPrimitiveTopology(uint32_t topology) = 0;    // D3D11_PRIMITIVE_TOPOLOGY value
+        virtual void Draw(uint32_t vertexCount, uint32_t startVertex) = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_RENDER_CONTEXT_HPP
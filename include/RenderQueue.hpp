@@ -0,0 +1,104 @@
+// ====================================================================
+//                           RenderQueue.hpp
+//     TGDK Quantum GPU Accelerator — Deferred Draw Queue
+//     Packs each draw's state into a 64-bit key, radix-sorts the
+//     frame and submits it in state-coherent order
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_RENDER_QUEUE_HPP
+#define TGDK_RENDER_QUEUE_HPP
+
+#include "RenderContext.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QUADRAQ {
+
+    struct QueuedDraw {
+        GpuHandle vertexShader = nullptr;
+        GpuHandle pixelShader = nullptr;
+        GpuHandle texture = nullptr;        // pixel-stage SRV, slot 0
+        GpuHandle vertexBuffer = nullptr;   // IA slot 0
+        uint32_t stride = 0;
+        uint32_t offset = 0;
+        uint32_t vertexCount = 0;
+        uint32_t startVertex = 0;
+        float depth = 0.0f;                 // view depth in [0, 1], nearest first
+        float cost = 0.0f;                  // estimated GPU time (s), for budgeted suppression
+        uint8_t importance = 0;             // QuantumDrawRouter::DrawImportance
+    };
+
+    // Binds counted in the order the draws arrived versus the order they
+    // were submitted. Both assume a bind is skipped when the state already
+    // matches, so `BindsAvoided()` is purely the gain from reordering.
+    struct RenderQueueStats {
+        size_t draws = 0;
+        size_t segments = 0;
+        size_t arrivalBinds = 0;
+        size_t submittedBinds = 0;
+        size_t shaderBinds = 0;
+        size_t textureBinds = 0;
+        size_t vertexBufferBinds = 0;
+
+        size_t BindsAvoided() const { return arrivalBinds > submittedBinds ? arrivalBinds - submittedBinds : 0; }
+    };
+
+    // Sort key, most significant first:
+    //   [63:44] shader pair hash | [43:30] texture hash |
+    //   [29:16] vertex buffer hash | [15:0] quantized depth
+    // Hash collisions only cost sort quality; submission compares the real
+    // handles before binding.
+    //
+    // Only consecutive draws pushed with the same sort group are reordered
+    // among themselves, so a group change (e.g. shadow -> opaque pass)
+    // still happens exactly where it did. Draws pushed as kNoReorder
+    // (blending, post-process, UI) keep their position.
+    class RenderQueue {
+    public:
+        static constexpr uint32_t kNoReorder = UINT32_MAX;
+
+        void Reserve(size_t draws);
+        void Clear();
+
+        void Push(const QueuedDraw& draw, uint32_t sortGroup = 0);
+        size_t Size() const { return entries.size(); }
+
+        // Draws in arrival order, indexed as pushed.
+        const std::vector<QueuedDraw>& Draws() const { return draws; }
+
+        // Drops every draw whose bit is clear in `survivorMask` (indexed by
+        // arrival). Call before Sort().
+        void Retain(const uint64_t* survivorMask);
+
+        static uint64_t MakeSortKey(const QueuedDraw& draw);
+
+        // Sorts every run; stable, so equal keys keep arrival order.
+        void Sort();
+
+        // Submits in current order (call Sort() first) and clears the queue.
+        RenderQueueStats Submit(IRenderContext& context);
+
+    private:
+        // Key and draw index travel together so each radix pass scatters
+        // one stream instead of two.
+        struct SortEntry {
+            uint64_t key;
+            uint32_t draw;
+        };
+
+        void SortRange(size_t begin, size_t end);
+
+        std::vector<QueuedDraw> draws;
+        std::vector<SortEntry> entries;
+        std::vector<SortEntry> scratch;
+        std::vector<uint32_t> segmentStarts;    // first draw of every run
+        uint32_t lastGroup = kNoReorder;
+        size_t arrivalBinds = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_RENDER_QUEUE_HPP
@@ -0,0 +1,62 @@
+// ====================================================================
+//                           ResourcePool.hpp
+//     TGDK Quantum GPU Accelerator — Long-Lived Small Resources
+//     Immutable buffers created once per distinct content and shared
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_RESOURCE_POOL_HPP
+#define TGDK_RESOURCE_POOL_HPP
+
+#include "UploadRing.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace QUADRAQ {
+
+    struct ResourcePoolStats {
+        size_t resources = 0;
+        uint64_t bytes = 0;
+        uint64_t hits = 0;
+        uint64_t creations = 0;
+        uint64_t failed = 0;
+    };
+
+    // Content-addressed: acquiring the same bytes again returns the
+    // buffer made the first time, so QUADRAQ's fixed geometry is created
+    // once and never on the frame path afterwards. Buffers live until
+    // Release(). Not thread-safe.
+    class ResourcePool {
+    public:
+        static constexpr uint32_t kMaxResourceBytes = 64 * 1024;
+
+        explicit ResourcePool(IUploadDevice& device) : device(device) {}
+        ~ResourcePool();
+
+        ResourcePool(const ResourcePool&) = delete;
+        ResourcePool& operator=(const ResourcePool&) = delete;
+
+        // nullptr when the data is too large or creation fails.
+        GpuHandle Acquire(const void* data, uint32_t size, BufferKind kind);
+        void Release();
+
+        const ResourcePoolStats& Stats() const { return stats; }
+
+    private:
+        struct Entry {
+            GpuHandle buffer;
+            BufferKind kind;
+            std::vector<uint8_t> bytes;     // verifies hash matches
+        };
+
+        IUploadDevice& device;
+        std::unordered_multimap<uint64_t, Entry> entries;
+        ResourcePoolStats stats;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_RESOURCE_POOL_HPP
@@ -0,0 +1,47 @@
+// ====================================================================
+//                           RingStats.hpp
+//     TGDK Quantum GPU Accelerator — Sliding-Window Statistics
+//     Fixed-capacity ring buffer with O(1) running mean / variance
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_RING_STATS_HPP
+#define TGDK_RING_STATS_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // Keeps the last N samples in contiguous storage together with a
+    // running mean and Welford sum of squares. Storage is only allocated
+    // by the constructor and Resize(); Push() is O(1) for any window size.
+    class RingStats {
+    public:
+        explicit RingStats(size_t capacity = 120);
+
+        // Changes the window size. Discards all history.
+        void Resize(size_t capacity);
+        void Clear();
+        void Push(float sample);
+
+        size_t Capacity() const { return samples.size(); }
+        size_t Count() const { return count; }
+        bool IsFull() const { return count == samples.size(); }
+
+        float Mean() const { return static_cast<float>(mean); }
+        float Variance() const;     // population variance over the window
+        float StdDev() const;
+        float Newest() const;
+
+    private:
+        std::vector<float> samples;
+        size_t head = 0;            // next slot to write
+        size_t count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;            // sum of squared deviations from mean
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_RING_STATS_HPP
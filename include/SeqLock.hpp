@@ -0,0 +1,80 @@
+// ====================================================================
+//                            SeqLock.hpp
+//     TGDK Quantum GPU Accelerator — Lock-Free Snapshot Publication
+//     Single writer, any number of readers, no reader-side locking
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_SEQ_LOCK_HPP
+#define TGDK_SEQ_LOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace QUADRAQ {
+
+    // Publishes a small trivially-copyable value from one writer thread.
+    // The writer never waits; a reader that races with a write simply
+    // retries until it sees a stable sequence number. The payload is kept
+    // in relaxed atomic words so concurrent reads are well defined.
+    template <typename T>
+    class SeqLock {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+
+    public:
+        SeqLock() {
+            Store(T{});
+        }
+
+        // Must only be called from one thread at a time.
+        void Store(const T& value) {
+            uint64_t buffer[kWords] = {};
+            std::memcpy(buffer, &value, sizeof(T));
+
+            const uint32_t seq = sequence.load(std::memory_order_relaxed);
+            sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (size_t i = 0; i < kWords; ++i)
+                words[i].store(buffer[i], std::memory_order_relaxed);
+
+            sequence.store(seq + 2, std::memory_order_release);
+        }
+
+        T Load() const {
+            uint64_t buffer[kWords];
+
+            for (;;) {
+                const uint32_t before = sequence.load(std::memory_order_acquire);
+                if ((before & 1u) == 0) {
+                    for (size_t i = 0; i < kWords; ++i)
+                        buffer[i] = words[i].load(std::memory_order_relaxed);
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence.load(std::memory_order_relaxed) == before)
+                        break;
+                }
+            }
+
+            T value;
+            std::memcpy(&value, buffer, sizeof(T));
+            return value;
+        }
+
+        // Number of completed publications.
+        uint32_t Version() const {
+            return sequence.load(std::memory_order_acquire) >> 1;
+        }
+
+    private:
+        static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+        alignas(64) std::atomic<uint32_t> sequence{ 0 };
+        std::atomic<uint64_t> words[kWords];
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_SEQ_LOCK_HPP
@@ -0,0 +1,109 @@
+// ====================================================================
+//                          ShaderBlobCache.hpp
+//     TGDK Quantum GPU Accelerator — Precompiled Shader Cache
+//     Content-addressed bytecode blobs, memory-mapped at startup and
+//     handed to shader creation without copying
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_SHADER_BLOB_CACHE_HPP
+#define TGDK_SHADER_BLOB_CACHE_HPP
+
+#include "MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace QUADRAQ {
+
+    // Cache file layout, all integers little-endian:
+    //   header : "QDQS" | u16 version | u16 reserved | u32 entry count
+    //            | u32 reserved | u64 target tag | u64 entry table FNV-1a
+    //   table  : entry count x { u64 source hash | u32 variant | u32 size
+    //            | u64 offset | u64 blob FNV-1a }, sorted by (hash, variant)
+    //   blobs  : bytecode, each starting on a 16-byte boundary
+    // The target tag names the compiler and shader model the blobs were
+    // built for; a cache whose version or target does not match is stale
+    // and is rejected as a whole. Changed sources hash to new keys.
+    namespace ShaderBlobFormat {
+        constexpr char kMagic[4] = { 'Q', 'D', 'Q', 'S' };
+        constexpr uint16_t kVersion = 1;
+        constexpr size_t kHeaderSize = 32;
+        constexpr size_t kEntrySize = 32;
+        constexpr size_t kBlobAlignment = 16;
+        constexpr const char* kDefaultTarget = "d3d11-sm5";
+
+        uint64_t TargetTag(const std::string& target);
+    }
+
+    struct ShaderBlobKey {
+        uint64_t sourceHash = 0;
+        uint32_t variant = 0;       // caller-defined define / permutation bits
+    };
+
+    uint64_t HashShaderSource(const void* source, size_t size);
+
+    struct ShaderBlob {
+        const void* data = nullptr;
+        size_t size = 0;
+
+        explicit operator bool() const { return data != nullptr; }
+    };
+
+    class ShaderBlobCache {
+    public:
+        // Maps the file and validates its header and entry table; blob
+        // bytes are not touched. `expectedTarget` 0 accepts any target.
+        bool Open(const std::string& path, uint64_t expectedTarget = 0);
+        void Close();
+        bool IsOpen() const { return table != nullptr; }
+
+        // Binary search over the mapped table. The blob points into the
+        // mapping and stays valid until Close().
+        bool Find(const ShaderBlobKey& key, ShaderBlob& blob) const;
+
+        size_t Count() const { return count; }
+        ShaderBlobKey KeyAt(size_t index) const;
+        ShaderBlob BlobAt(size_t index) const;
+        uint64_t Target() const { return target; }
+
+        // Rehashes every blob; false (with Error() set) at the first mismatch.
+        bool VerifyBlobs();
+
+        const std::string& Error() const { return error; }
+
+    private:
+        bool Fail(const std::string& message);
+
+        MappedFile file;
+        const uint8_t* table = nullptr;
+        size_t count = 0;
+        uint64_t target = 0;
+        std::string error;
+    };
+
+    // Builds a cache file. Blobs are kept in memory until Write().
+    class ShaderBlobCacheWriter {
+    public:
+        // Replaces any blob already added under the same key.
+        void Add(const ShaderBlobKey& key, const void* data, size_t size);
+        size_t Count() const { return blobs.size(); }
+
+        // Writes to `path`.tmp and renames it over `path`, so a reader
+        // never maps a half-written cache.
+        bool Write(const std::string& path, uint64_t targetTag);
+
+        const std::string& Error() const { return error; }
+
+    private:
+        std::map<std::pair<uint64_t, uint32_t>, std::vector<uint8_t>> blobs;
+        std::string error;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_SHADER_BLOB_CACHE_HPP
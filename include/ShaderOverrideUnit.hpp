@@ -1,25 +1,65 @@
 #ifndef TGDK_SHADER_OVERRIDE_UNIT_HPP
 #define TGDK_SHADER_OVERRIDE_UNIT_HPP
 
+#include "QualityLadder.hpp"
+#include "ShaderRegistry.hpp"
+
 #include <d3d11.h>
+#include <cstdint>
+#include <string>
 
 namespace ShaderOverrideUnit {
     // Hooks into D3D pipeline
     bool HookPipeline(ID3D11Device* device, ID3D11DeviceContext* context);
 
-    // Overrides current pixel shader
+    // Overrides current pixel shader. Takes ownership of one reference to
+    // `newShader`; overriding with the same shader again holds no more.
     void OverridePixelShader(ID3D11PixelShader* newShader);
 
+    // Draws a triangle list from caller memory, uploaded through the
+    // per-frame upload ring. False if it did not fit this frame.
+    bool DrawTransient(const void* vertices, uint32_t stride, uint32_t vertexCount);
+
     // Clears all shader overrides
     void ClearOverrides();
 
+    // Shaders held by the override registry and their memory footprint.
+    QUADRAQ::ShaderRegistryStats GetRegistryStats();
+
     // Called every frame to monitor GPU/render activity
     void FrameMonitor();
 
     // Enables/disables the override system
     void SetEnabled(bool enable);
 
-    void ForceMinimal(bool state);
+    // Maps a precompiled shader cache (see ShaderBlobCache.hpp, built with
+    // tools/quadraq_shadercache) for ShaderBlobFormat::kDefaultTarget.
+    // A missing or stale cache is logged and leaves runtime compilation.
+    bool LoadShaderCache(const std::string& path);
+
+    // Creates a pixel shader from the cached bytecode for the source with
+    // this hash (QUADRAQ::HashShaderSource) and variant; nullptr when not
+    // cached. The caller owns the returned reference.
+    ID3D11PixelShader* CreateCachedPixelShader(uint64_t sourceHash, uint32_t variant = 0);
+
+    // Quality ladder. `replacement` is bound instead of `original` at
+    // `level` and at cheaper levels without a replacement of their own; a
+    // null `original` stands for every shader. Registered shaders are
+    // AddRef'd until ClearQualityShaders().
+    void RegisterQualityShader(QUADRAQ::ShaderQuality level, ID3D11PixelShader* original, ID3D11PixelShader* replacement);
+    void ClearQualityShaders();
+
+    // Shader to bind in place of `original` at the current level, with a
+    // reference the caller releases once it is bound. Never locks: the
+    // per-level replacements are read from a published snapshot.
+    ID3D11PixelShader* ResolvePixelShader(ID3D11PixelShader* original);
+
+    // Lock-free. Stepped once per FrameMonitor() from predicted load.
+    QUADRAQ::ShaderQuality GetShaderQuality();
+
+    // Highest quality allowed regardless of load; ShaderQuality::Full lifts it.
+    void SetQualityCap(QUADRAQ::ShaderQuality cap);
+    void SetQualityPolicy(const QUADRAQ::QualityLadderPolicy& policy);
 
     // Returns whether override system is currently active
     bool IsEnabled();
@@ -0,0 +1,119 @@
+// ====================================================================
+//                          ShaderRegistry.hpp
+//     TGDK Quantum GPU Accelerator — Shader Override Registry
+//     Interned, reference-owning map from original shaders to their
+//     replacements, with O(1) lookup and a memory report
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_SHADER_REGISTRY_HPP
+#define TGDK_SHADER_REGISTRY_HPP
+
+#include "RenderContext.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+namespace QUADRAQ {
+
+    // Reference counting for the handles a registry holds (AddRef/Release
+    // on D3D11).
+    class IHandleOwner {
+    public:
+        virtual ~IHandleOwner() = default;
+        virtual void Retain(GpuHandle handle) = 0;
+        virtual void Release(GpuHandle handle) = 0;
+    };
+
+    struct ShaderRegistryStats {
+        size_t shaders = 0;             // distinct interned shaders, one reference each
+        size_t overrides = 0;           // (set, original) -> replacement mappings
+        uint64_t bytecodeBytes = 0;     // as declared when interning
+        size_t tableBytes = 0;          // approximate bookkeeping footprint
+        uint64_t interned = 0;          // shaders ever retained
+        uint64_t deduplicated = 0;      // interns answered by an existing shader
+        uint64_t released = 0;          // shaders ever released
+    };
+
+    // Each distinct shader is retained exactly once however often it is
+    // registered, and released as soon as the last override using it goes
+    // away, so memory is bounded by the live overrides. Overrides live in
+    // numbered sets (e.g. one per quality level); originals are identity
+    // keys only and are not retained, and a null original is a valid key.
+    // Not thread-safe.
+    class ShaderRegistry {
+    public:
+        explicit ShaderRegistry(IHandleOwner& owner) : owner(owner) {}
+        ~ShaderRegistry();
+
+        ShaderRegistry(const ShaderRegistry&) = delete;
+        ShaderRegistry& operator=(const ShaderRegistry&) = delete;
+
+        // Canonical handle for `shader`: an already interned shader with the
+        // same identity, or with the same non-zero content hash, else
+        // `shader` itself, now retained. Shaders interned but never used by
+        // an override are kept until Trim() or Clear().
+        GpuHandle Intern(GpuHandle shader, uint64_t contentHash = 0, size_t bytecodeSize = 0);
+        // nullptr when no interned shader has this content hash.
+        GpuHandle FindByContent(uint64_t contentHash) const;
+
+        // Points `original` in `set` at the canonical form of `replacement`,
+        // dropping whatever it pointed at before. Returns that canonical handle.
+        GpuHandle SetOverride(uint32_t set, GpuHandle original, GpuHandle replacement,
+                              uint64_t contentHash = 0, size_t bytecodeSize = 0);
+        bool RemoveOverride(uint32_t set, GpuHandle original);
+        void ClearSet(uint32_t set);
+
+        // nullptr when `original` has no override in `set`.
+        GpuHandle Lookup(uint32_t set, GpuHandle original) const {
+            const auto it = overrides.find(OverrideKey{ set, original });
+            return it == overrides.end() ? nullptr : it->second;
+        }
+
+        // Releases interned shaders that no override uses; returns how many.
+        size_t Trim();
+        void Clear();
+
+        ShaderRegistryStats Stats() const;
+
+    private:
+        struct Record {
+            uint64_t contentHash;
+            size_t bytecodeSize;
+            size_t uses;                // overrides pointing here
+        };
+
+        struct OverrideKey {
+            uint32_t set;
+            GpuHandle original;
+
+            bool operator==(const OverrideKey& other) const {
+                return set == other.set && original == other.original;
+            }
+        };
+
+        struct OverrideKeyHash {
+            size_t operator()(const OverrideKey& key) const {
+                return std::hash<GpuHandle>()(key.original) ^ (static_cast<size_t>(key.set) * 0x9E3779B97F4A7C15ull);
+            }
+        };
+
+        // Drops one use; releases the shader when it was the last
+        void Unuse(GpuHandle shader);
+        void Forget(GpuHandle shader);
+
+        IHandleOwner& owner;
+        std::unordered_map<GpuHandle, Record> shaders;
+        std::unordered_map<uint64_t, GpuHandle> byContent;
+        std::unordered_map<OverrideKey, GpuHandle, OverrideKeyHash> overrides;
+        uint64_t bytecodeBytes = 0;
+        uint64_t interned = 0;
+        uint64_t deduplicated = 0;
+        uint64_t released = 0;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_SHADER_REGISTRY_HPP
@@ -0,0 +1,74 @@
+// ====================================================================
+//                       SignalChannelBank.hpp
+//     TGDK Quantum GPU Accelerator — Multi-Channel Signal Fusion
+//     Per-channel sliding statistics and a fused overload score
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_SIGNAL_CHANNEL_BANK_HPP
+#define TGDK_SIGNAL_CHANNEL_BANK_HPP
+
+#include "RingStats.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    // Fixed table of named signals stored as parallel arrays. Each channel
+    // keeps its own RingStats window. The fused score is the
+    // weight-averaged positive z-score of each live channel's latest
+    // sample against its window. A channel is live while its latest sample
+    // was scored (its window already held enough samples) and was pushed
+    // within the last `staleFrames` frames (see Advance()), so a never-fed,
+    // warming or stalled channel neither dilutes the score nor keeps its
+    // last contribution in it.
+    class SignalChannelBank {
+    public:
+        static constexpr size_t kMaxChannels = 16;
+        static constexpr size_t kMaxNameLength = 31;
+        static constexpr uint32_t kInvalid = 0xFFFFFFFFu;
+
+        explicit SignalChannelBank(size_t windowFrames = 120, uint32_t staleFrames = 8);
+
+        // Returns the existing id if `name` is already registered, or
+        // kInvalid once the table is full.
+        uint32_t Register(const char* name, float weight = 1.0f);
+        uint32_t Find(const char* name) const;
+        size_t Count() const { return channelCount; }
+
+        void Push(uint32_t id, float value);
+        // Call once per frame; ages channels that were not pushed.
+        void Advance() { ++frame; }
+        void Clear();
+
+        const char* Name(uint32_t id) const { return names[id].data(); }
+        float Weight(uint32_t id) const { return weights[id]; }
+        const RingStats& Stats(uint32_t id) const { return stats[id]; }
+        float Last(uint32_t id) const { return lastValues[id]; }
+        float ZScore(uint32_t id) const { return zScores[id]; }
+        bool IsLive(uint32_t id) const;
+
+        // O(channels), at most 16.
+        float FusedScore() const;
+
+    private:
+        static constexpr size_t kMinSamplesForScore = 8;
+
+        size_t channelCount = 0;
+        std::array<std::array<char, kMaxNameLength + 1>, kMaxChannels> names{};
+        std::array<float, kMaxChannels> weights{};
+        std::array<RingStats, kMaxChannels> stats;
+        std::array<float, kMaxChannels> lastValues{};
+        std::array<float, kMaxChannels> zScores{};
+        std::array<float, kMaxChannels> contributions{};
+        std::array<uint64_t, kMaxChannels> pushedFrame{};
+        std::array<bool, kMaxChannels> scored{};
+        uint64_t frame = 0;
+        uint32_t staleFrames;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_SIGNAL_CHANNEL_BANK_HPP
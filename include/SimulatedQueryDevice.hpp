@@ -0,0 +1,65 @@
+// ====================================================================
+//                       SimulatedQueryDevice.hpp
+//     TGDK Quantum GPU Accelerator — Headless Query Device
+//     Answers queries a fixed number of frames after they end, for
+//     driving QueryRing on hosts without D3D11
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_SIMULATED_QUERY_DEVICE_HPP
+#define TGDK_SIMULATED_QUERY_DEVICE_HPP
+
+#include "QueryRing.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QUADRAQ {
+
+    class SimulatedQueryDevice : public IQueryDevice {
+    public:
+        // A query ended during frame F becomes ready once AdvanceFrame()
+        // has moved the device to frame F + latencyFrames.
+        explicit SimulatedQueryDevice(uint32_t latencyFrames = 2) : latency(latencyFrames) {}
+
+        void SetLatency(uint32_t frames) { latency = frames; }
+        // Statistics reported by queries ended from now on.
+        void SetResult(const PipelineStatistics& stats) { result = stats; }
+        void SetCreateFailure(bool fail) { failCreate = fail; }
+        void AdvanceFrame() { ++frame; }
+
+        GpuHandle CreatePipelineQuery() override;
+        void ReleaseQuery(GpuHandle query) override;
+        void Begin(GpuHandle query) override;
+        void End(GpuHandle query) override;
+        QueryPoll Poll(GpuHandle query, PipelineStatistics& stats) override;
+
+        uint64_t Frame() const { return frame; }
+        size_t LiveQueries() const;
+        uint64_t QueriesCreated() const { return created; }
+        uint64_t Polls() const { return polls; }
+
+    private:
+        struct Query {
+            bool live = false;
+            bool ended = false;
+            uint64_t endFrame = 0;
+            PipelineStatistics result;
+        };
+
+        // nullptr for handles this device did not create or already released
+        Query* Lookup(GpuHandle query);
+
+        std::vector<Query> queries;
+        PipelineStatistics result;
+        uint32_t latency;
+        uint64_t frame = 0;
+        uint64_t created = 0;
+        uint64_t polls = 0;
+        bool failCreate = false;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_SIMULATED_QUERY_DEVICE_HPP
@@ -0,0 +1,72 @@
+// ====================================================================
+//                       SimulatedUploadDevice.hpp
+//     TGDK Quantum GPU Accelerator — Headless Upload Device
+//     Host-memory buffers and fences that complete a fixed number of
+//     frames after they are signalled, for driving the upload
+//     allocators on hosts without D3D11
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_SIMULATED_UPLOAD_DEVICE_HPP
+#define TGDK_SIMULATED_UPLOAD_DEVICE_HPP
+
+#include "UploadRing.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QUADRAQ {
+
+    class SimulatedUploadDevice : public IUploadDevice {
+    public:
+        // A fence signalled during frame F completes once AdvanceFrame()
+        // has moved the device to frame F + latencyFrames.
+        explicit SimulatedUploadDevice(uint32_t latencyFrames = 2) : latency(latencyFrames) {}
+
+        void SetLatency(uint32_t frames) { latency = frames; }
+        void SetCreateFailure(bool fail) { failCreate = fail; }
+        void AdvanceFrame() { ++frame; }
+
+        GpuHandle CreateDynamicBuffer(uint32_t byteSize, BufferKind kind) override;
+        GpuHandle CreateStaticBuffer(const void* data, uint32_t byteSize, BufferKind kind) override;
+        void ReleaseBuffer(GpuHandle buffer) override;
+        void* Map(GpuHandle buffer, MapMode mode) override;
+        void Unmap(GpuHandle buffer) override;
+        uint64_t SignalFence() override;
+        uint64_t CompletedFence() override;
+
+        // Host copy of a live buffer's contents; nullptr otherwise.
+        const uint8_t* Contents(GpuHandle buffer) const;
+
+        uint64_t Frame() const { return frame; }
+        size_t LiveBuffers() const;
+        uint64_t BuffersCreated() const { return created; }
+        uint64_t Maps(MapMode mode) const { return maps[static_cast<size_t>(mode)]; }
+
+    private:
+        struct Buffer {
+            bool live = false;
+            bool dynamic = false;
+            bool mapped = false;
+            std::vector<uint8_t> bytes;
+        };
+
+        // nullptr for handles this device did not create or already released
+        Buffer* Lookup(GpuHandle buffer);
+        const Buffer* Lookup(GpuHandle buffer) const;
+        GpuHandle Create(uint32_t byteSize, bool dynamic);
+
+        std::vector<Buffer> buffers;
+        std::vector<uint64_t> fenceFrames;      // frame each fence was signalled in
+        uint64_t completed = 0;
+        uint32_t latency;
+        uint64_t frame = 0;
+        uint64_t created = 0;
+        uint64_t maps[2] = {};
+        bool failCreate = false;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_SIMULATED_UPLOAD_DEVICE_HPP
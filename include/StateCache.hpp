@@ -0,0 +1,81 @@
+// ====================================================================
+//                            StateCache.hpp
+//     TGDK Quantum GPU Accelerator — Redundant Bind Elimination
+//     Shadows the bound pipeline state and drops binds that would
+//     not change it
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_STATE_CACHE_HPP
+#define TGDK_STATE_CACHE_HPP
+
+#include "RenderContext.hpp"
+#include "SeqLock.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    struct StateCacheCounters {
+        uint64_t frameIndex = 0;
+        uint64_t issued = 0;        // binds forwarded to the target
+        uint64_t elided = 0;        // binds dropped as redundant
+    };
+
+    // IRenderContext decorator. The shadow copy only reflects binds made
+    // through the cache, so Invalidate() whenever other code may have
+    // touched the context (BeginFrame() does this implicitly). Slots past
+    // the tracked range are always forwarded. Not thread-safe apart from
+    // LastFrame().
+    class StateCache : public IRenderContext {
+    public:
+        static constexpr uint32_t kVertexBufferSlots = 16;
+        static constexpr uint32_t kShaderResourceSlots = 16;
+
+        explicit StateCache(IRenderContext* target = nullptr);
+
+        // Switches the forwarding target and forgets all shadowed state.
+        void SetTarget(IRenderContext* target);
+        IRenderContext* Target() const { return target; }
+
+        void Invalidate();
+
+        // Publishes the finished frame's counters, starts new ones and
+        // invalidates the shadow state.
+        void BeginFrame();
+
+        const StateCacheCounters& Current() const { return current; }
+        StateCacheCounters LastFrame() const { return lastFrame.Load(); }
+
+        void SetVertexBuffer(uint32_t slot, GpuHandle buffer, uint32_t stride, uint32_t offset) override;
+        void SetVertexShader(GpuHandle shader) override;
+        void SetPixelShader(GpuHandle shader) override;
+        void SetShaderResource(ShaderStage stage, uint32_t slot, GpuHandle view) override;
+        void SetPrimitiveTopology(uint32_t topology) override;
+        void Draw(uint32_t vertexCount, uint32_t startVertex) override;
+
+    private:
+        struct Binding {
+            GpuHandle handle = nullptr;
+            uint32_t a = 0;
+            uint32_t b = 0;
+            bool valid = false;
+        };
+
+        // True (and the shadow updated) when the bind has to be issued
+        bool Update(Binding& binding, GpuHandle handle, uint32_t a = 0, uint32_t b = 0);
+
+        IRenderContext* target;
+        std::array<Binding, kVertexBufferSlots> vertexBuffers;
+        std::array<std::array<Binding, kShaderResourceSlots>, 2> shaderResources;
+        Binding vertexShader;
+        Binding pixelShader;
+        Binding topology;
+        StateCacheCounters current;
+        SeqLock<StateCacheCounters> lastFrame;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_STATE_CACHE_HPP
@@ -0,0 +1,125 @@
+// ====================================================================
+//                            UploadRing.hpp
+//     TGDK Quantum GPU Accelerator — Frame-Scoped Upload Allocator
+//     One persistent dynamic buffer sub-allocated as a ring, with
+//     space reclaimed once the GPU passes each frame's fence
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_UPLOAD_RING_HPP
+#define TGDK_UPLOAD_RING_HPP
+
+#include "RenderContext.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace QUADRAQ {
+
+    enum class BufferKind : uint8_t {
+        Geometry,       // vertex and index data
+        Constant
+    };
+
+    enum class MapMode : uint8_t {
+        Discard,        // previous contents may be thrown away
+        NoOverwrite     // caller promises not to touch bytes the GPU may read
+    };
+
+    // The slice of a device the upload allocators need.
+    class IUploadDevice {
+    public:
+        virtual ~IUploadDevice() = default;
+
+        // CPU-writable buffer for Map(); nullptr on failure.
+        virtual GpuHandle CreateDynamicBuffer(uint32_t byteSize, BufferKind kind) = 0;
+        // GPU-only buffer holding `data`; nullptr on failure.
+        virtual GpuHandle CreateStaticBuffer(const void* data, uint32_t byteSize, BufferKind kind) = 0;
+        virtual void ReleaseBuffer(GpuHandle buffer) = 0;
+
+        virtual void* Map(GpuHandle buffer, MapMode mode) = 0;
+        virtual void Unmap(GpuHandle buffer) = 0;
+
+        // Marks all work submitted so far and returns its fence value.
+        // Values increase by one per call, starting at 1.
+        virtual uint64_t SignalFence() = 0;
+        // Highest fence value the GPU has passed. Must not block.
+        virtual uint64_t CompletedFence() = 0;
+    };
+
+    struct UploadAllocation {
+        GpuHandle buffer = nullptr;
+        uint32_t offset = 0;
+        uint32_t size = 0;
+
+        explicit operator bool() const { return buffer != nullptr; }
+    };
+
+    struct UploadStats {
+        uint32_t capacity = 0;
+        uint32_t bytesInFlight = 0;     // allocated and not yet reclaimed
+        uint32_t peakBytesInFlight = 0;
+        uint32_t framesInFlight = 0;
+        uint64_t allocations = 0;
+        uint64_t bytesAllocated = 0;
+        uint64_t failed = 0;            // requests that did not fit
+        uint64_t wraps = 0;
+    };
+
+    // Hands out aligned byte ranges of one dynamic Geometry buffer. Each
+    // EndFrame() fences the frame's allocations; they are reused once
+    // CompletedFence() passes that fence, so mapping never has to discard
+    // or wait. When the GPU falls too far behind, Upload() fails instead
+    // of stalling. Not thread-safe.
+    class UploadRing {
+    public:
+        static constexpr uint32_t kMaxFramesInFlight = 16;
+
+        explicit UploadRing(IUploadDevice& device, uint32_t capacity = 1u << 20);
+        ~UploadRing();
+
+        UploadRing(const UploadRing&) = delete;
+        UploadRing& operator=(const UploadRing&) = delete;
+
+        bool Initialize();
+        bool IsInitialized() const { return buffer != nullptr; }
+        void Release();
+
+        // Copies `size` bytes into the ring. An empty allocation on failure.
+        UploadAllocation Upload(const void* data, uint32_t size, uint32_t alignment = 16);
+
+        // Closes the current frame. Call once per frame after its draws
+        // have been submitted.
+        void EndFrame();
+
+        GpuHandle Buffer() const { return buffer; }
+        const UploadStats& Stats() const { return stats; }
+
+    private:
+        struct FrameMark {
+            uint64_t fence;
+            uint64_t end;           // head when the frame closed
+        };
+
+        void Reclaim();
+
+        IUploadDevice& device;
+        const uint32_t capacity;
+        GpuHandle buffer = nullptr;
+        bool mappedOnce = false;
+
+        // Monotonic byte positions; the physical offset is position % capacity
+        uint64_t head = 0;
+        uint64_t tail = 0;
+        uint64_t frameStart = 0;
+
+        std::array<FrameMark, kMaxFramesInFlight> frames{};
+        uint32_t frameFirst = 0;
+        uint32_t frameCount = 0;
+
+        UploadStats stats;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_UPLOAD_RING_HPP
@@ -0,0 +1,120 @@
+// ====================================================================
+//                           VerdictCache.hpp
+//     TGDK Quantum GPU Accelerator — Per-Resource Override Verdicts
+//     Pointer-keyed open-addressing cache of "replace with X" or
+//     "leave alone", so the bind path does no name work
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#ifndef TGDK_VERDICT_CACHE_HPP
+#define TGDK_VERDICT_CACHE_HPP
+
+#include "EpochDomain.hpp"
+#include "RenderContext.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace QUADRAQ {
+
+    struct VerdictCacheStats {
+        size_t capacity = 0;
+        size_t keys = 0;                // live and invalidated resources in the current table
+        uint64_t resets = 0;            // tables replaced by a version change or fill-up
+    };
+
+    // Every verdict is stamped with the version of the rules that produced
+    // it (e.g. RedirectTable::Version(), which only grows); a lookup under
+    // any other version misses, the first Store() under a newer version
+    // starts a fresh table, and stores under an older one are dropped. Lookup, Store and
+    // Invalidate are lock-free and may race freely; only starting a new
+    // table takes a lock. Keys are never removed: Invalidate() forgets
+    // the verdict but keeps the slot for the next resource at that
+    // address, and a table that fills to half its capacity is replaced.
+    class VerdictCache {
+        struct Anchor;
+
+    public:
+        static constexpr size_t kDefaultCapacity = 4096;
+
+        // For a resource's destruction callback, e.g. one parked in D3D
+        // private data. Fire() forgets the resource's verdict; once the
+        // cache is destroyed it does nothing, so callbacks that run after
+        // it (resources released during static destruction) are safe.
+        class ReleaseHook {
+        public:
+            // False when the cache was already gone.
+            bool Fire() const;
+
+        private:
+            friend class VerdictCache;
+            ReleaseHook(std::shared_ptr<Anchor> anchor, GpuHandle resource)
+                : anchor(std::move(anchor)), resource(resource) {}
+
+            std::shared_ptr<Anchor> anchor;
+            GpuHandle resource;         // address only; never dereferenced
+        };
+
+        explicit VerdictCache(size_t capacity = kDefaultCapacity, EpochDomain& domain = EpochDomain::Global());
+        ~VerdictCache();
+
+        VerdictCache(const VerdictCache&) = delete;
+        VerdictCache& operator=(const VerdictCache&) = delete;
+
+        // True when `resource` has a verdict under `version`; `replacement`
+        // is then the override, or nullptr for "no override".
+        bool Lookup(GpuHandle resource, uint64_t version, GpuHandle& replacement) const;
+        void Store(GpuHandle resource, uint64_t version, GpuHandle replacement);
+
+        // Call when `resource` is destroyed, before its address can be reused.
+        void Invalidate(GpuHandle resource);
+        // Invalidate(resource) for a callback that may outlive the cache.
+        ReleaseHook Hook(GpuHandle resource) const { return ReleaseHook(anchor, resource); }
+        void Clear();
+
+        VerdictCacheStats Stats() const;
+
+    private:
+        struct Slot {
+            std::atomic<uintptr_t> key{ 0 };        // 0 = empty
+            std::atomic<uintptr_t> verdict{ 0 };    // kUnknown, kNoOverride or the replacement
+        };
+
+        struct Table {
+            Table(size_t capacity, uint64_t version);
+
+            const uint64_t version;
+            const size_t mask;
+            std::atomic<size_t> keys{ 0 };
+            std::unique_ptr<Slot[]> slots;
+        };
+
+        // Shared with the hooks; cleared under the lock when the cache dies
+        struct Anchor {
+            std::mutex mutex;
+            VerdictCache* cache;
+        };
+
+        static constexpr uintptr_t kUnknown = 0;
+        static constexpr uintptr_t kNoOverride = 1;
+
+        static size_t Home(GpuHandle resource, size_t mask);
+        static void DeleteTable(void* table);
+        // Publishes an empty table for `version` unless `seen` was already replaced
+        void Reset(Table* seen, uint64_t version);
+
+        const size_t capacity;
+        EpochDomain& domain;
+        std::mutex resetMutex;
+        std::atomic<Table*> current{ nullptr };
+        std::atomic<uint64_t> resets{ 0 };
+        std::shared_ptr<Anchor> anchor;
+    };
+
+} // namespace QUADRAQ
+
+#endif // TGDK_VERDICT_CACHE_HPP
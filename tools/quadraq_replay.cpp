@@ -0,0 +1,165 @@
+// ====================================================================
+//                         quadraq_replay.cpp
+//     TGDK Quantum GPU Accelerator — Frame Trace Replay Harness
+//     Feeds a captured frame trace through EntropyPredictor and
+//     QuantumDrawRouter on a virtual clock, faster than real time
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "EntropyPredictor.hpp"
+#include "QuantumDrawRouter.hpp"
+#include "FrameClock.hpp"
+#include "FrameTrace.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+    struct Options {
+        std::string capturePath;
+        float entropyThreshold = 0.010f;
+        size_t sampleWindow = 120;
+        bool forecasting = true;
+        bool transitionsOnly = false;
+        EntropyPredictor::OverloadPolicy policy;
+    };
+
+    struct SceneMarker {
+        int direction = 0;
+        uint32_t count = 0;
+    };
+
+    void OnSceneTransition(const EntropyPredictor::SceneTransitionEvent& event, void* userData) {
+        auto* marker = static_cast<SceneMarker*>(userData);
+        marker->direction = event.direction;
+        ++marker->count;
+    }
+
+    void PrintUsage() {
+        std::fprintf(stderr,
+            "usage: quadraq_replay <capture.qdt> [options]\n"
+            "  --threshold <ms>     router entropy threshold (default 10)\n"
+            "  --window <frames>    predictor sample window (default 120)\n"
+            "  --enter-ms <ms>      overload enter frame time\n"
+            "  --exit-ms <ms>       overload exit frame time\n"
+            "  --enter-frames <n>   consecutive frames to raise overload\n"
+            "  --exit-frames <n>    consecutive frames to clear overload\n"
+            "  --no-forecast        drive overload from measured frame time\n"
+            "  --transitions-only   only print frames where something changed\n");
+    }
+
+    bool ParseOptions(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "--threshold" && hasValue) options.entropyThreshold = std::strtof(argv[++i], nullptr) / 1000.0f;
+            else if (arg == "--window" && hasValue) options.sampleWindow = std::strtoul(argv[++i], nullptr, 10);
+            else if (arg == "--enter-ms" && hasValue) options.policy.enterFrameTime = std::strtof(argv[++i], nullptr) / 1000.0f;
+            else if (arg == "--exit-ms" && hasValue) options.policy.exitFrameTime = std::strtof(argv[++i], nullptr) / 1000.0f;
+            else if (arg == "--enter-frames" && hasValue) options.policy.enterFrames = std::strtoul(argv[++i], nullptr, 10);
+            else if (arg == "--exit-frames" && hasValue) options.policy.exitFrames = std::strtoul(argv[++i], nullptr, 10);
+            else if (arg == "--no-forecast") options.forecasting = false;
+            else if (arg == "--transitions-only") options.transitionsOnly = true;
+            else if (!arg.empty() && arg[0] != '-' && options.capturePath.empty()) options.capturePath = arg;
+            else return false;
+        }
+        return !options.capturePath.empty();
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 2;
+    }
+
+    QUADRAQ::FrameTraceReader reader;
+    if (!reader.Open(options.capturePath)) {
+        std::fprintf(stderr, "quadraq_replay: %s\n", reader.Error().c_str());
+        return 1;
+    }
+
+    // Everything below reads FrameClock, which now only moves when we advance it
+    FrameClock::SetVirtual(true);
+
+    EntropyPredictor::Initialize();
+    EntropyPredictor::SetEnabled(true);
+    EntropyPredictor::SetSampleWindow(options.sampleWindow);
+    EntropyPredictor::SetForecastingEnabled(options.forecasting);
+    EntropyPredictor::SetOverloadPolicy(options.policy);
+    QuantumDrawRouter::EnableRouting(true);
+    QuantumDrawRouter::SetEntropyThreshold(options.entropyThreshold);
+
+    SceneMarker scene;
+    EntropyPredictor::SubscribeSceneTransition(OnSceneTransition, &scene);
+
+    std::printf("# frame dt_ms entropy_ms forecast_ms decision [events]\n");
+
+    const auto wallStart = std::chrono::steady_clock::now();
+    uint64_t frames = 0, suppressed = 0, decisionChanges = 0;
+    uint64_t overloadRaised = 0, overloadCleared = 0;
+    uint64_t replayedNanoseconds = 0;
+    bool lastDecision = false, lastOverload = false;
+
+    uint64_t frameNanoseconds = 0;
+    while (reader.Next(frameNanoseconds)) {
+        FrameClock::Advance(frameNanoseconds);
+        replayedNanoseconds += frameNanoseconds;
+        scene.direction = 0;
+
+        EntropyPredictor::UpdateCycle();
+        QuantumDrawRouter::BeginFrame();
+        const bool suppress = QuantumDrawRouter::ShouldSuppressDraw();
+        const EntropyPredictor::Snapshot snapshot = EntropyPredictor::GetSnapshot();
+
+        std::string events;
+        if (snapshot.overloaded != lastOverload) {
+            events += snapshot.overloaded ? " OVERLOAD_RAISED" : " OVERLOAD_CLEARED";
+            (snapshot.overloaded ? overloadRaised : overloadCleared)++;
+        }
+        if (scene.direction != 0)
+            events += scene.direction > 0 ? " SCENE+" : " SCENE-";
+
+        const bool changed = frames == 0 || suppress != lastDecision || !events.empty();
+        if (suppress != lastDecision && frames != 0) ++decisionChanges;
+        if (!options.transitionsOnly || changed) {
+            std::printf("%llu %.3f %.3f %.3f %s%s\n",
+                static_cast<unsigned long long>(frames),
+                frameNanoseconds * 1e-6,
+                snapshot.entropyRate * 1000.0f,
+                EntropyPredictor::PredictNextFrameTime() * 1000.0f,
+                suppress ? "SUPPRESS" : "ALLOW",
+                events.c_str());
+        }
+
+        lastDecision = suppress;
+        lastOverload = snapshot.overloaded;
+        suppressed += suppress ? 1 : 0;
+        ++frames;
+    }
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    if (!reader.Error().empty()) {
+        std::fprintf(stderr, "quadraq_replay: stopped after %llu frames: %s\n",
+            static_cast<unsigned long long>(frames), reader.Error().c_str());
+    }
+
+    const auto p = EntropyPredictor::GetFrameTimePercentiles(EntropyPredictor::Horizon::Session);
+    std::printf("# frames %llu | replayed %.3f s in %.3f s (%.0fx)\n",
+        static_cast<unsigned long long>(frames), replayedNanoseconds * 1e-9, wallSeconds,
+        wallSeconds > 0.0 ? replayedNanoseconds * 1e-9 / wallSeconds : 0.0);
+    std::printf("# suppressed %llu | decision changes %llu | overload raised %llu cleared %llu | scenes %u\n",
+        static_cast<unsigned long long>(suppressed), static_cast<unsigned long long>(decisionChanges),
+        static_cast<unsigned long long>(overloadRaised), static_cast<unsigned long long>(overloadCleared), scene.count);
+    std::printf("# p50 %.2f ms | p95 %.2f ms | p99 %.2f ms | p99.9 %.2f ms\n",
+        p.p50 * 1000.0f, p.p95 * 1000.0f, p.p99 * 1000.0f, p.p999 * 1000.0f);
+
+    return reader.Error().empty() ? 0 : 1;
+}
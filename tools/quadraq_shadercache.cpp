@@ -0,0 +1,130 @@
+// ====================================================================
+//                       quadraq_shadercache.cpp
+//     TGDK Quantum GPU Accelerator — Shader Cache Packer / Validator
+//     Packs precompiled bytecode into a QUADRAQ shader cache keyed by
+//     the hash of each shader's source, and checks existing caches
+//     Part of QUADRAQ BFE-TGDK-022ST
+// ====================================================================
+
+#include "ShaderBlobCache.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+    void PrintUsage() {
+        std::fprintf(stderr,
+            "usage: quadraq_shadercache pack <cache.qsc> [--target <name>] <source> <variant> <bytecode> ...\n"
+            "       quadraq_shadercache verify <cache.qsc> [--target <name>]\n"
+            "       quadraq_shadercache list <cache.qsc>\n"
+            "  --target <name>   compiler / shader model tag (default %s)\n"
+            "  <variant>         permutation bits the bytecode was compiled with\n",
+            QUADRAQ::ShaderBlobFormat::kDefaultTarget);
+    }
+
+    bool ReadFile(const std::string& path, std::vector<uint8_t>& bytes) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) return false;
+
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        return !in.bad();
+    }
+
+    int Pack(const std::string& cachePath, const std::string& target, const std::vector<std::string>& inputs) {
+        if (inputs.empty() || inputs.size() % 3 != 0) {
+            PrintUsage();
+            return 2;
+        }
+
+        QUADRAQ::ShaderBlobCacheWriter writer;
+        std::vector<uint8_t> source;
+        std::vector<uint8_t> bytecode;
+
+        for (size_t i = 0; i < inputs.size(); i += 3) {
+            if (!ReadFile(inputs[i], source)) {
+                std::fprintf(stderr, "error: cannot read %s\n", inputs[i].c_str());
+                return 1;
+            }
+            if (!ReadFile(inputs[i + 2], bytecode)) {
+                std::fprintf(stderr, "error: cannot read %s\n", inputs[i + 2].c_str());
+                return 1;
+            }
+
+            QUADRAQ::ShaderBlobKey key;
+            key.sourceHash = QUADRAQ::HashShaderSource(source.data(), source.size());
+            key.variant = static_cast<uint32_t>(std::strtoul(inputs[i + 1].c_str(), nullptr, 0));
+            writer.Add(key, bytecode.data(), bytecode.size());
+
+            std::printf("%016llx:%08x  %8zu bytes  %s\n",
+                static_cast<unsigned long long>(key.sourceHash), key.variant,
+                bytecode.size(), inputs[i + 2].c_str());
+        }
+
+        if (!writer.Write(cachePath, QUADRAQ::ShaderBlobFormat::TargetTag(target))) {
+            std::fprintf(stderr, "error: %s\n", writer.Error().c_str());
+            return 1;
+        }
+
+        std::printf("wrote %zu blobs to %s (target %s)\n", writer.Count(), cachePath.c_str(), target.c_str());
+        return 0;
+    }
+
+    int Verify(const std::string& cachePath, const std::string& target) {
+        QUADRAQ::ShaderBlobCache cache;
+        const uint64_t expected = target.empty() ? 0 : QUADRAQ::ShaderBlobFormat::TargetTag(target);
+
+        if (!cache.Open(cachePath, expected) || !cache.VerifyBlobs()) {
+            std::fprintf(stderr, "%s: INVALID (%s)\n", cachePath.c_str(), cache.Error().c_str());
+            return 1;
+        }
+
+        std::printf("%s: OK, %zu blobs\n", cachePath.c_str(), cache.Count());
+        return 0;
+    }
+
+    int List(const std::string& cachePath) {
+        QUADRAQ::ShaderBlobCache cache;
+        if (!cache.Open(cachePath)) {
+            std::fprintf(stderr, "%s: INVALID (%s)\n", cachePath.c_str(), cache.Error().c_str());
+            return 1;
+        }
+
+        std::printf("target tag %016llx, %zu blobs\n", static_cast<unsigned long long>(cache.Target()), cache.Count());
+        for (size_t i = 0; i < cache.Count(); ++i) {
+            const QUADRAQ::ShaderBlobKey key = cache.KeyAt(i);
+            std::printf("%016llx:%08x  %8zu bytes\n",
+                static_cast<unsigned long long>(key.sourceHash), key.variant, cache.BlobAt(i).size);
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        PrintUsage();
+        return 2;
+    }
+
+    const std::string command = argv[1];
+    const std::string cachePath = argv[2];
+
+    std::string target;
+    std::vector<std::string> inputs;
+    for (int i = 3; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--target" && i + 1 < argc) target = argv[++i];
+        else inputs.push_back(arg);
+    }
+
+    if (command == "pack") return Pack(cachePath, target.empty() ? QUADRAQ::ShaderBlobFormat::kDefaultTarget : target, inputs);
+    if (command == "verify" && inputs.empty()) return Verify(cachePath, target);
+    if (command == "list" && inputs.empty()) return List(cachePath);
+
+    PrintUsage();
+    return 2;
+}